@@ -42,6 +42,7 @@
 #include "app.h"
 #include "app_assert.h"
 #include "app_log.h"
+#include "sl_main_profiler.h"
 
 #ifdef SL_CATALOG_MIKROE_ACCEL5_BMA400_SPI_PRESENT
 #include "sl_spidrv_instances.h"
@@ -58,6 +59,41 @@
 // Flag set each time sleep timer callback to trigger bluetooth external signal
 #define TIMER_CALLBACK_FLAG   (1 << 0)
 
+// LED blinking period while advertising, in ms
+#define LED_BLINKY_PERIOD_MS  (800)
+// Delay the LED timer may expire late to share a wakeup with other timers, in ms
+#define LED_BLINKY_SLACK_MS   (50)
+
+// Set to 1 to batch the samples in the BMA400 FIFO and read them on its
+// watermark interrupt, instead of reading each sample on data ready
+#ifndef APP_BMA400_FIFO_MODE
+#define APP_BMA400_FIFO_MODE               (0)
+#endif
+// Output data rate of the BMA400
+#ifndef APP_BMA400_ODR
+#define APP_BMA400_ODR                     BMA400_ODR_25HZ
+#endif
+// Number of samples the BMA400 FIFO holds before raising its watermark
+// interrupt, in FIFO mode
+#ifndef APP_BMA400_FIFO_WATERMARK_FRAMES
+#define APP_BMA400_FIFO_WATERMARK_FRAMES   (25)
+#endif
+// Size of a FIFO frame with 12-bit x, y and z data: header and 3 x 2 bytes
+#define APP_BMA400_FIFO_FRAME_SIZE         (7)
+// Number of FIFO frames read at once, leaving room for the samples taken
+// while the watermark interrupt is served
+#define APP_BMA400_FIFO_READ_FRAMES        (2 * APP_BMA400_FIFO_WATERMARK_FRAMES)
+#define APP_BMA400_FIFO_READ_SIZE          (APP_BMA400_FIFO_READ_FRAMES * APP_BMA400_FIFO_FRAME_SIZE)
+
+// Size of a sample in the acceleration and acceleration batch characteristics
+#define ACCEL_SAMPLE_SIZE     (3)
+// ATT notification header size, subtracted from the MTU
+#define ATT_NOTIFICATION_HEADER_SIZE  (3)
+// Default ATT MTU
+#define ATT_DEFAULT_MTU       (23)
+// ATT error of a read beyond the end of a value
+#define ATT_ERROR_INVALID_OFFSET  (0x07)
+
 // Earth's gravity in m/s^2
 #define GRAVITY_EARTH         (9.80665f)
 // 39.0625us per tick
@@ -70,11 +106,34 @@ static sl_sleeptimer_timer_handle_t led_blinky_timer;
 static uint8_t advertising_set_handle = 0xff;
 // If the notification is enabled or not
 static uint8_t notification_enabled = 0;
+// If the notification of the acceleration batch characteristic is enabled or not
+static uint8_t batch_notification_enabled = 0;
 static int16_t connection_handle = 0xff;
+// ATT MTU of the connection
+static uint16_t connection_mtu = ATT_DEFAULT_MTU;
+// Profiler summary served on the main loop profile characteristic, taken when
+// a read starts so that the rest of a long read returns the same summary.
+static uint8_t main_loop_profile[SL_MAIN_PROFILER_PROBE_COUNT * SL_MAIN_PROFILER_SUMMARY_SIZE];
+static size_t main_loop_profile_len = 0;
+#if (APP_BMA400_FIFO_MODE == 1)
+// Raw FIFO data and the samples unpacked from it. The extra byte receives the
+// dummy byte of SPI reads.
+static uint8_t fifo_buffer[APP_BMA400_FIFO_READ_SIZE + 1];
+static struct bma400_sensor_data fifo_samples[APP_BMA400_FIFO_READ_FRAMES];
+#endif
 
 static void app_gpio_int_cb(uint8_t intNo);
+static void app_bma400_pack_sample(const struct bma400_sensor_data *accel_data_raw,
+                                   uint8_t *accel_buffer);
+static void app_bma400_send_samples(const uint8_t *accel_buffer,
+                                    uint16_t sample_count);
+#if (APP_BMA400_FIFO_MODE == 1)
+static void app_bma400_read_fifo(void);
+#endif
 static void app_bma400_config(void);
 static void app_bma400_get_data(uint32_t extsignals);
+static sl_status_t app_send_main_loop_profile(uint8_t connection,
+                                              uint16_t offset);
 static void led_blinky_timer_callback(sl_sleeptimer_timer_handle_t *handle,
                                       void *data);
 static float lsb_to_ms2(int16_t accel_data, uint8_t g_range, uint8_t bit_width);
@@ -86,12 +145,13 @@ void app_init(void)
 {
   app_bma400_config();
   app_log("> Start measuring...\n");
-  sl_sleeptimer_start_periodic_timer_ms(&led_blinky_timer,
-                                        800,
-                                        led_blinky_timer_callback,
-                                        NULL,
-                                        0,
-                                        0);
+  sl_sleeptimer_start_periodic_timer_ms_with_slack(&led_blinky_timer,
+                                                   LED_BLINKY_PERIOD_MS,
+                                                   LED_BLINKY_SLACK_MS,
+                                                   led_blinky_timer_callback,
+                                                   NULL,
+                                                   0,
+                                                   0);
 }
 
 /**************************************************************************//**
@@ -148,6 +208,8 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     case sl_bt_evt_connection_opened_id:
 
       notification_enabled = 0;
+      batch_notification_enabled = 0;
+      connection_mtu = ATT_DEFAULT_MTU;
       sc = sl_sleeptimer_stop_timer(&led_blinky_timer);
       app_assert_status(sc);
       sl_led_turn_off(SL_SIMPLE_LED_INSTANCE(0));
@@ -160,13 +222,15 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     case sl_bt_evt_connection_closed_id:
 
       notification_enabled = 0;
+      batch_notification_enabled = 0;
       connection_handle = 0xff;
-      sl_sleeptimer_start_periodic_timer_ms(&led_blinky_timer,
-                                            800,
-                                            led_blinky_timer_callback,
-                                            NULL,
-                                            0,
-                                            0);
+      sl_sleeptimer_start_periodic_timer_ms_with_slack(&led_blinky_timer,
+                                                       LED_BLINKY_PERIOD_MS,
+                                                       LED_BLINKY_SLACK_MS,
+                                                       led_blinky_timer_callback,
+                                                       NULL,
+                                                       0,
+                                                       0);
       app_assert_status(sc);
       app_log("Connection closed. -> Start advertising..\r\n");
       // Restart advertising after client has disconnected.
@@ -179,6 +243,12 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     // Add additional event handlers here as your application requires!      //
     ///////////////////////////////////////////////////////////////////////////
 
+    // -------------------------------
+    // This event indicates that the ATT MTU of the connection was exchanged.
+    case sl_bt_evt_gatt_mtu_exchanged_id:
+      connection_mtu = evt->data.evt_gatt_mtu_exchanged.mtu;
+      break;
+
     case sl_bt_evt_gatt_server_characteristic_status_id:
 
       if (evt->data.evt_gatt_server_characteristic_status.characteristic
@@ -191,6 +261,14 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
         } else {
           notification_enabled = 0;
         }
+      } else if (evt->data.evt_gatt_server_characteristic_status.characteristic
+                 == gattdb_acceleration_batch) {
+        if (evt->data.evt_gatt_server_characteristic_status.client_config_flags
+            & sl_bt_gatt_notification) {
+          batch_notification_enabled = 1;
+        } else {
+          batch_notification_enabled = 0;
+        }
       }
 
       break;
@@ -199,6 +277,20 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       app_bma400_get_data(evt->data.evt_system_external_signal.extsignals);
       break;
 
+    // -------------------------------
+    // This event indicates that a remote GATT client reads a characteristic
+    // of the user type.
+    case sl_bt_evt_gatt_server_user_read_request_id:
+      if (evt->data.evt_gatt_server_user_read_request.characteristic
+          == gattdb_main_loop_profile) {
+        sc = app_send_main_loop_profile(evt->data.evt_gatt_server_user_read_request.connection,
+                                        evt->data.evt_gatt_server_user_read_request.offset);
+        if (sc != SL_STATUS_OK) {
+          app_log("[E: 0x%04x] Failed to send main loop profile\r\n", (int)sc);
+        }
+      }
+      break;
+
     // -------------------------------
     // Default event handler.
     default:
@@ -258,7 +350,7 @@ static void app_bma400_config(void)
              "[E: 0x%04x] Failed to init BMA400 interface\r\n",
              (int)rslt);
   conf.param.accel.int_chan = BMA400_INT_CHANNEL_1;
-  conf.param.accel.odr = BMA400_ODR_25HZ;
+  conf.param.accel.odr = APP_BMA400_ODR;
   conf.param.accel.range = BMA400_RANGE_2G;
   conf.param.accel.data_src = BMA400_DATA_SRC_ACCEL_FILT_1;
   // Set the desired configurations to the sensor
@@ -272,7 +364,29 @@ static void app_bma400_config(void)
              "[E: 0x%04x] Failed to init BMA400 interface\r\n",
              (int)rslt);
 
+#if (APP_BMA400_FIFO_MODE == 1)
+  struct bma400_device_conf fifo_conf;
+
+  // Store 12-bit x, y and z frames, without sensor time, and raise the
+  // watermark interrupt on INT1.
+  fifo_conf.type = BMA400_FIFO_CONF;
+  fifo_conf.param.fifo_conf.conf_regs = BMA400_FIFO_X_EN
+                                        | BMA400_FIFO_Y_EN
+                                        | BMA400_FIFO_Z_EN;
+  fifo_conf.param.fifo_conf.conf_status = BMA400_ENABLE;
+  fifo_conf.param.fifo_conf.fifo_watermark = APP_BMA400_FIFO_WATERMARK_FRAMES
+                                             * APP_BMA400_FIFO_FRAME_SIZE;
+  fifo_conf.param.fifo_conf.fifo_full_channel = BMA400_UNMAP_INT_PIN;
+  fifo_conf.param.fifo_conf.fifo_wm_channel = BMA400_INT_CHANNEL_1;
+  rslt = bma400_set_device_conf(&fifo_conf, 1, &bma);
+  app_assert(rslt == BMA400_OK,
+             "[E: 0x%04x] Failed to init BMA400 interface\r\n",
+             (int)rslt);
+
+  int_en.type = BMA400_FIFO_WM_INT_EN;
+#else
   int_en.type = BMA400_DRDY_INT_EN;
+#endif
   int_en.conf = BMA400_ENABLE;
   rslt = bma400_enable_interrupt(&int_en, 1, &bma);
   app_assert(rslt == BMA400_OK,
@@ -291,12 +405,13 @@ static void led_blinky_timer_callback(sl_sleeptimer_timer_handle_t *handle,
 static void app_bma400_get_data(uint32_t extsignals)
 {
   if (extsignals & TIMER_CALLBACK_FLAG) {
-    sl_status_t sc;
+#if (APP_BMA400_FIFO_MODE == 1)
+    app_bma400_read_fifo();
+#else
     int8_t rslt;
     struct bma400_sensor_data accel_data_raw;
-    struct bma400_sensor_data accel_data_ms2;
     uint16_t int_status = 0;
-    uint8_t accel_buffer[3];
+    uint8_t accel_buffer[ACCEL_SAMPLE_SIZE];
 
     rslt = bma400_get_interrupt_status(&int_status, &bma);
     if (rslt != BMA400_OK) {
@@ -313,32 +428,167 @@ static void app_bma400_get_data(uint32_t extsignals)
         return;
       }
 
-      /* 12-bit accelerometer at range 2G */
-      accel_data_ms2.x = (int16_t) (10 * lsb_to_ms2(accel_data_raw.x, 2, 12));
-      accel_buffer[0] = (uint8_t) abs(accel_data_ms2.x);
-      accel_data_ms2.y = (int16_t) (10 * lsb_to_ms2(accel_data_raw.y, 2, 12));
-      accel_buffer[1] = (uint8_t) abs(accel_data_ms2.y);
-      accel_data_ms2.z = (int16_t) (10 * lsb_to_ms2(accel_data_raw.z, 2, 12));
-      accel_buffer[2] = (uint8_t) abs(accel_data_ms2.z);
+      app_bma400_pack_sample(&accel_data_raw, accel_buffer);
+      app_bma400_send_samples(accel_buffer, 1);
+    }
+#endif
+  }
+}
 
-      sc = sl_bt_gatt_server_write_attribute_value(gattdb_acceleration,
-                                                   0,
-                                                   3,
-                                                   accel_buffer);
-      app_assert_status(sc);
+#if (APP_BMA400_FIFO_MODE == 1)
+/**************************************************************************//**
+ * Reads all the samples stored in the BMA400 FIFO and sends them.
+ *
+ * The FIFO is read until it holds less than a full read, so that the
+ * watermark interrupt line falls and the next watermark raises a new edge.
+ *****************************************************************************/
+static void app_bma400_read_fifo(void)
+{
+  struct bma400_fifo_data fifo;
+  uint16_t frame_count;
+  int8_t rslt;
 
-      if ((notification_enabled == 1) && (connection_handle != 0xff)) {
-        sc = sl_bt_gatt_server_send_notification(connection_handle,
-                                                 gattdb_acceleration,
-                                                 3,
-                                                 accel_buffer);
+  do {
+    fifo.data = fifo_buffer;
+    fifo.length = APP_BMA400_FIFO_READ_SIZE;
+    rslt = bma400_get_fifo_data(&fifo, &bma);
+    if (rslt != BMA400_OK) {
+      app_log("[E: 0x%04x] Failed to get FIFO data\r\n", (int)rslt);
+      return;
+    }
 
-        app_assert_status(sc);
-      }
+    frame_count = APP_BMA400_FIFO_READ_FRAMES;
+    rslt = bma400_extract_accel(&fifo, fifo_samples, &frame_count, &bma);
+    if (rslt != BMA400_OK) {
+      app_log("[E: 0x%04x] Failed to extract accel data\r\n", (int)rslt);
+      return;
+    }
+
+    // The samples are packed in place, as a packed sample is smaller than
+    // its FIFO frame.
+    for (uint16_t i = 0; i < frame_count; i++) {
+      app_bma400_pack_sample(&fifo_samples[i], &fifo_buffer[i * ACCEL_SAMPLE_SIZE]);
+    }
+    app_bma400_send_samples(fifo_buffer, frame_count);
+  } while (fifo.length >= APP_BMA400_FIFO_READ_SIZE);
+}
+#endif
+
+/**************************************************************************//**
+ * Converts a raw sample to the acceleration characteristic format.
+ *
+ * @param[in] accel_data_raw Raw sample.
+ * @param[out] accel_buffer Absolute acceleration on x, y and z in 0.1 m/s^2.
+ *****************************************************************************/
+static void app_bma400_pack_sample(const struct bma400_sensor_data *accel_data_raw,
+                                   uint8_t *accel_buffer)
+{
+  /* 12-bit accelerometer at range 2G */
+  accel_buffer[0] = (uint8_t) abs((int16_t) (10 * lsb_to_ms2(accel_data_raw->x, 2, 12)));
+  accel_buffer[1] = (uint8_t) abs((int16_t) (10 * lsb_to_ms2(accel_data_raw->y, 2, 12)));
+  accel_buffer[2] = (uint8_t) abs((int16_t) (10 * lsb_to_ms2(accel_data_raw->z, 2, 12)));
+}
+
+/**************************************************************************//**
+ * Stores the last sample in the acceleration characteristic and notifies it.
+ * Notifies all the samples in the acceleration batch characteristic, as many
+ * per notification as the ATT MTU allows. If a notification cannot be sent,
+ * the failure is logged and the rest of the samples dropped.
+ *
+ * @param[in] accel_buffer Packed samples.
+ * @param[in] sample_count Number of samples.
+ *****************************************************************************/
+static void app_bma400_send_samples(const uint8_t *accel_buffer,
+                                    uint16_t sample_count)
+{
+  sl_status_t sc;
+  uint16_t samples_per_notification;
+
+  if (sample_count == 0) {
+    return;
+  }
+
+  sc = sl_bt_gatt_server_write_attribute_value(gattdb_acceleration,
+                                               0,
+                                               ACCEL_SAMPLE_SIZE,
+                                               &accel_buffer[(sample_count - 1) * ACCEL_SAMPLE_SIZE]);
+  app_assert_status(sc);
+
+  if (connection_handle == 0xff) {
+    return;
+  }
+
+  // The acceleration characteristic keeps its single sample layout.
+  if (notification_enabled == 1) {
+    sc = sl_bt_gatt_server_send_notification(connection_handle,
+                                             gattdb_acceleration,
+                                             ACCEL_SAMPLE_SIZE,
+                                             &accel_buffer[(sample_count - 1) * ACCEL_SAMPLE_SIZE]);
+    if (sc != SL_STATUS_OK) {
+      app_log("[E: 0x%04x] Failed to send notification\r\n", (int)sc);
+    }
+  }
+
+  if (batch_notification_enabled != 1) {
+    return;
+  }
+
+  samples_per_notification = SL_MIN(connection_mtu - ATT_NOTIFICATION_HEADER_SIZE,
+                                    gattdb_acceleration_batch_len)
+                             / ACCEL_SAMPLE_SIZE;
+  for (uint16_t sent = 0; sent < sample_count; sent += samples_per_notification) {
+    uint16_t count = SL_MIN(samples_per_notification, sample_count - sent);
+
+    sc = sl_bt_gatt_server_send_notification(connection_handle,
+                                             gattdb_acceleration_batch,
+                                             count * ACCEL_SAMPLE_SIZE,
+                                             &accel_buffer[sent * ACCEL_SAMPLE_SIZE]);
+    if (sc != SL_STATUS_OK) {
+      // Typically out of buffers or a closing connection: the rest of the
+      // batch is dropped, the next batch is sent anyway.
+      app_log("[E: 0x%04x] Failed to send notification, %u samples dropped\r\n",
+              (int)sc,
+              (unsigned int)(sample_count - sent));
+      break;
     }
   }
 }
 
+/**************************************************************************//**
+ * Responds to a read of the main loop profile characteristic with the
+ * summary of sl_main_profiler_serialize(). The summary is taken on the read
+ * at offset 0, the read blob requests of a long read continue from it.
+ *
+ * @param[in] connection Connection handle.
+ * @param[in] offset Offset of the read in the characteristic value.
+ *
+ * @return Status of the response.
+ *****************************************************************************/
+static sl_status_t app_send_main_loop_profile(uint8_t connection,
+                                              uint16_t offset)
+{
+  uint16_t sent_len;
+
+  if (offset == 0) {
+    main_loop_profile_len = sl_main_profiler_serialize(main_loop_profile,
+                                                       sizeof(main_loop_profile));
+  }
+  if (offset > main_loop_profile_len) {
+    return sl_bt_gatt_server_send_user_read_response(connection,
+                                                     gattdb_main_loop_profile,
+                                                     ATT_ERROR_INVALID_OFFSET,
+                                                     0,
+                                                     NULL,
+                                                     &sent_len);
+  }
+  return sl_bt_gatt_server_send_user_read_response(connection,
+                                                   gattdb_main_loop_profile,
+                                                   0,
+                                                   main_loop_profile_len - offset,
+                                                   &main_loop_profile[offset],
+                                                   &sent_len);
+}
+
 static float lsb_to_ms2(int16_t accel_data, uint8_t g_range, uint8_t bit_width)
 {
   float accel_ms2;
@@ -22,6 +22,8 @@ extern const sli_bt_gattdb_t gattdb;
 #define gattdb_firmware_revision_string       24
 #define gattdb_accelerometer_service          25
 #define gattdb_acceleration                   27
+#define gattdb_acceleration_batch             30
+#define gattdb_main_loop_profile              33
 
 #define gattdb_generic_attribute_len          2
 #define gattdb_service_changed_char_len       4
@@ -36,6 +38,7 @@ extern const sli_bt_gattdb_t gattdb;
 #define gattdb_firmware_revision_string_len   8
 #define gattdb_accelerometer_service_len      16
 #define gattdb_acceleration_len               3
+#define gattdb_acceleration_batch_len         246
 
 
 #endif // __GATT_DB_H
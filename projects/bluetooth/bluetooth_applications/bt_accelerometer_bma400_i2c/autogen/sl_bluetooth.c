@@ -28,15 +28,52 @@
  *
  ******************************************************************************/
 
+#include <string.h>
 #include <sl_common.h>
 #include "sl_bluetooth.h"
 #include "sl_assert.h"
 #include "sl_bt_stack_init.h"
 #include "sl_component_catalog.h"
+#include "sl_sleeptimer.h"
+#include "sl_main_profiler.h"
 #include "sl_gatt_service_device_information_override.h"
+#if defined(SL_CATALOG_BLUETOOTH_EVENT_TRACE_PRESENT)
+#include "sl_bt_event_trace.h"
+#endif
+
+// Adds a route to the component event route table
+#define EVENT_ROUTE(event_id, handler)  { (event_id), (handler) },
+
+// Event routes registered by the components, in component order
+static const sli_bt_event_route_t component_event_routes[] = {
+  SL_GATT_SERVICE_DEVICE_INFORMATION_OVERRIDE_EVENT_ROUTES(EVENT_ROUTE)
+};
+
+#define EVENT_ROUTE_COUNT  (sizeof(component_event_routes) / sizeof(component_event_routes[0]))
+
+// Component event routes sorted by event ID, set up by sl_bt_init()
+static sli_bt_event_route_t event_routes[EVENT_ROUTE_COUNT];
+
+// Sorts the component event routes by event ID. The insertion sort keeps the
+// handlers of an event ID in component order.
+static void init_event_routes(void)
+{
+  for (size_t i = 0; i < EVENT_ROUTE_COUNT; i++) {
+    sli_bt_event_route_t route = component_event_routes[i];
+    size_t j = i;
+
+    while ((j > 0) && (event_routes[j - 1].event_id > route.event_id)) {
+      event_routes[j] = event_routes[j - 1];
+      j--;
+    }
+    event_routes[j] = route;
+  }
+}
 
 void sl_bt_init(void)
 {
+  init_event_routes();
+
   // Stack initialization could fail, e.g., due to out of memory.
   // The failure could not be returned to user as the system initialization
   // does not return an error code. Use the EFM_ASSERT to catch the failure,
@@ -50,10 +87,42 @@ SL_WEAK void sl_bt_on_event(sl_bt_msg_t* evt)
   (void)(evt);
 }
 
+const sli_bt_event_route_t *sli_bt_get_event_routes(size_t *count)
+{
+  *count = EVENT_ROUTE_COUNT;
+  return event_routes;
+}
+
+void sli_bt_process_component_event(sl_bt_msg_t *evt)
+{
+  uint32_t event_id = SL_BT_MSG_ID(evt->header);
+  const sli_bt_event_route_t *route = event_routes;
+  size_t count = EVENT_ROUTE_COUNT;
+
+  // Find the first route of the event ID, so that only the components
+  // registered for this event are called. The search halves the range without
+  // branching on the comparison, which the event mix makes unpredictable.
+  while (count > 1) {
+    size_t half = count / 2;
+    route = (route[half - 1].event_id < event_id) ? &route[half] : route;
+    count -= half;
+  }
+  for (; (route < &event_routes[EVENT_ROUTE_COUNT]) && (route->event_id <= event_id); route++) {
+    if (route->event_id == event_id) {
+      route->handler(evt);
+    }
+  }
+}
+
 void sl_bt_process_event(sl_bt_msg_t *evt)
 {
-  sl_gatt_service_device_information_override_on_event(evt);
-  sl_bt_on_event(evt);
+#if defined(SL_CATALOG_BLUETOOTH_EVENT_TRACE_PRESENT)
+  sl_bt_event_trace_on_event(evt);
+#endif
+
+  SL_MAIN_PROFILER_SECTION(SL_MAIN_PROFILER_PROBE_BT_COMPONENTS, sli_bt_process_component_event(evt); )
+
+  SL_MAIN_PROFILER_SECTION(SL_MAIN_PROFILER_PROBE_BT_APP, sl_bt_on_event(evt); )
 }
 
 #if !defined(SL_CATALOG_KERNEL_PRESENT)
@@ -66,23 +135,91 @@ SL_WEAK bool sl_bt_can_process_event(uint32_t len)
   return true;
 }
 
+static sl_bt_step_stats_t step_stats;
+
+// Tells if sl_bt_step() has used up its event count or time budget.
+// At least one event is processed per step.
+static bool is_step_budget_exhausted(uint32_t event_count, uint32_t start_tick)
+{
+  if (event_count >= SL_BT_CONFIG_MAX_EVENTS_PER_STEP) {
+    return true;
+  }
+#if (SL_BT_CONFIG_STEP_TIME_BUDGET_US > 0)
+  static uint32_t budget_ticks = 0;
+  if (budget_ticks == 0) {
+    uint64_t ticks = ((uint64_t)SL_BT_CONFIG_STEP_TIME_BUDGET_US
+                      * sl_sleeptimer_get_timer_frequency()
+                      + 999999u) / 1000000u;
+    budget_ticks = (ticks > UINT32_MAX) ? UINT32_MAX : (uint32_t)ticks;
+  }
+  if ((event_count > 0)
+      && ((sl_sleeptimer_get_tick_count() - start_tick) >= budget_ticks)) {
+    return true;
+  }
+#else
+  (void)start_tick;
+#endif
+  return false;
+}
+
 void sl_bt_step(void)
 {
   sl_bt_msg_t evt;
+  uint32_t event_count = 0;
+  bool is_event_left = false;
+#if (SL_BT_CONFIG_STEP_TIME_BUDGET_US > 0)
+  uint32_t start_tick = sl_sleeptimer_get_tick_count();
+#else
+  uint32_t start_tick = 0;
+#endif
 
   sl_bt_run();
-  uint32_t event_len = sl_bt_event_pending_len();
-  // For preventing from data loss, the event will be kept in the stack's queue
-  // if application cannot process it at the moment.
-  if ((event_len == 0) || (!sl_bt_can_process_event(event_len))) {
-    return;
+  while (true) {
+    uint32_t event_len = sl_bt_event_pending_len();
+    if (event_len == 0) {
+      break;
+    }
+    // The step budget is checked before popping, so that the event is left in
+    // the stack's queue for the next step.
+    if (is_step_budget_exhausted(event_count, start_tick)) {
+      step_stats.budget_exhausted_count++;
+      is_event_left = true;
+      break;
+    }
+    // For preventing from data loss, the event will be kept in the stack's queue
+    // if application cannot process it at the moment.
+    if (!sl_bt_can_process_event(event_len)) {
+      step_stats.backpressure_count++;
+      is_event_left = true;
+      break;
+    }
+
+    // Pop (non-blocking) a Bluetooth stack event from event queue.
+    sl_status_t status = sl_bt_pop_event(&evt);
+    if (status != SL_STATUS_OK) {
+      break;
+    }
+    sl_bt_process_event(&evt);
+    event_count++;
   }
 
-  // Pop (non-blocking) a Bluetooth stack event from event queue.
-  sl_status_t status = sl_bt_pop_event(&evt);
-  if(status != SL_STATUS_OK){
-    return;
+  if (event_count > step_stats.max_events_per_step) {
+    step_stats.max_events_per_step = event_count;
+  }
+  uint32_t queue_depth = event_count + (is_event_left ? 1u : 0u);
+  if (queue_depth > step_stats.max_queue_depth) {
+    step_stats.max_queue_depth = queue_depth;
   }
-  sl_bt_process_event(&evt);
+}
+
+void sl_bt_get_step_stats(sl_bt_step_stats_t *stats)
+{
+  EFM_ASSERT(stats != NULL);
+  *stats = step_stats;
+}
+
+void sl_bt_reset_step_stats(void)
+{
+  memset(&step_stats, 0, sizeof(step_stats));
 }
 #endif // !defined(SL_CATALOG_KERNEL_PRESENT)
@@ -43,9 +43,32 @@
 // Initialize Bluetooth core functionality
 void sl_bt_init(void);
 
-// Polls bluetooth stack for an event and processes it
+// Statistics of the event processing done by sl_bt_step()
+typedef struct {
+  uint32_t max_events_per_step;    ///< Max number of events processed in one step
+  uint32_t max_queue_depth;        ///< Max number of events seen pending in one step
+  uint32_t budget_exhausted_count; ///< Steps that left events pending due to the budget
+  uint32_t backpressure_count;     ///< Steps that left events pending due to sl_bt_can_process_event
+} sl_bt_step_stats_t;
+
+// Polls bluetooth stack for events and processes up to
+// SL_BT_CONFIG_MAX_EVENTS_PER_STEP of them
 void sl_bt_step(void);
 
+/**
+ * Get the statistics of the event processing done by sl_bt_step().
+ *
+ * @note The stack does not expose the number of queued events. The queue
+ * depth is the number of events processed in a step, plus one if an event was
+ * left pending, which is a lower bound of the actual depth.
+ *
+ * @param[out] stats Statistics
+ */
+void sl_bt_get_step_stats(sl_bt_step_stats_t *stats);
+
+// Resets the statistics of the event processing done by sl_bt_step()
+void sl_bt_reset_step_stats(void);
+
 /**
  * Tell if the application can process a new Bluetooth event in its current
  * state, for example, based on resource availability status.
@@ -64,6 +87,21 @@ bool sl_bt_can_process_event(uint32_t len);
 // Processes a single bluetooth event
 void sl_bt_process_event(sl_bt_msg_t *evt);
 
+// Bluetooth event handler of a component
+typedef void (*sli_bt_event_handler_t)(sl_bt_msg_t *evt);
+
+// Routes an event ID to a component handler registered for it
+typedef struct {
+  uint32_t event_id;
+  sli_bt_event_handler_t handler;
+} sli_bt_event_route_t;
+
+// Gets the event routes of the components, sorted by event ID
+const sli_bt_event_route_t *sli_bt_get_event_routes(size_t *count);
+
+// Passes a single bluetooth event to the components registered for it
+void sli_bt_process_component_event(sl_bt_msg_t *evt);
+
 void sl_bt_on_event(sl_bt_msg_t* evt);
 
 // Power Manager related functions
@@ -10,6 +10,7 @@
 #define SL_CATALOG_BGAPI_PROTOCOL_PRESENT
 #define SL_CATALOG_BLUETOOTH_CONFIGURATION_PRESENT
 #define SL_CATALOG_BLUETOOTH_CTE_SUPPORT_PRESENT
+#define SL_CATALOG_BLUETOOTH_EVENT_TRACE_PRESENT
 #define SL_CATALOG_BLUETOOTH_FEATURE_ADVERTISER_PRESENT
 #define SL_CATALOG_BLUETOOTH_FEATURE_BUILTIN_BONDING_DATABASE_PRESENT
 #define SL_CATALOG_BLUETOOTH_FEATURE_CONNECTION_PRESENT
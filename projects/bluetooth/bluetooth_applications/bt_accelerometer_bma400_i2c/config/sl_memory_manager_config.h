@@ -47,6 +47,77 @@
 // <i> Default: 1
 #define SL_MEMORY_MANAGER_STATISTICS_API_ENABLE  1
 
+// <q SL_MEMORY_MANAGER_SEGREGATED_FREE_LISTS_ENABLE> Enables segregated free lists.
+// <i> Indexes free blocks in size-class bins with a two-level bitmap so that block allocation
+// <i> and free run in bounded time instead of walking the heap (first-fit).
+// <i> Long-term blocks are still carved from the start and short-term blocks from the end of the
+// <i> selected free block, but the block is chosen by size class (good-fit) and not by address.
+// <i> Not supported together with RAM bank retention control.
+// <i> Default: 0
+#define SL_MEMORY_MANAGER_SEGREGATED_FREE_LISTS_ENABLE  0
+
+// <q SL_MEMORY_MANAGER_LOCK_FREE_POOLS_ENABLE> Enables lock-free memory pools.
+// <i> Memory pool allocation and free update the free list with a compare-and-swap on a tagged
+// <i> head instead of masking interrupts, so pools can be used from interrupts of any priority.
+// <i> Requires a CPU with exclusive load/store instructions (LDREX/STREX), and limits pools to
+// <i> 65534 blocks.
+// <i> Default: 0
+#define SL_MEMORY_MANAGER_LOCK_FREE_POOLS_ENABLE  0
+
+// <e SL_MEMORY_MANAGER_SIZE_CLASS_POOLS_ENABLE> Enables size-class pools for small sl_malloc() requests.
+// <i> sl_malloc() and sl_calloc() requests of up to 64 bytes are served from memory pools of
+// <i> 16, 32, 48 and 64 bytes blocks, created from the heap the first time a size is requested.
+// <i> When a size-class pool is exhausted, the request falls back to the general heap.
+// <i> sl_free() and sl_realloc() find the owning pool with address-range checks.
+// <i> Default: 0
+#define SL_MEMORY_MANAGER_SIZE_CLASS_POOLS_ENABLE  0
+
+// <o SL_MEMORY_MANAGER_SIZE_CLASS_POOL_BLOCK_COUNT> Number of blocks in each size-class pool <1-1024>
+// <i> Default: 16
+#define SL_MEMORY_MANAGER_SIZE_CLASS_POOL_BLOCK_COUNT  16
+// </e>
+
+// <o SL_MEMORY_MANAGER_HEAP_CHECK_SLEEP_BLOCK_COUNT> Number of heap blocks checked before sleeping <0-256>
+// <i> Number of heap blocks whose metadata is checked by sl_memory_check_heap_integrity_step()
+// <i> each time the Power Manager is about to put the system to sleep. The check runs with
+// <i> interrupts disabled, so keep this number small. 0 disables the check before sleeping.
+// <i> Default: 0
+#define SL_MEMORY_MANAGER_HEAP_CHECK_SLEEP_BLOCK_COUNT  0
+
+// <o SL_MEMORY_MANAGER_HEAP_CHECK_OWNER_COUNT> Number of heap block owners recorded for the integrity check <0-1024>
+// <i> When the Memory Profiler is used, the return address of the code that allocated each heap block
+// <i> is recorded in a table of this many entries, and reported with a corrupted block. A block may
+// <i> evict the entry of an older one, its owner is then reported as unknown. Each entry takes 8 bytes.
+// <i> 0 disables the recording.
+// <i> Default: 64
+#define SL_MEMORY_MANAGER_HEAP_CHECK_OWNER_COUNT  64
+
+// <q SL_MEMORY_MANAGER_RAM_RETENTION_SHRINK_ENABLE> Enables automatic RAM retention shrinking.
+// <i> Each time the device enters EM2, the RAM banks at the end of the heap that hold no allocated
+// <i> block, no block metadata and no reserved block are not retained, which lowers the sleep
+// <i> current. Their content is lost in EM2. The heap is walked again only if blocks were allocated,
+// <i> freed or reserved since the previous sleep. Requires the Power Manager and a call to
+// <i> sl_memory_ram_retention_init(). Not supported together with RAM bank retention control.
+// <i> Default: 0
+#define SL_MEMORY_MANAGER_RAM_RETENTION_SHRINK_ENABLE  0
+
+// <e SL_MEMORY_MANAGER_TRACE_RECORDER_ENABLE> Enables the allocation trace recorder.
+// <i> Records heap allocation, reallocation, free and ownership events as compact binary
+// <i> records in a RAM ring buffer. The application drains the buffer to an I/O stream with
+// <i> sli_memory_profiler_trace_drain() so that the trace can be replayed offline.
+// <i> The recorder is implemented behind the Memory Profiler stubs and is not available when
+// <i> the Memory Profiler component is included.
+// <i> Default: 0
+#define SL_MEMORY_MANAGER_TRACE_RECORDER_ENABLE  0
+
+// <o SL_MEMORY_MANAGER_TRACE_RECORDER_RECORD_COUNT> Number of records in the trace ring buffer
+// <16-4096:1>
+// <i> Each record takes 20 bytes of RAM. Events are dropped and counted while the buffer is full.
+// <i> Default: 128
+#define SL_MEMORY_MANAGER_TRACE_RECORDER_RECORD_COUNT  128
+
+// </e>
+
 // </h>
 
 // <<< end of configuration section >>>
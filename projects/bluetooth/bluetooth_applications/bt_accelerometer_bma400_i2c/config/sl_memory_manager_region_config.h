@@ -44,6 +44,26 @@
 #ifndef SL_STACK_SIZE
 #define SL_STACK_SIZE 2752
 #endif
+
+// <q SL_STACK_HIGH_WATERMARK_ENABLE> Enable stack high watermark measurement
+// <i> Default: 0
+// <i> Paints the unused stack at startup so that
+// <i> sl_memory_get_stack_high_watermark() reports the peak stack usage.
+// <i> Use it to reduce the stack size safely: the RAM removed from the
+// <i> stack is given to the heap.
+#ifndef SL_STACK_HIGH_WATERMARK_ENABLE
+#define SL_STACK_HIGH_WATERMARK_ENABLE 0
+#endif
+
+// <o SL_STACK_GUARD_SIZE> Stack guard size in bytes <0-256:32>
+// <i> Default: 0
+// <i> When not 0, the lowest bytes of the stack are made read-only with the
+// <i> MPU, so that a stack overflow triggers a MemManage fault. Must be a
+// <i> multiple of 32. The guard is taken from the stack size. Requires the
+// <i> MPU component.
+#ifndef SL_STACK_GUARD_SIZE
+#define SL_STACK_GUARD_SIZE 0
+#endif
 // </h>
 
 // <<< end of configuration section >>>
@@ -41,6 +41,7 @@
 #define SL_SLEEPTIMER_PERIPHERAL_BURTC   5
 #define SL_SLEEPTIMER_PERIPHERAL_WTIMER  6
 #define SL_SLEEPTIMER_PERIPHERAL_TIMER   7
+#define SL_SLEEPTIMER_PERIPHERAL_HOST    8
 
 // <o SL_SLEEPTIMER_PERIPHERAL> Timer Peripheral Used by Sleeptimer
 //   <SL_SLEEPTIMER_PERIPHERAL_DEFAULT=> Default (auto select)
@@ -51,6 +52,7 @@
 //   <SL_SLEEPTIMER_PERIPHERAL_BURTC=> Back-Up RTC (BURTC)
 //   <SL_SLEEPTIMER_PERIPHERAL_WTIMER=> WTIMER
 //   <SL_SLEEPTIMER_PERIPHERAL_TIMER=> TIMER
+//   <SL_SLEEPTIMER_PERIPHERAL_HOST=> Virtual clock (host simulation)
 // <i> Selection of the Timer Peripheral Used by the Sleeptimer
 #define SL_SLEEPTIMER_PERIPHERAL  SL_SLEEPTIMER_PERIPHERAL_DEFAULT
 
@@ -77,6 +79,28 @@
 // <i> Default: 0
 #define SL_SLEEPTIMER_DEBUGRUN  0
 
+#define SL_SLEEPTIMER_TIMER_QUEUE_DELTA_LIST 0
+#define SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP   1
+
+// <o SL_SLEEPTIMER_TIMER_QUEUE> Timer queue
+//   <SL_SLEEPTIMER_TIMER_QUEUE_DELTA_LIST=> Sorted delta list
+//   <SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP=> Binary min-heap
+// <i> The delta list needs no memory, but starting, stopping and querying a timer
+// <i> take a time proportional to the number of running timers, with interrupts masked.
+// <i> The min-heap takes a time proportional to the logarithm of the number of running timers.
+// <i> Default: SL_SLEEPTIMER_TIMER_QUEUE_DELTA_LIST
+#define SL_SLEEPTIMER_TIMER_QUEUE  SL_SLEEPTIMER_TIMER_QUEUE_DELTA_LIST
+
+// <o SL_SLEEPTIMER_TIMER_HEAP_SIZE> Number of running timers kept in the min-heap <1-1024>
+// <i> Timers started while the heap is full are kept in a delta list.
+// <i> Default: 32
+#define SL_SLEEPTIMER_TIMER_HEAP_SIZE  32
+
+// <o SL_SLEEPTIMER_SLACK_TIMER_COUNT> Maximum number of running timers with a slack <1-255>
+// <i> Starting more timers with a non-zero slack returns SL_STATUS_NO_MORE_RESOURCE.
+// <i> Default: 4
+#define SL_SLEEPTIMER_SLACK_TIMER_COUNT  4
+
 #endif /* SLEEPTIMER_CONFIG_H */
 
 // <<< end of configuration section >>>
@@ -15,6 +15,7 @@
  *
  ******************************************************************************/
 #include "sl_component_catalog.h"
+#include "sl_main_profiler.h"
 #include "sl_system_init.h"
 #include "app.h"
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
@@ -47,7 +48,7 @@ int main(void)
     sl_system_process_action();
 
     // Application process.
-    app_process_action();
+    SL_MAIN_PROFILER_SECTION(SL_MAIN_PROFILER_PROBE_APP, app_process_action(); )
 
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
     // Let the CPU go to sleep if the system allows it.
@@ -0,0 +1,55 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the application log, for the event trace runner
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef APP_LOG_H
+#define APP_LOG_H
+
+#include "sl_status.h"
+
+#define APP_LOG_NL  "\n"
+
+// Prints the application logs when the runner is verbose, see
+// sl_bt_event_trace_host_stubs.c.
+void sl_bt_event_trace_host_log(const char *format, ...);
+
+#define app_log(...)          sl_bt_event_trace_host_log(__VA_ARGS__)
+#define app_log_debug(...)    sl_bt_event_trace_host_log(__VA_ARGS__)
+#define app_log_info(...)     sl_bt_event_trace_host_log(__VA_ARGS__)
+#define app_log_warning(...)  sl_bt_event_trace_host_log(__VA_ARGS__)
+#define app_log_error(...)    sl_bt_event_trace_host_log(__VA_ARGS__)
+
+#define app_log_status_error(sc)                                                  \
+  do {                                                                            \
+    if ((sc) != SL_STATUS_OK) {                                                   \
+      sl_bt_event_trace_host_log("[E: 0x%04x] Status" APP_LOG_NL, (int)(sc));     \
+    }                                                                             \
+  } while (0)
+
+#endif // APP_LOG_H
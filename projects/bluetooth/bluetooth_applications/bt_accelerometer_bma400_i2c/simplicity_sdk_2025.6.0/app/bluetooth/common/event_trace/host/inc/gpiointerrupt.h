@@ -0,0 +1,67 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the GPIO interrupt dispatcher and the GPIO API
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef GPIOINTERRUPT_H
+#define GPIOINTERRUPT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The runner has no GPIO interrupts: the events they raise on the target are
+// in the trace.
+
+typedef enum {
+  SL_GPIO_PORT_A,
+  SL_GPIO_PORT_B,
+  SL_GPIO_PORT_C,
+  SL_GPIO_PORT_D,
+} sl_gpio_port_t;
+
+typedef enum {
+  gpioModeDisabled,
+  gpioModeInput,
+  gpioModeInputPull,
+  gpioModeInputPullFilter,
+  gpioModePushPull,
+} GPIO_Mode_TypeDef;
+
+typedef void (*GPIOINT_IrqCallbackPtr_t)(uint8_t intNo);
+
+void GPIOINT_CallbackRegister(uint8_t intNo, GPIOINT_IrqCallbackPtr_t callbackPtr);
+void GPIO_PinModeSet(sl_gpio_port_t port, unsigned int pin, GPIO_Mode_TypeDef mode, unsigned int out);
+void GPIO_ExtIntConfig(sl_gpio_port_t port,
+                       unsigned int pin,
+                       unsigned int intNo,
+                       bool risingEdge,
+                       bool fallingEdge,
+                       bool enable);
+void GPIO_IntEnable(uint32_t flags);
+
+#endif // GPIOINTERRUPT_H
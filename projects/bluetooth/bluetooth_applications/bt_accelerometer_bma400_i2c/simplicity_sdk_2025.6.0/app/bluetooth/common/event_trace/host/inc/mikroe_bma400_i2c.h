@@ -0,0 +1,48 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the BMA400 I2C driver
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef MIKROE_BMA400_I2C_H_
+#define MIKROE_BMA400_I2C_H_
+
+#include <stdint.h>
+// Included through the driver headers on the target
+#include <stdlib.h>
+#include "sl_i2cspm_instances.h"
+#include "bma400.h"
+#include "mikroe_bma400_i2c_config.h"
+
+typedef sl_i2cspm_t *mikroe_i2c_handle_t;
+
+// The BMA400 functions are simulated by sl_bt_event_trace_host_bma400.c.
+int8_t bma400_i2c_init(mikroe_i2c_handle_t i2cspm,
+                       uint8_t bma400_i2c_addr,
+                       struct bma400_dev *bma400);
+
+#endif // MIKROE_BMA400_I2C_H_
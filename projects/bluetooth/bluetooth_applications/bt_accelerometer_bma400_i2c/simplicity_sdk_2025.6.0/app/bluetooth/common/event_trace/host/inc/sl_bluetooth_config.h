@@ -0,0 +1,46 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the Bluetooth configuration
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_BLUETOOTH_CONFIG_H
+#define SL_BLUETOOTH_CONFIG_H
+
+// The stack configuration of the application is not used on the host. Only
+// the event processing settings of sl_bt_step() are, at their defaults.
+#include "sl_component_catalog.h"
+
+#ifndef SL_BT_CONFIG_MAX_EVENTS_PER_STEP
+#define SL_BT_CONFIG_MAX_EVENTS_PER_STEP     (1)
+#endif
+
+#ifndef SL_BT_CONFIG_STEP_TIME_BUDGET_US
+#define SL_BT_CONFIG_STEP_TIME_BUDGET_US     (0)
+#endif
+
+#endif // SL_BLUETOOTH_CONFIG_H
@@ -0,0 +1,50 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the simple LED instances
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_SIMPLE_LED_INSTANCES_H
+#define SL_SIMPLE_LED_INSTANCES_H
+
+#include <stdint.h>
+
+// LED simulated by sl_bt_event_trace_host_stubs.c
+typedef struct {
+  uint8_t instance;
+} sl_led_t;
+
+extern const sl_led_t *sl_simple_led_array[];
+
+#define SL_SIMPLE_LED_COUNT 1
+#define SL_SIMPLE_LED_INSTANCE(n) (sl_simple_led_array[n])
+
+void sl_led_turn_on(const sl_led_t *led_handle);
+void sl_led_turn_off(const sl_led_t *led_handle);
+void sl_led_toggle(const sl_led_t *led_handle);
+
+#endif // SL_SIMPLE_LED_INSTANCES_H
@@ -0,0 +1,657 @@
+/***************************************************************************//**
+ * @file
+ * @brief Replays Bluetooth event traces into an application on the host
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Runs the Bluetooth event handlers of an application on Linux, against
+ * stubbed Bluetooth commands and peripherals, and replays a trace recorded by
+ * the event_trace component into them through sl_bt_process_event(), which
+ * passes each event to the components registered for it and to
+ * sl_bt_on_event(). The sleeptimer runs on the virtual clock of its host HAL,
+ * which is advanced to the timestamp of each event, so the application timers
+ * expire between the events as they did on the target. app_process_action()
+ * is called after each event, as by the main loop.
+ *
+ * Usage: sl_bt_event_trace_host [options] [trace_file]
+ *   -g <seconds>  Generate a synthetic connection of this duration instead of
+ *                 reading a trace: boot, connection, ATT MTU exchange,
+ *                 notifications enabled, then external signals and, for
+ *                 applications with a LED control characteristic, writes to
+ *                 it, until the connection closes.
+ *   -r <hz>       Rate of the external signals of the synthetic trace.
+ *                 Default: 25, the data ready rate of the BMA400 example.
+ *   -m <mtu>      ATT MTU of the synthetic connection. Default: 247.
+ *   -o <file>     Write the synthetic trace, in the recorder format.
+ *   -f <n>        Make every n-th notification fail with
+ *                 SL_STATUS_NO_MORE_RESOURCE.
+ *   -b <n>        Benchmark the dispatch of the replayed events to the
+ *                 component handlers, n times over: through the event route
+ *                 table of sl_bt_process_event(), then by calling every
+ *                 component handler for each event.
+ *   -v            Print the application logs.
+ *
+ * Prints, per event ID, the number of events, the handler latency and the
+ * Bluetooth commands called by the handler, then the calls of each command.
+ * The cost of a command is the number of value bytes it passes to or gets
+ * from the stack. The commands called from the timer callbacks and from
+ * app_process_action() are counted apart. The handler latency is measured on
+ * the host; it compares application revisions, not target timings. The
+ * benchmark runs after the report, as the component handlers call commands.
+ ******************************************************************************/
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sl_bluetooth.h"
+#include "sl_sleeptimer.h"
+#include "sl_sleeptimer_host.h"
+#include "sl_bt_event_trace.h"
+#include "sl_main_profiler.h"
+#include "gatt_db.h"
+#include "app.h"
+#include "sl_bt_event_trace_host.h"
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+#define HOST_EVENT_ID_COUNT_MAX        64u
+
+#define HOST_SYNTHETIC_RATE_DEFAULT    25u
+#define HOST_SYNTHETIC_MTU_DEFAULT     247u
+#define HOST_SYNTHETIC_CONNECTION      1u
+// Size of a synthetic event record, larger than any of the generated events
+#define HOST_SYNTHETIC_RECORD_SIZE     32u
+
+// Characteristic of which the synthetic connection enables the notifications
+#if defined(gattdb_acceleration_batch)
+#define HOST_NOTIFIED_CHARACTERISTIC   gattdb_acceleration_batch
+#elif defined(gattdb_acceleration)
+#define HOST_NOTIFIED_CHARACTERISTIC   gattdb_acceleration
+#elif defined(gattdb_report_button)
+#define HOST_NOTIFIED_CHARACTERISTIC   gattdb_report_button
+#endif
+
+/*******************************************************************************
+ ********************************   DATA TYPES   *******************************
+ ******************************************************************************/
+
+// Handler statistics of an event ID
+typedef struct {
+  uint32_t event_id;
+  uint32_t count;
+  uint64_t latency_total_ns;
+  uint64_t latency_max_ns;
+  uint64_t cmd_call_count;
+} host_event_stats_t;
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+static const struct {
+  uint32_t event_id;
+  const char *name;
+} host_event_names[] = {
+  { sl_bt_evt_system_boot_id, "system_boot" },
+  { sl_bt_evt_system_external_signal_id, "system_external_signal" },
+  { sl_bt_evt_system_soft_timer_id, "system_soft_timer" },
+  { sl_bt_evt_connection_opened_id, "connection_opened" },
+  { sl_bt_evt_connection_parameters_id, "connection_parameters" },
+  { sl_bt_evt_connection_phy_status_id, "connection_phy_status" },
+  { sl_bt_evt_connection_closed_id, "connection_closed" },
+  { sl_bt_evt_gatt_mtu_exchanged_id, "gatt_mtu_exchanged" },
+  { sl_bt_evt_gatt_server_attribute_value_id, "gatt_server_attribute_value" },
+  { sl_bt_evt_gatt_server_user_read_request_id, "gatt_server_user_read_request" },
+  { sl_bt_evt_gatt_server_user_write_request_id, "gatt_server_user_write_request" },
+  { sl_bt_evt_gatt_server_characteristic_status_id, "gatt_server_characteristic_status" },
+};
+
+static host_event_stats_t host_event_stats[HOST_EVENT_ID_COUNT_MAX];
+static uint32_t host_event_id_count;
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Returns a monotonic timestamp in nanoseconds.
+ ******************************************************************************/
+static uint64_t host_time_ns(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/***************************************************************************//**
+ * Gets the statistics of an event ID.
+ ******************************************************************************/
+static host_event_stats_t *host_get_event_stats(uint32_t event_id)
+{
+  for (uint32_t i = 0; i < host_event_id_count; i++) {
+    if (host_event_stats[i].event_id == event_id) {
+      return &host_event_stats[i];
+    }
+  }
+  if (host_event_id_count == HOST_EVENT_ID_COUNT_MAX) {
+    fprintf(stderr, "FAIL: more than %u event IDs\n", HOST_EVENT_ID_COUNT_MAX);
+    exit(EXIT_FAILURE);
+  }
+  host_event_stats[host_event_id_count].event_id = event_id;
+
+  return &host_event_stats[host_event_id_count++];
+}
+
+/***************************************************************************//**
+ * Prints the name of an event ID, padded to a column.
+ ******************************************************************************/
+static void host_print_event_name(uint32_t event_id)
+{
+  for (size_t i = 0; i < sizeof(host_event_names) / sizeof(host_event_names[0]); i++) {
+    if (host_event_names[i].event_id == event_id) {
+      printf("%-34s", host_event_names[i].name);
+      return;
+    }
+  }
+  printf("0x%08" PRIx32 "%24s", event_id, "");
+}
+
+/***************************************************************************//**
+ * Records an event of the synthetic trace, the clock being advanced to its
+ * time first.
+ ******************************************************************************/
+static void host_record_event(uint64_t *now_us,
+                              uint64_t time_us,
+                              sl_bt_msg_t *evt,
+                              uint32_t event_id,
+                              size_t len)
+{
+  uint32_t freq = sl_sleeptimer_get_timer_frequency();
+
+  sl_sleeptimer_host_advance(((time_us * freq) / 1000000u) - ((*now_us * freq) / 1000000u));
+  *now_us = time_us;
+  evt->header = event_id | (((uint32_t)len & 0xffu) << 8) | (((uint32_t)len >> 8) & 0x7u);
+  sl_bt_event_trace_on_event(evt);
+}
+
+/***************************************************************************//**
+ * Generates a synthetic connection trace.
+ *
+ * @return Trace size, in bytes, 0 if the trace does not fit in the buffer.
+ ******************************************************************************/
+static size_t host_generate(uint8_t *buffer,
+                            size_t size,
+                            uint32_t seconds,
+                            uint32_t signal_rate_hz,
+                            uint16_t mtu)
+{
+  sl_bt_msg_t evt;
+  uint64_t now_us = 0u;
+  uint64_t end_us = (uint64_t)(seconds + 1u) * 1000000u;
+  uint64_t signal_period_us = 1000000u / signal_rate_hz;
+  // The signals are half a period after the data ready of a sensor started
+  // with the application, which keeps them off the sample boundaries.
+  uint64_t signal_us = 1000000u + (signal_period_us / 2u);
+  uint64_t write_us = 1000000u;
+  size_t trace_size;
+
+  if (sl_bt_event_trace_start(buffer, size) != SL_STATUS_OK) {
+    return 0u;
+  }
+
+  memset(&evt, 0, sizeof(evt));
+  host_record_event(&now_us, 0u, &evt, sl_bt_evt_system_boot_id, sizeof(evt.data.evt_system_boot));
+
+  memset(&evt, 0, sizeof(evt));
+  evt.data.evt_connection_opened.connection = HOST_SYNTHETIC_CONNECTION;
+  host_record_event(&now_us, 500000u, &evt, sl_bt_evt_connection_opened_id, sizeof(evt.data.evt_connection_opened));
+
+  memset(&evt, 0, sizeof(evt));
+  evt.data.evt_gatt_mtu_exchanged.connection = HOST_SYNTHETIC_CONNECTION;
+  evt.data.evt_gatt_mtu_exchanged.mtu = mtu;
+  host_record_event(&now_us, 600000u, &evt, sl_bt_evt_gatt_mtu_exchanged_id, sizeof(evt.data.evt_gatt_mtu_exchanged));
+
+#if defined(HOST_NOTIFIED_CHARACTERISTIC)
+  memset(&evt, 0, sizeof(evt));
+  evt.data.evt_gatt_server_characteristic_status.connection = HOST_SYNTHETIC_CONNECTION;
+  evt.data.evt_gatt_server_characteristic_status.characteristic = HOST_NOTIFIED_CHARACTERISTIC;
+  evt.data.evt_gatt_server_characteristic_status.status_flags = sl_bt_gatt_server_client_config;
+  evt.data.evt_gatt_server_characteristic_status.client_config_flags = sl_bt_gatt_notification;
+  host_record_event(&now_us,
+                    700000u,
+                    &evt,
+                    sl_bt_evt_gatt_server_characteristic_status_id,
+                    sizeof(evt.data.evt_gatt_server_characteristic_status));
+#endif
+
+  while ((signal_us < end_us) || (write_us < end_us)) {
+    memset(&evt, 0, sizeof(evt));
+    if (signal_us <= write_us) {
+      evt.data.evt_system_external_signal.extsignals = 1u;
+      host_record_event(&now_us,
+                        signal_us,
+                        &evt,
+                        sl_bt_evt_system_external_signal_id,
+                        sizeof(evt.data.evt_system_external_signal));
+      signal_us += signal_period_us;
+    } else {
+#if defined(gattdb_led_control)
+      // The LED is switched every second.
+      evt.data.evt_gatt_server_attribute_value.connection = HOST_SYNTHETIC_CONNECTION;
+      evt.data.evt_gatt_server_attribute_value.attribute = gattdb_led_control;
+      evt.data.evt_gatt_server_attribute_value.att_opcode = sl_bt_gatt_write_request;
+      evt.data.evt_gatt_server_attribute_value.value.len = 1u;
+      evt.data.evt_gatt_server_attribute_value.value.data[0] = (uint8_t)((write_us / 1000000u) & 1u);
+      host_record_event(&now_us,
+                        write_us,
+                        &evt,
+                        sl_bt_evt_gatt_server_attribute_value_id,
+                        sizeof(evt.data.evt_gatt_server_attribute_value) + 1u);
+#endif
+      write_us += 1000000u;
+    }
+  }
+
+#if defined(gattdb_main_loop_profile)
+  // The client reads the main loop profile before it disconnects, with read
+  // blob requests for the rest of a value longer than the ATT MTU allows.
+  for (uint16_t offset = 0; offset < (SL_MAIN_PROFILER_PROBE_COUNT * SL_MAIN_PROFILER_SUMMARY_SIZE); offset += mtu - 1u) {
+    memset(&evt, 0, sizeof(evt));
+    evt.data.evt_gatt_server_user_read_request.connection = HOST_SYNTHETIC_CONNECTION;
+    evt.data.evt_gatt_server_user_read_request.characteristic = gattdb_main_loop_profile;
+    evt.data.evt_gatt_server_user_read_request.att_opcode = (offset == 0u) ? sl_bt_gatt_read_request : sl_bt_gatt_read_blob_request;
+    evt.data.evt_gatt_server_user_read_request.offset = offset;
+    host_record_event(&now_us,
+                      end_us,
+                      &evt,
+                      sl_bt_evt_gatt_server_user_read_request_id,
+                      sizeof(evt.data.evt_gatt_server_user_read_request));
+  }
+#endif
+
+  memset(&evt, 0, sizeof(evt));
+  evt.data.evt_connection_closed.reason = SL_STATUS_BT_CTRL_REMOTE_USER_TERMINATED;
+  evt.data.evt_connection_closed.connection = HOST_SYNTHETIC_CONNECTION;
+  host_record_event(&now_us, end_us, &evt, sl_bt_evt_connection_closed_id, sizeof(evt.data.evt_connection_closed));
+
+  // The application keeps advertising after the connection closed.
+  sl_sleeptimer_host_advance(sl_sleeptimer_get_timer_frequency());
+
+  trace_size = sl_bt_event_trace_stop();
+  if (sl_bt_event_trace_get_dropped_count() != 0u) {
+    return 0u;
+  }
+
+  return trace_size;
+}
+
+/***************************************************************************//**
+ * Reads a trace file.
+ *
+ * @return Trace, 4-byte aligned, NULL on error.
+ ******************************************************************************/
+static uint8_t *host_read_trace(const char *path, size_t *size)
+{
+  FILE *file = fopen(path, "rb");
+  uint8_t *trace;
+  long file_size;
+
+  if (file == NULL) {
+    perror(path);
+    return NULL;
+  }
+  fseek(file, 0, SEEK_END);
+  file_size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  trace = aligned_alloc(4u, ((size_t)file_size + 3u) & ~(size_t)3u);
+  if ((trace == NULL) || (fread(trace, 1u, (size_t)file_size, file) != (size_t)file_size)) {
+    fprintf(stderr, "%s: cannot read the trace\n", path);
+    free(trace);
+    trace = NULL;
+  }
+  fclose(file);
+  *size = (size_t)file_size;
+
+  return trace;
+}
+
+/***************************************************************************//**
+ * Replays a trace into the application.
+ *
+ * @return Number of events replayed, -1 if the trace is not valid.
+ ******************************************************************************/
+static int64_t host_replay(const uint8_t *trace, size_t size, uint64_t *duration_ticks)
+{
+  sl_bt_event_trace_reader_t reader;
+  sl_bt_msg_t evt;
+  uint32_t timestamp;
+  uint32_t previous_timestamp = 0u;
+  uint32_t host_freq = sl_sleeptimer_get_timer_frequency();
+  uint64_t start_tick = sl_sleeptimer_host_get_elapsed_ticks();
+  int64_t event_count = 0;
+  sl_status_t status;
+
+  if (sl_bt_event_trace_reader_init(&reader, trace, size) != SL_STATUS_OK) {
+    fprintf(stderr, "not an event trace\n");
+    return -1;
+  }
+
+  while ((status = sl_bt_event_trace_read(&reader, &timestamp, &evt)) == SL_STATUS_OK) {
+    uint32_t event_id = SL_BT_MSG_ID(evt.header);
+    host_event_stats_t *stats = host_get_event_stats(event_id);
+    uint32_t cmd_call_count;
+    uint64_t start_ns;
+    uint64_t latency_ns;
+
+    // The timers of the application expire up to the time of the event.
+    if (event_count > 0) {
+      uint64_t delta = (uint32_t)(timestamp - previous_timestamp);
+
+      sl_sleeptimer_host_advance((delta * host_freq) / reader.timer_frequency);
+    }
+    previous_timestamp = timestamp;
+
+    // The stack writes a value received from a client before raising the
+    // event.
+    if (event_id == sl_bt_evt_gatt_server_attribute_value_id) {
+      host_attribute_write(evt.data.evt_gatt_server_attribute_value.attribute,
+                           evt.data.evt_gatt_server_attribute_value.offset,
+                           evt.data.evt_gatt_server_attribute_value.value.len,
+                           evt.data.evt_gatt_server_attribute_value.value.data);
+    }
+
+    cmd_call_count = host_cmd_call_count;
+    start_ns = host_time_ns();
+    sl_bt_process_event(&evt);
+    latency_ns = host_time_ns() - start_ns;
+
+    stats->count++;
+    stats->latency_total_ns += latency_ns;
+    if (latency_ns > stats->latency_max_ns) {
+      stats->latency_max_ns = latency_ns;
+    }
+    stats->cmd_call_count += host_cmd_call_count - cmd_call_count;
+
+    app_process_action();
+    event_count++;
+  }
+
+  if (status != SL_STATUS_EMPTY) {
+    fprintf(stderr, "truncated or invalid record after %" PRId64 " events\n", event_count);
+    return -1;
+  }
+  *duration_ticks = sl_sleeptimer_host_get_elapsed_ticks() - start_tick;
+
+  return event_count;
+}
+
+/***************************************************************************//**
+ * Measures the dispatch of the events of a trace to the component handlers.
+ *
+ * @return false if the events cannot be allocated.
+ ******************************************************************************/
+static bool host_benchmark_routes(const uint8_t *trace, size_t size, uint32_t repeat)
+{
+  sl_bt_event_trace_reader_t reader;
+  sl_bt_msg_t *events;
+  uint32_t timestamp;
+  size_t event_count = 0u;
+  size_t route_count;
+  const sli_bt_event_route_t *routes = sli_bt_get_event_routes(&route_count);
+  sli_bt_event_handler_t handlers[HOST_EVENT_ID_COUNT_MAX];
+  size_t handler_count = 0u;
+  uint64_t routed_call_count = 0u;
+  uint64_t start_ns;
+  uint64_t routed_ns;
+  uint64_t chained_ns;
+
+  // The events are decoded once, so that the reader is not measured. A record
+  // takes at least its header.
+  events = malloc(size * sizeof(*events) / sizeof(sl_bt_event_trace_record_t));
+  if ((events == NULL) || (sl_bt_event_trace_reader_init(&reader, trace, size) != SL_STATUS_OK)) {
+    free(events);
+    return false;
+  }
+  while (sl_bt_event_trace_read(&reader, &timestamp, &events[event_count]) == SL_STATUS_OK) {
+    event_count++;
+  }
+
+  // The component handlers, once each, as sl_bt_process_event() called them
+  // without the route table
+  for (size_t i = 0; i < route_count; i++) {
+    size_t j = 0;
+
+    while ((j < handler_count) && (handlers[j] != routes[i].handler)) {
+      j++;
+    }
+    if ((j == handler_count) && (handler_count < HOST_EVENT_ID_COUNT_MAX)) {
+      handlers[handler_count++] = routes[i].handler;
+    }
+  }
+  for (size_t i = 0; i < event_count; i++) {
+    for (size_t j = 0; j < route_count; j++) {
+      routed_call_count += (routes[j].event_id == SL_BT_MSG_ID(events[i].header)) ? 1u : 0u;
+    }
+  }
+
+  start_ns = host_time_ns();
+  for (uint32_t r = 0; r < repeat; r++) {
+    for (size_t i = 0; i < event_count; i++) {
+      sli_bt_process_component_event(&events[i]);
+    }
+  }
+  routed_ns = host_time_ns() - start_ns;
+
+  start_ns = host_time_ns();
+  for (uint32_t r = 0; r < repeat; r++) {
+    for (size_t i = 0; i < event_count; i++) {
+      for (size_t j = 0; j < handler_count; j++) {
+        handlers[j](&events[i]);
+      }
+    }
+  }
+  chained_ns = host_time_ns() - start_ns;
+  free(events);
+
+  printf("\nComponent dispatch of %zu events x %" PRIu32 ", %zu routes to %zu handlers\n",
+         event_count, repeat, route_count, handler_count);
+  printf("%-34s %10s %14s\n", "dispatch", "ns/event", "calls per pass");
+  printf("%-34s %10.1f %14" PRIu64 "\n",
+         "route table",
+         (double)routed_ns / ((double)event_count * repeat),
+         routed_call_count);
+  printf("%-34s %10.1f %14" PRIu64 "\n",
+         "every handler",
+         (double)chained_ns / ((double)event_count * repeat),
+         (uint64_t)event_count * handler_count);
+
+  return true;
+}
+
+/***************************************************************************//**
+ * Prints the statistics of the replay.
+ ******************************************************************************/
+static void host_report(int64_t event_count, uint64_t duration_ticks, uint64_t event_cmd_call_count)
+{
+  printf("%" PRId64 " events over %.1f s\n",
+         event_count,
+         (double)duration_ticks / sl_sleeptimer_get_timer_frequency());
+
+  printf("\n%-34s %8s %10s %10s %10s\n", "event", "count", "mean ns", "max ns", "commands");
+  for (uint32_t i = 0; i < host_event_id_count; i++) {
+    const host_event_stats_t *stats = &host_event_stats[i];
+
+    host_print_event_name(stats->event_id);
+    printf(" %8" PRIu32 " %10" PRIu64 " %10" PRIu64 " %10" PRIu64 "\n",
+           stats->count,
+           stats->latency_total_ns / stats->count,
+           stats->latency_max_ns,
+           stats->cmd_call_count);
+  }
+  printf("%-34s %8s %10s %10s %10" PRIu64 "\n",
+         "(timers and main loop)", "", "", "",
+         (uint64_t)host_cmd_call_count - event_cmd_call_count);
+
+  printf("\n%-34s %8s %10s %10s\n", "command", "calls", "failures", "bytes");
+  for (uint32_t i = 0; i < HOST_CMD_COUNT; i++) {
+    if (host_cmd_stats[i].call_count != 0u) {
+      printf("%-34s %8" PRIu32 " %10" PRIu32 " %10" PRIu64 "\n",
+             host_cmd_names[i],
+             host_cmd_stats[i].call_count,
+             host_cmd_stats[i].failure_count,
+             host_cmd_stats[i].byte_count);
+    }
+  }
+  printf("\nLED changes: %" PRIu32 "\n", host_led_change_count);
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+  uint32_t seconds = 0u;
+  uint32_t signal_rate_hz = HOST_SYNTHETIC_RATE_DEFAULT;
+  uint16_t mtu = HOST_SYNTHETIC_MTU_DEFAULT;
+  const char *trace_out_path = NULL;
+  uint32_t benchmark_repeat = 0u;
+  uint8_t *trace;
+  size_t trace_size;
+  uint64_t duration_ticks = 0u;
+  uint64_t event_cmd_call_count = 0u;
+  int64_t event_count;
+  int option;
+
+  while ((option = getopt(argc, argv, "g:r:m:o:f:b:v")) != -1) {
+    switch (option) {
+      case 'g':
+        seconds = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'r':
+        signal_rate_hz = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'm':
+        mtu = (uint16_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'o':
+        trace_out_path = optarg;
+        break;
+
+      case 'f':
+        host_notification_fail_period = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'b':
+        benchmark_repeat = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'v':
+        host_log_enabled = true;
+        break;
+
+      default:
+        seconds = 0u;
+        optind = argc;
+        break;
+    }
+  }
+
+  if (((seconds == 0u) == (optind >= argc)) || (signal_rate_hz == 0u) || (mtu < 23u)) {
+    fprintf(stderr, "usage: %s [-g seconds [-r signal_hz] [-m mtu] [-o trace_out]] [-f n] [-b n] [-v] [trace_file]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  sl_sleeptimer_init();
+
+  if (seconds != 0u) {
+    size_t event_count_max = ((size_t)seconds + 1u) * (signal_rate_hz + 1u) + 8u;
+
+    trace_size = sizeof(sl_bt_event_trace_header_t) + (event_count_max * HOST_SYNTHETIC_RECORD_SIZE);
+    trace = aligned_alloc(4u, trace_size);
+    if (trace == NULL) {
+      fprintf(stderr, "cannot allocate the trace\n");
+      return EXIT_FAILURE;
+    }
+    trace_size = host_generate(trace, trace_size, seconds, signal_rate_hz, mtu);
+    if (trace_size == 0u) {
+      fprintf(stderr, "FAIL: the synthetic trace does not fit in its buffer\n");
+      return EXIT_FAILURE;
+    }
+    if (trace_out_path != NULL) {
+      FILE *trace_out = fopen(trace_out_path, "wb");
+
+      if ((trace_out == NULL) || (fwrite(trace, 1u, trace_size, trace_out) != trace_size)) {
+        perror(trace_out_path);
+        return EXIT_FAILURE;
+      }
+      fclose(trace_out);
+    }
+  } else {
+    trace = host_read_trace(argv[optind], &trace_size);
+    if (trace == NULL) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The application starts after the generation of the synthetic trace, so
+  // that it only sees the replayed events.
+  sl_bt_init();
+  app_init();
+
+  event_count = host_replay(trace, trace_size, &duration_ticks);
+  if (event_count < 0) {
+    free(trace);
+    return EXIT_FAILURE;
+  }
+  for (uint32_t i = 0; i < host_event_id_count; i++) {
+    event_cmd_call_count += host_event_stats[i].cmd_call_count;
+  }
+  host_report(event_count, duration_ticks, event_cmd_call_count);
+
+  if ((benchmark_repeat != 0u) && !host_benchmark_routes(trace, trace_size, benchmark_repeat)) {
+    fprintf(stderr, "cannot allocate the benchmark events\n");
+    free(trace);
+    return EXIT_FAILURE;
+  }
+  free(trace);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,90 @@
+/***************************************************************************//**
+ * @file
+ * @brief Stubbed Bluetooth commands and peripherals of the event trace runner
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_BT_EVENT_TRACE_HOST_H
+#define SL_BT_EVENT_TRACE_HOST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Application entry points, called by the runner as by the main loop
+void app_init(void);
+void app_process_action(void);
+
+// Bluetooth commands stubbed by sl_bt_event_trace_host_stubs.c
+typedef enum {
+  HOST_CMD_ADVERTISER_CREATE_SET,
+  HOST_CMD_ADVERTISER_SET_TIMING,
+  HOST_CMD_LEGACY_ADVERTISER_GENERATE_DATA,
+  HOST_CMD_LEGACY_ADVERTISER_START,
+  HOST_CMD_EXTERNAL_SIGNAL,
+  HOST_CMD_CONNECTION_CLOSE,
+  HOST_CMD_GAP_GET_IDENTITY_ADDRESS,
+  HOST_CMD_GATT_SERVER_READ_ATTRIBUTE_VALUE,
+  HOST_CMD_GATT_SERVER_WRITE_ATTRIBUTE_VALUE,
+  HOST_CMD_GATT_SERVER_SEND_NOTIFICATION,
+  HOST_CMD_GATT_SERVER_NOTIFY_ALL,
+  HOST_CMD_GATT_SERVER_SEND_USER_WRITE_RESPONSE,
+  HOST_CMD_GATT_SERVER_SEND_USER_READ_RESPONSE,
+  HOST_CMD_COUNT
+} host_cmd_t;
+
+// Calls of a command. The cost of a call is the number of value bytes it
+// passes to or gets from the stack.
+typedef struct {
+  uint32_t call_count;
+  uint32_t failure_count;
+  uint64_t byte_count;
+} host_cmd_stats_t;
+
+extern const char *const host_cmd_names[HOST_CMD_COUNT];
+extern host_cmd_stats_t host_cmd_stats[HOST_CMD_COUNT];
+
+// Number of command calls since the start, to count the calls of an event
+extern uint32_t host_cmd_call_count;
+
+// When not 0, every host_notification_fail_period-th notification fails with
+// SL_STATUS_NO_MORE_RESOURCE, as when the stack is out of buffers.
+extern uint32_t host_notification_fail_period;
+
+// Prints the application logs when true
+extern bool host_log_enabled;
+
+// Number of LED state changes
+extern uint32_t host_led_change_count;
+
+/***************************************************************************//**
+ * Writes an attribute value in the local GATT database of the stubs, as the
+ * stack does before raising a gatt_server_attribute_value event.
+ ******************************************************************************/
+void host_attribute_write(uint16_t attribute, uint16_t offset, size_t len, const uint8_t *value);
+
+#endif // SL_BT_EVENT_TRACE_HOST_H
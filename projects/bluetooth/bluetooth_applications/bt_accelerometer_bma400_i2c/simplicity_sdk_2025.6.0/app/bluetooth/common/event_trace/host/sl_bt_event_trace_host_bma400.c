@@ -0,0 +1,255 @@
+/***************************************************************************//**
+ * @file
+ * @brief Simulated BMA400 accelerometer of the event trace runner
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * The sensor produces samples at the output data rate set with
+ * bma400_set_sensor_conf(), on the sleeptimer virtual clock. The data ready
+ * status, the single sample reads and the FIFO reads see the samples produced
+ * since the previous read, so the application reads the number of samples it
+ * would read on the target at the times of the replayed events.
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "sl_sleeptimer.h"
+#include "sl_sleeptimer_host.h"
+#include "mikroe_bma400_i2c.h"
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+#define HOST_BMA400_FIFO_SIZE        1024u
+
+// FIFO frame with 12-bit x, y and z data: header and 3 x 2 bytes
+#define HOST_BMA400_FRAME_SIZE       7u
+#define HOST_BMA400_FRAME_HEADER     0x8eu
+
+// 1 g at the 2 g range in 12-bit mode
+#define HOST_BMA400_ONE_G_LSB        1024
+
+/*******************************************************************************
+ ***************************  GLOBAL VARIABLES   *******************************
+ ******************************************************************************/
+
+sl_i2cspm_t *sl_i2cspm_mikroe = NULL;
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+// Output data rate, in mHz
+static uint32_t host_bma400_odr_mhz = 25000u;
+
+// Samples produced and read since the sensor was configured
+static uint64_t host_bma400_start_tick;
+static uint64_t host_bma400_read_count;
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Gets the number of samples produced since the sensor was configured.
+ ******************************************************************************/
+static uint64_t host_bma400_get_sample_count(void)
+{
+  uint64_t ticks = sl_sleeptimer_host_get_elapsed_ticks() - host_bma400_start_tick;
+
+  return (ticks * host_bma400_odr_mhz) / (1000u * (uint64_t)sl_sleeptimer_get_timer_frequency());
+}
+
+/***************************************************************************//**
+ * Gets the number of samples not read yet, capped by the FIFO size.
+ ******************************************************************************/
+static uint32_t host_bma400_get_pending_count(void)
+{
+  uint64_t pending = host_bma400_get_sample_count() - host_bma400_read_count;
+  uint64_t fifo_frames = HOST_BMA400_FIFO_SIZE / HOST_BMA400_FRAME_SIZE;
+
+  // The oldest samples are lost when the FIFO overflows.
+  if (pending > fifo_frames) {
+    host_bma400_read_count += pending - fifo_frames;
+    pending = fifo_frames;
+  }
+
+  return (uint32_t)pending;
+}
+
+/***************************************************************************//**
+ * Gets a sample: the device lies flat and slowly tilts on x and y.
+ ******************************************************************************/
+static void host_bma400_get_sample(uint64_t index, struct bma400_sensor_data *accel)
+{
+  accel->x = (int16_t)((int32_t)(index % 512u) - 256);
+  accel->y = (int16_t)(256 - (int32_t)(index % 512u));
+  accel->z = HOST_BMA400_ONE_G_LSB;
+  accel->sensortime = (uint32_t)index;
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+int8_t bma400_i2c_init(mikroe_i2c_handle_t i2cspm,
+                       uint8_t bma400_i2c_addr,
+                       struct bma400_dev *bma400)
+{
+  (void)i2cspm;
+  (void)bma400_i2c_addr;
+  (void)bma400;
+  return BMA400_OK;
+}
+
+int8_t bma400_init(struct bma400_dev *dev)
+{
+  (void)dev;
+  return BMA400_OK;
+}
+
+int8_t bma400_soft_reset(struct bma400_dev *dev)
+{
+  (void)dev;
+  return BMA400_OK;
+}
+
+int8_t bma400_get_sensor_conf(struct bma400_sensor_conf *conf, uint16_t n_sett, struct bma400_dev *dev)
+{
+  (void)dev;
+  for (uint16_t i = 0; i < n_sett; i++) {
+    memset(&conf[i].param, 0, sizeof(conf[i].param));
+  }
+  return BMA400_OK;
+}
+
+int8_t bma400_set_sensor_conf(const struct bma400_sensor_conf *conf, uint16_t n_sett, struct bma400_dev *dev)
+{
+  (void)dev;
+  for (uint16_t i = 0; i < n_sett; i++) {
+    if ((conf[i].type == BMA400_ACCEL)
+        && (conf[i].param.accel.odr >= BMA400_ODR_12_5HZ)
+        && (conf[i].param.accel.odr <= BMA400_ODR_800HZ)) {
+      host_bma400_odr_mhz = 12500u << (conf[i].param.accel.odr - BMA400_ODR_12_5HZ);
+      host_bma400_start_tick = sl_sleeptimer_host_get_elapsed_ticks();
+      host_bma400_read_count = 0u;
+    }
+  }
+  return BMA400_OK;
+}
+
+int8_t bma400_set_power_mode(uint8_t power_mode, struct bma400_dev *dev)
+{
+  (void)power_mode;
+  (void)dev;
+  return BMA400_OK;
+}
+
+int8_t bma400_set_device_conf(const struct bma400_device_conf *conf, uint8_t n_sett, struct bma400_dev *dev)
+{
+  (void)conf;
+  (void)n_sett;
+  (void)dev;
+  return BMA400_OK;
+}
+
+int8_t bma400_enable_interrupt(const struct bma400_int_enable *int_select, uint8_t n_sett, struct bma400_dev *dev)
+{
+  (void)int_select;
+  (void)n_sett;
+  (void)dev;
+  return BMA400_OK;
+}
+
+int8_t bma400_get_interrupt_status(uint16_t *int_status, struct bma400_dev *dev)
+{
+  (void)dev;
+  *int_status = (host_bma400_get_pending_count() > 0u) ? BMA400_ASSERTED_DRDY_INT : 0u;
+  return BMA400_OK;
+}
+
+// Reads the latest sample, the older ones are skipped as with the data
+// registers of the sensor.
+int8_t bma400_get_accel_data(uint8_t data_sel, struct bma400_sensor_data *accel, struct bma400_dev *dev)
+{
+  (void)data_sel;
+  (void)dev;
+  host_bma400_get_pending_count();
+  host_bma400_read_count = host_bma400_get_sample_count();
+  host_bma400_get_sample(host_bma400_read_count, accel);
+  return BMA400_OK;
+}
+
+// Reads whole frames, fifo->length bytes at most, and sets fifo->length to the
+// number of bytes read.
+int8_t bma400_get_fifo_data(struct bma400_fifo_data *fifo, struct bma400_dev *dev)
+{
+  uint32_t frame_count;
+
+  (void)dev;
+  frame_count = SL_MIN(host_bma400_get_pending_count(), fifo->length / HOST_BMA400_FRAME_SIZE);
+  for (uint32_t i = 0; i < frame_count; i++) {
+    struct bma400_sensor_data accel;
+    uint8_t *frame = &fifo->data[i * HOST_BMA400_FRAME_SIZE];
+
+    host_bma400_get_sample(host_bma400_read_count + i, &accel);
+    frame[0] = HOST_BMA400_FRAME_HEADER;
+    memcpy(&frame[1], &accel.x, sizeof(accel.x));
+    memcpy(&frame[3], &accel.y, sizeof(accel.y));
+    memcpy(&frame[5], &accel.z, sizeof(accel.z));
+  }
+  host_bma400_read_count += frame_count;
+  fifo->length = (uint16_t)(frame_count * HOST_BMA400_FRAME_SIZE);
+  fifo->accel_byte_start_idx = 0;
+
+  return BMA400_OK;
+}
+
+int8_t bma400_extract_accel(struct bma400_fifo_data *fifo,
+                            struct bma400_sensor_data *accel_data,
+                            uint16_t *frame_count,
+                            const struct bma400_dev *dev)
+{
+  uint16_t count;
+
+  (void)dev;
+  count = SL_MIN(*frame_count, (fifo->length - fifo->accel_byte_start_idx) / HOST_BMA400_FRAME_SIZE);
+  for (uint16_t i = 0; i < count; i++) {
+    const uint8_t *frame = &fifo->data[fifo->accel_byte_start_idx + (i * HOST_BMA400_FRAME_SIZE)];
+
+    memcpy(&accel_data[i].x, &frame[1], sizeof(accel_data[i].x));
+    memcpy(&accel_data[i].y, &frame[3], sizeof(accel_data[i].y));
+    memcpy(&accel_data[i].z, &frame[5], sizeof(accel_data[i].z));
+    accel_data[i].sensortime = 0u;
+  }
+  fifo->accel_byte_start_idx += (uint16_t)(count * HOST_BMA400_FRAME_SIZE);
+  *frame_count = count;
+
+  return BMA400_OK;
+}
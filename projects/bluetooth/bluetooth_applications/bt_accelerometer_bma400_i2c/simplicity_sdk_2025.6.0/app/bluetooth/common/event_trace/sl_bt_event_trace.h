@@ -0,0 +1,150 @@
+/***************************************************************************//**
+ * @file
+ * @brief Bluetooth event trace recorder
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_BT_EVENT_TRACE_H
+#define SL_BT_EVENT_TRACE_H
+
+/***********************************************************************************************//**
+ * @addtogroup event_trace
+ * @{
+ **************************************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sl_status.h"
+#include "sl_bt_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Trace format identifier, "BTEV" in little endian
+#define SL_BT_EVENT_TRACE_MAGIC    0x56455442UL
+
+// Trace format version
+#define SL_BT_EVENT_TRACE_VERSION  1
+
+/**************************************************************************//**
+ * Trace header, at the start of a trace.
+ *
+ * The header is followed by the event records. Each record is a
+ * sl_bt_event_trace_record_t followed by the SL_BT_MSG_LEN(header) bytes of
+ * event data, padded to a multiple of 4 bytes. All fields are little endian.
+ *****************************************************************************/
+typedef struct {
+  uint32_t magic;           ///< SL_BT_EVENT_TRACE_MAGIC
+  uint16_t version;         ///< SL_BT_EVENT_TRACE_VERSION
+  uint16_t reserved;        ///< Reserved, 0
+  uint32_t timer_frequency; ///< Frequency of the record timestamps, in Hz
+} sl_bt_event_trace_header_t;
+
+// Event record header
+typedef struct {
+  uint32_t timestamp;       ///< Sleeptimer tick count when the event was processed
+  uint32_t header;          ///< Event header, as in sl_bt_msg_t
+} sl_bt_event_trace_record_t;
+
+// Trace reader state
+typedef struct {
+  const uint8_t *trace;     ///< Trace start
+  size_t size;              ///< Trace size, in bytes
+  size_t offset;            ///< Offset of the next record
+  uint32_t timer_frequency; ///< Frequency of the record timestamps, in Hz
+} sl_bt_event_trace_reader_t;
+
+/**************************************************************************//**
+ * Start recording the events passed to sl_bt_process_event().
+ *
+ * @param[in] buffer Buffer receiving the trace, 4-byte aligned.
+ * @param[in] size Buffer size, in bytes.
+ *
+ * @return SL_STATUS_OK if successful, SL_STATUS_INVALID_PARAMETER if the
+ *         buffer cannot hold the trace header.
+ *
+ * @note Recording stops when the buffer is full, so that the trace is an
+ *       uninterrupted sequence of events. The events that did not fit are
+ *       counted by sl_bt_event_trace_get_dropped_count().
+ *****************************************************************************/
+sl_status_t sl_bt_event_trace_start(uint8_t *buffer, size_t size);
+
+/**************************************************************************//**
+ * Stop recording.
+ *
+ * @return Trace size, in bytes.
+ *****************************************************************************/
+size_t sl_bt_event_trace_stop(void);
+
+/**************************************************************************//**
+ * Get the number of events that did not fit in the trace buffer.
+ *
+ * @return Number of events.
+ *****************************************************************************/
+uint32_t sl_bt_event_trace_get_dropped_count(void);
+
+/**************************************************************************//**
+ * Bluetooth stack event handler. Records the event while recording is on.
+ * @param[in] evt Event coming from the Bluetooth stack.
+ *****************************************************************************/
+void sl_bt_event_trace_on_event(const sl_bt_msg_t *evt);
+
+/**************************************************************************//**
+ * Initialize a reader on a recorded trace.
+ *
+ * @param[out] reader Reader state.
+ * @param[in] trace Trace start, 4-byte aligned.
+ * @param[in] size Trace size, in bytes.
+ *
+ * @return SL_STATUS_OK if successful, SL_STATUS_INVALID_PARAMETER if the
+ *         trace header is not valid.
+ *****************************************************************************/
+sl_status_t sl_bt_event_trace_reader_init(sl_bt_event_trace_reader_t *reader,
+                                          const uint8_t *trace,
+                                          size_t size);
+
+/**************************************************************************//**
+ * Read the next event of a trace.
+ *
+ * @param[in,out] reader Reader state.
+ * @param[out] timestamp Sleeptimer tick count when the event was processed.
+ * @param[out] evt Event, ready to be passed to sl_bt_process_event().
+ *
+ * @return SL_STATUS_OK if successful, SL_STATUS_EMPTY at the end of the trace,
+ *         SL_STATUS_INVALID_PARAMETER if the record is truncated or too large.
+ *****************************************************************************/
+sl_status_t sl_bt_event_trace_read(sl_bt_event_trace_reader_t *reader,
+                                   uint32_t *timestamp,
+                                   sl_bt_msg_t *evt);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} (end addtogroup event_trace) */
+#endif // SL_BT_EVENT_TRACE_H
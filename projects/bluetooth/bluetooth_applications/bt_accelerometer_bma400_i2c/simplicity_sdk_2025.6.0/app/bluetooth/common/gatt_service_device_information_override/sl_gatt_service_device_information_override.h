@@ -44,5 +44,14 @@
  *****************************************************************************/
 void sl_gatt_service_device_information_override_on_event(sl_bt_msg_t *evt);
 
+/**************************************************************************//**
+ * Events taken by sl_gatt_service_device_information_override_on_event(), as
+ * ROUTE(event ID, handler) entries. sl_bt_process_event() only passes these
+ * events to the handler.
+ * @note Keep in sync with the events handled by the handler.
+ *****************************************************************************/
+#define SL_GATT_SERVICE_DEVICE_INFORMATION_OVERRIDE_EVENT_ROUTES(ROUTE) \
+  ROUTE(sl_bt_evt_system_boot_id, sl_gatt_service_device_information_override_on_event)
+
 /** @} (end addtogroup gatt_service_device_information_override) */
 #endif // SL_GATT_SERVICE_DEVICE_INFORMATION_OVERRIDE_H
@@ -0,0 +1,44 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the register bit access API
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef EM_BUS_H
+#define EM_BUS_H
+
+#include <stdint.h>
+
+static inline void BUS_RegBitWrite(volatile uint32_t *addr,
+                                   unsigned int bit,
+                                   unsigned int val)
+{
+  *addr = (*addr & ~(1UL << bit)) | ((uint32_t)(val & 1U) << bit);
+}
+
+#endif // EM_BUS_H
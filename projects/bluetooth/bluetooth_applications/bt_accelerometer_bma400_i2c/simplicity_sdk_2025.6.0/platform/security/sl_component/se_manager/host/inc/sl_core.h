@@ -0,0 +1,52 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the CORE critical section API
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef SL_CORE_H
+#define SL_CORE_H
+
+#include <stdint.h>
+
+// Critical sections take a lock shared with the thread that runs the SE
+// completion interrupt, so that the interrupt handler cannot run inside one.
+// The lock is defined by the host test.
+
+#define CORE_ATOMIC_BASE_PRIORITY_LEVEL  3U
+
+void host_core_enter(void);
+void host_core_exit(void);
+
+#define CORE_DECLARE_IRQ_STATE  int irqState __attribute__((unused)) = 0
+#define CORE_ENTER_CRITICAL()   host_core_enter()
+#define CORE_EXIT_CRITICAL()    host_core_exit()
+#define CORE_ENTER_ATOMIC()     host_core_enter()
+#define CORE_EXIT_ATOMIC()      host_core_exit()
+
+#endif // SL_CORE_H
@@ -0,0 +1,50 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the Power Manager energy mode requirement API
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef SL_POWER_MANAGER_H
+#define SL_POWER_MANAGER_H
+
+// Only the energy mode requirements taken by the SE Manager. The requirements
+// are counted by the host test.
+
+typedef enum {
+  SL_POWER_MANAGER_EM0 = 0,
+  SL_POWER_MANAGER_EM1,
+  SL_POWER_MANAGER_EM2,
+  SL_POWER_MANAGER_EM3,
+  SL_POWER_MANAGER_EM4,
+} sl_power_manager_em_t;
+
+void sl_power_manager_add_em_requirement(sl_power_manager_em_t em);
+
+void sl_power_manager_remove_em_requirement(sl_power_manager_em_t em);
+
+#endif // SL_POWER_MANAGER_H
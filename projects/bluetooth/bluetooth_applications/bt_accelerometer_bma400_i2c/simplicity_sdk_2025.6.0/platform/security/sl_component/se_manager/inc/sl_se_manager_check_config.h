@@ -54,6 +54,14 @@
 #error "Yield support is not available on EFR32xG22 devices"
 #endif
 
+#if defined(SL_SE_MANAGER_ASYNC_COMMANDS) && defined(SL_SE_MANAGER_THREADING)
+#error "Asynchronous SE commands are currently only supported in bare metal mode."
+#endif
+
+#if defined(SL_SE_MANAGER_ASYNC_COMMANDS) && defined(SLI_VSE_MAILBOX_COMMAND_SUPPORTED)
+#error "Asynchronous SE commands are not available on EFR32xG22 devices"
+#endif
+
 #if (SLI_SE_AES_CTR_NUM_BLOCKS_BUFFERED != 1)
 #error "Using multiple blocks for key stream computation is not supported"
 #endif
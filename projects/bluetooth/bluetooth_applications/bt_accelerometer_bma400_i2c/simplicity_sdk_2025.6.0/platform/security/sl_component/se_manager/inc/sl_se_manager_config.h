@@ -51,6 +51,11 @@
   #endif
 #endif
 
+// Asynchronous execution of SE mailbox commands, see sli_se_execute_async().
+// Not enabled by default. Only available in bare metal mode on devices with
+// an SE mailbox (not EFR32xG22).
+// #define SL_SE_MANAGER_ASYNC_COMMANDS
+
 #ifndef SLI_SE_AES_CTR_NUM_BLOCKS_BUFFERED
   #define SLI_SE_AES_CTR_NUM_BLOCKS_BUFFERED 1
 #endif
@@ -69,7 +69,11 @@ extern "C" {
 /// in the SE Manager API. The purpose of these initialization values is to set
 /// the context objects to a known safe state initially when the context object
 /// is declared.
+#if defined(SL_SE_MANAGER_ASYNC_COMMANDS)
+#define SL_SE_COMMAND_CONTEXT_INIT           { SLI_SE_MAILBOX_COMMAND_DEFAULT(0), false, NULL, NULL, NULL }
+#else
 #define SL_SE_COMMAND_CONTEXT_INIT           { SLI_SE_MAILBOX_COMMAND_DEFAULT(0), false }
+#endif
 
 /// @} (end addtogroup sl_se_manager_core)
 
@@ -39,6 +39,7 @@
 
 #include "sl_se_manager_defines.h"
 #include "sli_se_manager_mailbox.h"
+#include "sl_status.h"
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
@@ -141,14 +142,29 @@ typedef struct {
  *   access them via corresponding set and get API functions, e.g.
  *   sl_se_set_yield().
  ******************************************************************************/
-typedef struct sl_se_command_context_t {
+typedef struct sl_se_command_context_t sl_se_command_context_t;
+
+#if defined(SL_SE_MANAGER_ASYNC_COMMANDS)
+/// Completion callback of an asynchronously executed SE mailbox command.
+/// Called from the SEMBRX interrupt handler.
+typedef void (*sli_se_command_callback_t)(sl_se_command_context_t *cmd_ctx,
+                                          sl_status_t status,
+                                          void *user_data);
+#endif
+
+struct sl_se_command_context_t {
   sli_se_mailbox_command_t  command; ///< SE mailbox command struct
   bool                      yield;   ///< If true, yield the CPU core while
                                      ///< waiting for the SE mailbox command
                                      ///< to complete. If false, busy-wait, by
                                      ///< polling the SE mailbox response
                                      ///< register.
-} sl_se_command_context_t;
+#if defined(SL_SE_MANAGER_ASYNC_COMMANDS)
+  sli_se_command_callback_t async_callback;  ///< Completion callback
+  void                      *async_user_data; ///< Passed to async_callback
+  sl_se_command_context_t   *async_next;     ///< Next queued command
+#endif
+};
 
 /// @} (end addtogroup sl_se_manager_core)
 
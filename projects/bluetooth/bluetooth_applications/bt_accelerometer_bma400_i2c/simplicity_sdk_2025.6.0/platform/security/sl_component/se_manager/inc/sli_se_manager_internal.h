@@ -171,6 +171,59 @@ sl_status_t sli_se_lock_acquire(void);
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SE_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
 sl_status_t sli_se_lock_release(void);
 
+#if defined(SL_SE_MANAGER_ASYNC_COMMANDS)
+/***************************************************************************//**
+ * @brief
+ *   Queue an SE mailbox command for asynchronous execution.
+ *
+ * @details
+ *   The command is started immediately if the SE is idle, or else as soon as
+ *   the commands queued before it have completed. The SEMBRX interrupt
+ *   handler reads the response, calls the completion callback and then
+ *   starts the next queued command, so that the callback can run a
+ *   synchronous command or queue further ones. While commands are
+ *   outstanding an EM1 requirement is held, so the core can sleep in EM1
+ *   instead of polling.
+ *
+ *   The command context, and every buffer referenced by its data transfer
+ *   descriptors, must remain valid until the callback has been called or the
+ *   command has been cancelled.
+ *
+ * @param[in,out] cmd_ctx
+ *   Pointer to an SE command context object holding the command.
+ *
+ * @param[in] callback
+ *   Function called from interrupt context when the command completes.
+ *
+ * @param[in] user_data
+ *   Opaque pointer passed to the callback.
+ *
+ * @return
+ *   SL_STATUS_OK when the command was queued, or else error code.
+ ******************************************************************************/
+sl_status_t sli_se_execute_async(sl_se_command_context_t *cmd_ctx,
+                                 sli_se_command_callback_t callback,
+                                 void *user_data);
+
+/***************************************************************************//**
+ * @brief
+ *   Remove a queued SE mailbox command before the SE has started it.
+ *
+ * @details
+ *   The completion callback of a cancelled command is not called. A command
+ *   already running on the SE cannot be aborted.
+ *
+ * @param[in,out] cmd_ctx
+ *   Pointer to an SE command context object passed to sli_se_execute_async().
+ *
+ * @return
+ *   SL_STATUS_OK when the command was removed from the queue,
+ *   SL_STATUS_BUSY when the command is currently executing, or
+ *   SL_STATUS_NOT_FOUND when the command is not queued.
+ ******************************************************************************/
+sl_status_t sli_se_cancel_async(sl_se_command_context_t *cmd_ctx);
+#endif // SL_SE_MANAGER_ASYNC_COMMANDS
+
 /***************************************************************************//**
  * @brief
  *   Execute and wait for mailbox command to complete.
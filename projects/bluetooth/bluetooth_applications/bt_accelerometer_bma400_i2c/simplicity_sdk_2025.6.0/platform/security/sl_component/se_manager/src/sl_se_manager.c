@@ -46,6 +46,12 @@
 #if !defined(SLI_SE_MANAGER_HOST_SYSTEM)
 #include "sli_psec_osal.h"
 #endif
+#if defined(SL_SE_MANAGER_ASYNC_COMMANDS)
+#include "sl_core.h"
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+#include "sl_power_manager.h"
+#endif
+#endif
 
 #include <string.h>
 
@@ -55,7 +61,8 @@
 // -----------------------------------------------------------------------------
 // Locals
 
-#if defined(SL_SE_MANAGER_YIELD_WHILE_WAITING_FOR_COMMAND_COMPLETION)
+#if defined(SL_SE_MANAGER_YIELD_WHILE_WAITING_FOR_COMMAND_COMPLETION) \
+  || defined(SL_SE_MANAGER_ASYNC_COMMANDS)
   #if defined(SL_SE_MANAGER_THREADING)
 /// Priority to use for SEMBRX IRQ
     #if defined(SE_MANAGER_USER_SEMBRX_IRQ_PRIORITY)
@@ -79,6 +86,20 @@
         #define SE_MANAGER_SEMBRX_IRQ_PRIORITY (CORE_ATOMIC_BASE_PRIORITY_LEVEL)
       #endif
     #endif
+  #elif defined(SL_SE_MANAGER_ASYNC_COMMANDS)
+/// Priority to use for SEMBRX IRQ. The IRQ handler runs the completion
+/// callbacks and the power manager, so it must not preempt atomic sections.
+    #if defined(SE_MANAGER_USER_SEMBRX_IRQ_PRIORITY)
+      #if (SE_MANAGER_USER_SEMBRX_IRQ_PRIORITY >= (1U << __NVIC_PRIO_BITS) )
+        #error Illegal SEMBRX priority level.
+      #endif
+      #if (SE_MANAGER_USER_SEMBRX_IRQ_PRIORITY < CORE_ATOMIC_BASE_PRIORITY_LEVEL)
+        #error Illegal SEMBRX priority level.
+      #endif
+      #define SE_MANAGER_SEMBRX_IRQ_PRIORITY SE_MANAGER_USER_SEMBRX_IRQ_PRIORITY
+    #else
+      #define SE_MANAGER_SEMBRX_IRQ_PRIORITY (CORE_ATOMIC_BASE_PRIORITY_LEVEL)
+    #endif
   #else  // defined(SL_SE_MANAGER_THREADING)
 /// Priority to use for SEMBRX IRQ
     #if defined(SE_MANAGER_USER_SEMBRX_IRQ_PRIORITY)
@@ -88,6 +109,7 @@
     #endif
   #endif  // defined(SL_SE_MANAGER_THREADING)
 #endif  // defined(SL_SE_MANAGER_YIELD_WHILE_WAITING_FOR_COMMAND_COMPLETION)
+//   || defined(SL_SE_MANAGER_ASYNC_COMMANDS)
 
 #if defined(SL_SE_MANAGER_THREADING) \
   || defined(SL_SE_MANAGER_YIELD_WHILE_WAITING_FOR_COMMAND_COMPLETION)
@@ -113,6 +135,128 @@ static volatile sli_se_mailbox_response_t se_manager_command_response = SLI_SE_R
 #endif // #if defined (SL_SE_MANAGER_THREADING)
 //   || defined(SL_SE_MANAGER_YIELD_WHILE_WAITING_FOR_COMMAND_COMPLETION)
 
+#if defined(SL_SE_MANAGER_ASYNC_COMMANDS)
+// Queue of asynchronous commands. The head is executing on the SE when
+// se_async_running is set.
+static sl_se_command_context_t *se_async_head = NULL;
+static sl_se_command_context_t *se_async_tail = NULL;
+static volatile bool se_async_running = false;
+// Number of synchronous commands that own, or wait for, the SE mailbox. A
+// completion callback may run a synchronous command while a thread is
+// waiting for the mailbox, so the claims nest.
+static volatile uint32_t se_sync_pending = 0;
+// Set while the queue holds the SEMAILBOX clock and the EM1 requirement.
+static bool se_async_active = false;
+// Set while the SEMBRX interrupt handler runs a completion callback. The
+// next command is only started when the callback returns.
+static bool se_async_completing = false;
+#endif // SL_SE_MANAGER_ASYNC_COMMANDS
+
+// -----------------------------------------------------------------------------
+// Static functions
+
+#if defined(SL_SE_MANAGER_ASYNC_COMMANDS)
+/***************************************************************************//**
+ * Start the command at the head of the queue if the SE mailbox is free, or
+ * drop the clock and EM1 requirement when there is nothing left to run.
+ * Must be called inside a critical section.
+ ******************************************************************************/
+static void se_async_dispatch(void)
+{
+  if (se_async_running || se_async_completing || (se_sync_pending > 0)) {
+    return;
+  }
+
+  if (se_async_head != NULL) {
+    if (!se_async_active) {
+      #if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+      // The SE completion interrupt wakes the core from EM1.
+      sl_power_manager_add_em_requirement(SL_POWER_MANAGER_EM1);
+      #endif
+      se_async_active = true;
+    }
+    (void)sli_se_lock_acquire();
+    se_async_running = true;
+    sli_se_mailbox_execute_command(&se_async_head->command);
+    sli_se_mailbox_enable_interrupt(SEMAILBOX_CONFIGURATION_RXINTEN);
+  } else if (se_async_active) {
+    (void)sli_se_lock_release();
+    #if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+    sl_power_manager_remove_em_requirement(SL_POWER_MANAGER_EM1);
+    #endif
+    se_async_active = false;
+  }
+}
+
+/***************************************************************************//**
+ * Check whether the SEMBRX interrupt is unable to preempt the caller.
+ ******************************************************************************/
+static bool se_async_sembrx_is_blocked(void)
+{
+  uint32_t sembrx_priority = NVIC_GetPriority(SEMBRX_IRQn);
+  uint32_t basepri = __get_BASEPRI() >> (8U - __NVIC_PRIO_BITS);
+  int32_t active_irq = (int32_t)(__get_IPSR() & 0x1FFU) - 16;
+
+  if (__get_PRIMASK() != 0U) {
+    return true;
+  }
+  if ((basepri != 0U) && (basepri <= sembrx_priority)) {
+    return true;
+  }
+  if (__get_IPSR() != 0U) {
+    // System exceptions, and IRQs of the same or a more urgent priority,
+    // cannot be preempted by SEMBRX.
+    if ((active_irq < 0)
+        || (NVIC_GetPriority((IRQn_Type)active_irq) <= sembrx_priority)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/***************************************************************************//**
+ * Take the SE mailbox for a synchronous command. Queued commands are held
+ * back and a running one is allowed to finish.
+ *
+ * @return
+ *   SL_STATUS_BUSY if an asynchronous command is running and the caller
+ *   blocks the SEMBRX interrupt that would complete it, SL_STATUS_OK otherwise.
+ ******************************************************************************/
+static sl_status_t se_async_claim_mailbox(void)
+{
+  bool blocked = se_async_sembrx_is_blocked();
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_CRITICAL();
+  if (se_async_running && blocked) {
+    CORE_EXIT_CRITICAL();
+    return SL_STATUS_BUSY;
+  }
+  se_sync_pending++;
+  CORE_EXIT_CRITICAL();
+
+  while (se_async_running) {
+    // Wait for the SEMBRX interrupt to complete the running command.
+  }
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Give the SE mailbox back after a synchronous command and resume the queue.
+ ******************************************************************************/
+static void se_async_release_mailbox(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_CRITICAL();
+  EFM_ASSERT(se_sync_pending > 0);
+  se_sync_pending--;
+  se_async_dispatch();
+  CORE_EXIT_CRITICAL();
+}
+#endif // SL_SE_MANAGER_ASYNC_COMMANDS
+
 // -----------------------------------------------------------------------------
 // Global functions
 
@@ -163,6 +307,13 @@ sl_status_t sl_se_init(void)
   #endif // #if defined (SL_SE_MANAGER_THREADING)
   //   || defined(SL_SE_MANAGER_YIELD_WHILE_WAITING_FOR_COMMAND_COMPLETION)
 
+  #if defined(SL_SE_MANAGER_ASYNC_COMMANDS)
+  // Enable SE RX mailbox interrupt in NVIC. The SEMAILBOX interrupt is only
+  // enabled while an asynchronous command is executing.
+  NVIC_SetPriority(SEMBRX_IRQn, SE_MANAGER_SEMBRX_IRQ_PRIORITY);
+  NVIC_EnableIRQ(SEMBRX_IRQn);
+  #endif
+
   return ret;
 }
 
@@ -221,6 +372,14 @@ sl_status_t sl_se_deinit(void)
   #endif // #if defined (SL_SE_MANAGER_THREADING)
   //   || defined(SL_SE_MANAGER_YIELD_WHILE_WAITING_FOR_COMMAND_COMPLETION)
 
+  #if defined(SL_SE_MANAGER_ASYNC_COMMANDS)
+  if (se_async_head != NULL) {
+    return SL_STATUS_BUSY;
+  }
+  NVIC_DisableIRQ(SEMBRX_IRQn);
+  NVIC_ClearPendingIRQ(SEMBRX_IRQn);
+  #endif
+
   return ret;
 }
 
@@ -336,6 +495,135 @@ void SEMBRX_IRQHandler(void)
 
 #endif // #if defined(SL_SE_MANAGER_YIELD_WHILE_WAITING_FOR_COMMAND_COMPLETION)
 
+#if defined(SL_SE_MANAGER_ASYNC_COMMANDS)
+
+/***************************************************************************//**
+ * @brief
+ *   SE Mailbox Interrupt Service Routine
+ ******************************************************************************/
+void SEMBRX_IRQHandler(void)
+{
+  sl_se_command_context_t *cmd_ctx;
+  sli_se_mailbox_response_t command_response;
+  sl_status_t status;
+  CORE_DECLARE_IRQ_STATE;
+
+  // Get command response and clear interrupt condition in SEMAILBOX peripheral
+  command_response = sli_se_mailbox_handle_response();
+  // Clear interrupt condition in NVIC
+  NVIC_ClearPendingIRQ(SEMBRX_IRQn);
+
+  CORE_ENTER_CRITICAL();
+  sli_se_mailbox_disable_interrupt(SEMAILBOX_CONFIGURATION_RXINTEN);
+  cmd_ctx = se_async_head;
+  if (!se_async_running || cmd_ctx == NULL) {
+    CORE_EXIT_CRITICAL();
+    return;
+  }
+  se_async_head = cmd_ctx->async_next;
+  if (se_async_head == NULL) {
+    se_async_tail = NULL;
+  }
+  cmd_ctx->async_next = NULL;
+  se_async_running = false;
+  se_async_completing = true;
+  CORE_EXIT_CRITICAL();
+
+  status = (command_response == SLI_SE_RESPONSE_OK)
+           ? SL_STATUS_OK : sli_se_to_sl_status(command_response);
+
+  // The callback may queue further commands or run a synchronous one, so the
+  // next command is started only after it returns.
+  cmd_ctx->async_callback(cmd_ctx, status, cmd_ctx->async_user_data);
+
+  CORE_ENTER_CRITICAL();
+  se_async_completing = false;
+  se_async_dispatch();
+  CORE_EXIT_CRITICAL();
+}
+
+/***************************************************************************//**
+ * Queue an SE mailbox command for asynchronous execution.
+ ******************************************************************************/
+sl_status_t sli_se_execute_async(sl_se_command_context_t *cmd_ctx,
+                                 sli_se_command_callback_t callback,
+                                 void *user_data)
+{
+  sl_se_command_context_t *it;
+  CORE_DECLARE_IRQ_STATE;
+
+  if (cmd_ctx == NULL || callback == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  CORE_ENTER_CRITICAL();
+  for (it = se_async_head; it != NULL; it = it->async_next) {
+    if (it == cmd_ctx) {
+      CORE_EXIT_CRITICAL();
+      return SL_STATUS_ALREADY_EXISTS;
+    }
+  }
+
+  cmd_ctx->async_callback = callback;
+  cmd_ctx->async_user_data = user_data;
+  cmd_ctx->async_next = NULL;
+  if (se_async_tail == NULL) {
+    se_async_head = cmd_ctx;
+  } else {
+    se_async_tail->async_next = cmd_ctx;
+  }
+  se_async_tail = cmd_ctx;
+
+  se_async_dispatch();
+  CORE_EXIT_CRITICAL();
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Remove a queued SE mailbox command before the SE has started it.
+ ******************************************************************************/
+sl_status_t sli_se_cancel_async(sl_se_command_context_t *cmd_ctx)
+{
+  sl_se_command_context_t *prev = NULL;
+  sl_se_command_context_t *it;
+  sl_status_t status = SL_STATUS_NOT_FOUND;
+  CORE_DECLARE_IRQ_STATE;
+
+  if (cmd_ctx == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  CORE_ENTER_CRITICAL();
+  for (it = se_async_head; it != NULL; prev = it, it = it->async_next) {
+    if (it != cmd_ctx) {
+      continue;
+    }
+    if (prev == NULL && se_async_running) {
+      status = SL_STATUS_BUSY;
+      break;
+    }
+    if (prev == NULL) {
+      se_async_head = it->async_next;
+    } else {
+      prev->async_next = it->async_next;
+    }
+    if (se_async_tail == it) {
+      se_async_tail = prev;
+    }
+    it->async_next = NULL;
+    status = SL_STATUS_OK;
+    break;
+  }
+  // Drop the clock and EM1 requirement if the queue became empty.
+  se_async_dispatch();
+  CORE_EXIT_CRITICAL();
+
+  return status;
+}
+
+#endif // SL_SE_MANAGER_ASYNC_COMMANDS
+
 /***************************************************************************//**
  * Set the yield attribute of the SE command context object.
  ******************************************************************************/
@@ -368,6 +656,8 @@ sl_status_t sl_se_set_yield(sl_se_command_context_t *cmd_ctx,
  *   function errors see @ref sl_status.h for their meaning.
  *   - @c SL_STATUS_OK
  *   - @c SL_STATUS_INVALID_PARAMETER
+ *   - @c SL_STATUS_BUSY when called with the SEMBRX interrupt blocked while
+ *     an asynchronous command is executing
  ******************************************************************************/
 #if defined(SLI_MAILBOX_COMMAND_SUPPORTED) && !defined(SLI_SE_MANAGER_HOST_SYSTEM)
 sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx)
@@ -379,9 +669,20 @@ sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx)
     return SL_STATUS_INVALID_PARAMETER;
   }
 
+  #if defined(SL_SE_MANAGER_ASYNC_COMMANDS)
+  // Wait for a running asynchronous command, if any, before taking the mailbox.
+  status = se_async_claim_mailbox();
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  #endif
+
   // Try to acquire SE lock
   status = sli_se_lock_acquire();
   if (status != SL_STATUS_OK) {
+    #if defined(SL_SE_MANAGER_ASYNC_COMMANDS)
+    se_async_release_mailbox();
+    #endif
     return status;
   }
 
@@ -428,6 +729,11 @@ sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx)
   // Release SE lock
   status = sli_se_lock_release();
 
+  #if defined(SL_SE_MANAGER_ASYNC_COMMANDS)
+  // Resume the asynchronous command queue.
+  se_async_release_mailbox();
+  #endif
+
   // Return sl_status_t code.
   if (command_response == SLI_SE_RESPONSE_OK) {
     return status;
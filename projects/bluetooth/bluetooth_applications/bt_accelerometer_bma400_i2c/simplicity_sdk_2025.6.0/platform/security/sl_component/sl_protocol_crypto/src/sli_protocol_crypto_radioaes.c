@@ -36,6 +36,7 @@
 #include "sli_protocol_crypto.h"
 #include "sl_code_classification.h"
 #include "em_core.h"
+#include <string.h>
 
 #define AES_BLOCK_BYTES       16U
 #define AES_128_KEY_BYTES     16U
@@ -520,6 +521,175 @@ sl_status_t sli_aes_crypt_ctr_radio(const unsigned char    *key,
   return sli_radioaes_run_operation(&aes_desc_fetcher_key, &aes_desc_pusher_data);
 }
 
+// Overwrite key material in a way the compiler cannot optimise away.
+static void aes_ctr_keystream_zeroize(void *buf, size_t len)
+{
+  volatile unsigned char *p = (volatile unsigned char *)buf;
+
+  while (len-- > 0) {
+    *p++ = 0;
+  }
+}
+
+sl_status_t sli_aes_ctr_keystream_init(sli_aes_ctr_keystream_t *ctx,
+                                       const unsigned char     *key,
+                                       unsigned int            keybits,
+                                       const unsigned char     iv[AES_BLOCK_BYTES])
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if (ctx == NULL || key == NULL || iv == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  switch (keybits) {
+    case 256:
+    case 128:
+      break;
+    case 192:
+      return SL_STATUS_NOT_SUPPORTED;
+    default:
+      return SL_STATUS_INVALID_KEY;
+  }
+
+  // Keystream produced under the previous key must never be handed out
+  // again, so wipe the whole context and invalidate any fill in progress.
+  CORE_ENTER_ATOMIC();
+  aes_ctr_keystream_zeroize(ctx->key, sizeof(ctx->key));
+  aes_ctr_keystream_zeroize(ctx->keystream, sizeof(ctx->keystream));
+  memcpy(ctx->key, key, keybits / 8);
+  memcpy(ctx->counter, iv, AES_BLOCK_BYTES);
+  ctx->keybits = keybits;
+  ctx->head = 0;
+  ctx->count = 0;
+  ctx->epoch++;
+  CORE_EXIT_ATOMIC();
+
+  return SL_STATUS_OK;
+}
+
+sl_status_t sli_aes_ctr_keystream_fill(sli_aes_ctr_keystream_t *ctx)
+{
+  unsigned char counter[AES_BLOCK_BYTES];
+  unsigned char next_counter[AES_BLOCK_BYTES];
+  uint32_t epoch;
+  uint8_t slot;
+  bool committed;
+  sl_status_t status;
+  CORE_DECLARE_IRQ_STATE;
+
+  if (ctx == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  for (;; ) {
+    CORE_ENTER_ATOMIC();
+    if (ctx->count >= SLI_AES_CTR_KEYSTREAM_BLOCKS) {
+      CORE_EXIT_ATOMIC();
+      break;
+    }
+    // The slot past the last valid block is never read by a consumer until
+    // count is incremented below, so it can be written outside the critical
+    // section.
+    slot = (uint8_t)((ctx->head + ctx->count) % SLI_AES_CTR_KEYSTREAM_BLOCKS);
+    memcpy(counter, ctx->counter, AES_BLOCK_BYTES);
+    epoch = ctx->epoch;
+    CORE_EXIT_ATOMIC();
+
+    // Encrypting zeros in CTR mode yields the raw keystream and lets the
+    // peripheral advance the counter exactly as on the inline path.
+    status = sli_aes_crypt_ctr_radio(ctx->key,
+                                     ctx->keybits,
+                                     (const unsigned char *)ctx->keystream[slot],
+                                     counter,
+                                     next_counter,
+                                     ctx->keystream[slot]);
+    if (status != SL_STATUS_OK) {
+      aes_ctr_keystream_zeroize(ctx->keystream[slot], AES_BLOCK_BYTES);
+      return status;
+    }
+
+    CORE_ENTER_ATOMIC();
+    committed = (epoch == ctx->epoch);
+    if (committed) {
+      memcpy(ctx->counter, next_counter, AES_BLOCK_BYTES);
+      ctx->count++;
+    }
+    CORE_EXIT_ATOMIC();
+
+    if (!committed) {
+      // The counter was consumed inline or the context was rekeyed while
+      // this block was being produced; it must never be used.
+      aes_ctr_keystream_zeroize(ctx->keystream[slot], AES_BLOCK_BYTES);
+    }
+  }
+
+  return SL_STATUS_OK;
+}
+
+sl_status_t sli_aes_crypt_ctr_keystream(sli_aes_ctr_keystream_t *ctx,
+                                        const unsigned char     input[AES_BLOCK_BYTES],
+                                        unsigned char           output[AES_BLOCK_BYTES])
+{
+  unsigned char counter[AES_BLOCK_BYTES];
+  unsigned char next_counter[AES_BLOCK_BYTES];
+  unsigned char *keystream;
+  sl_status_t status;
+  CORE_DECLARE_IRQ_STATE;
+
+  if (ctx == NULL || input == NULL || output == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  CORE_ENTER_ATOMIC();
+  if (ctx->count > 0) {
+    keystream = ctx->keystream[ctx->head];
+    ctx->head = (uint8_t)((ctx->head + 1) % SLI_AES_CTR_KEYSTREAM_BLOCKS);
+    ctx->count--;
+    CORE_EXIT_ATOMIC();
+
+    // The filler runs at a lower priority than the consumer, so the slot
+    // cannot be refilled before it has been read and erased here.
+    for (size_t i = 0; i < AES_BLOCK_BYTES; i++) {
+      output[i] = input[i] ^ keystream[i];
+    }
+    aes_ctr_keystream_zeroize(keystream, AES_BLOCK_BYTES);
+    return SL_STATUS_OK;
+  }
+
+  // Ring is empty: claim the counter so that a preempted fill discards the
+  // block it is producing for it, then fall back to the inline path.
+  memcpy(counter, ctx->counter, AES_BLOCK_BYTES);
+  ctx->epoch++;
+  CORE_EXIT_ATOMIC();
+
+  status = sli_aes_crypt_ctr_radio(ctx->key,
+                                   ctx->keybits,
+                                   input,
+                                   counter,
+                                   next_counter,
+                                   output);
+
+  CORE_ENTER_ATOMIC();
+  memcpy(ctx->counter, next_counter, AES_BLOCK_BYTES);
+  CORE_EXIT_ATOMIC();
+
+  return status;
+}
+
+void sli_aes_ctr_keystream_free(sli_aes_ctr_keystream_t *ctx)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if (ctx == NULL) {
+    return;
+  }
+
+  CORE_ENTER_ATOMIC();
+  aes_ctr_keystream_zeroize(ctx, sizeof(*ctx));
+  CORE_EXIT_ATOMIC();
+}
+
 sl_status_t sli_aes_crypt_ecb_radio(bool                   encrypt,
                                     const unsigned char    *key,
                                     unsigned int           keybits,
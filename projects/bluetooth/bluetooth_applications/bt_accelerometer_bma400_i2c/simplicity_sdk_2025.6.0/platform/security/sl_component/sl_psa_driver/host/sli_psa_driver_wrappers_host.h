@@ -0,0 +1,60 @@
+/***************************************************************************//**
+ * @file
+ * @brief Hash entry points of the PSA driver wrappers for the host test
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SLI_PSA_DRIVER_WRAPPERS_HOST_H
+#define SLI_PSA_DRIVER_WRAPPERS_HOST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "psa/crypto.h"
+
+// The psa_driver_wrapper_hash_*() entry points, see
+// sli_psa_driver_wrappers_host_entry.c.
+psa_status_t host_wrapper_hash_compute(psa_algorithm_t alg,
+                                       const uint8_t *input,
+                                       size_t input_length,
+                                       uint8_t *hash,
+                                       size_t hash_size,
+                                       size_t *hash_length);
+psa_status_t host_wrapper_hash_setup(psa_hash_operation_t *operation,
+                                     psa_algorithm_t alg);
+psa_status_t host_wrapper_hash_clone(const psa_hash_operation_t *source_operation,
+                                     psa_hash_operation_t *target_operation);
+psa_status_t host_wrapper_hash_update(psa_hash_operation_t *operation,
+                                      const uint8_t *input,
+                                      size_t input_length);
+psa_status_t host_wrapper_hash_finish(psa_hash_operation_t *operation,
+                                      uint8_t *hash,
+                                      size_t hash_size,
+                                      size_t *hash_length);
+psa_status_t host_wrapper_hash_abort(psa_hash_operation_t *operation);
+
+#endif // SLI_PSA_DRIVER_WRAPPERS_HOST_H
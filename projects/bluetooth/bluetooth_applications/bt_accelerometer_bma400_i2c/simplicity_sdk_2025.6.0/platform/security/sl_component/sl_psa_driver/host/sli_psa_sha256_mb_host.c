@@ -0,0 +1,520 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test and benchmark of the multi-buffer SHA-256 engine
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Checks sli_sha256_mb_process() against a single-buffer SHA-256 and times
+ * the two.
+ *
+ * The single-buffer SHA-256 is the plain FIPS 180-4 compression of one block
+ * after the other, as done for each operation by a software or accelerator
+ * hash update. The engine is checked against it on the FIPS 180-4 examples
+ * and on batches of random messages of unequal lengths, some of them with a
+ * head block as passed by sli_cryptoacc_transparent_hash_update_multi().
+ *
+ * The benchmark hashes batches of equal-length messages, as the driver does
+ * with up to SLI_CRYPTOACC_HASH_BATCH_SIZE operations: one message after the
+ * other with the single-buffer SHA-256, with the engine one job per call, and
+ * with the engine the whole batch per call.
+ *
+ * Usage: sli_psa_sha256_mb_host [options]
+ *   -n <count>   Messages per batch, at most 64. Default: 8.
+ *   -m <MiB>     Data hashed per measurement. Default: 16.
+ *   -r <seed>    Seed of the random messages. Default: 1.
+ *
+ * Prints the throughput of each variant per message length, and the speedup
+ * of the batched engine over the single-buffer SHA-256.
+ ******************************************************************************/
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sli_psa_sha256_mb.h"
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+#define HOST_BATCH_DEFAULT       8u
+#define HOST_BATCH_MAX           64u
+#define HOST_MIB_DEFAULT         16u
+
+// Random batches checked against the single-buffer SHA-256.
+#define HOST_RANDOM_BATCHES      2000u
+#define HOST_RANDOM_MAX_COUNT    20u
+#define HOST_RANDOM_MAX_LENGTH   1000u
+
+#define HOST_DIGEST_SIZE         32u
+
+// Largest padded message of the checks and the benchmark.
+#define HOST_MAX_LENGTH          16384u
+#define HOST_MAX_PADDED          (HOST_MAX_LENGTH + (2u * SLI_SHA256_MB_BLOCK_SIZE))
+
+#define HOST_ROTR(x, n)  (((x) >> (n)) | ((x) << (32u - (n))))
+
+/*******************************************************************************
+ ********************************   DATA TYPES   *******************************
+ ******************************************************************************/
+
+// A message padded to complete blocks, and its chaining state.
+typedef struct {
+  uint8_t data[HOST_MAX_PADDED];
+  size_t blocks;
+  uint8_t state[SLI_SHA256_MB_STATE_SIZE];
+} host_message_t;
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+static const uint32_t host_k[64] = {
+  0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5,
+  0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+  0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
+  0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+  0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC,
+  0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+  0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7,
+  0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+  0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
+  0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+  0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3,
+  0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+  0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5,
+  0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+  0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
+  0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+static const uint8_t host_iv[SLI_SHA256_MB_STATE_SIZE] = {
+  0x6A, 0x09, 0xE6, 0x67, 0xBB, 0x67, 0xAE, 0x85,
+  0x3C, 0x6E, 0xF3, 0x72, 0xA5, 0x4F, 0xF5, 0x3A,
+  0x51, 0x0E, 0x52, 0x7F, 0x9B, 0x05, 0x68, 0x8C,
+  0x1F, 0x83, 0xD9, 0xAB, 0x5B, 0xE0, 0xCD, 0x19
+};
+
+static uint64_t host_check_count;
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Fails the test unless a condition holds.
+ ******************************************************************************/
+static void host_expect(bool condition, const char *what)
+{
+  host_check_count++;
+  if (!condition) {
+    fprintf(stderr, "FAIL: %s\n", what);
+    exit(EXIT_FAILURE);
+  }
+}
+
+/***************************************************************************//**
+ * Returns a monotonic timestamp in nanoseconds.
+ ******************************************************************************/
+static uint64_t host_time_ns(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+static uint32_t host_load_be32(const uint8_t *p)
+{
+  return ((uint32_t)p[0] << 24)
+         | ((uint32_t)p[1] << 16)
+         | ((uint32_t)p[2] << 8)
+         | (uint32_t)p[3];
+}
+
+static void host_store_be32(uint8_t *p, uint32_t v)
+{
+  p[0] = (uint8_t)(v >> 24);
+  p[1] = (uint8_t)(v >> 16);
+  p[2] = (uint8_t)(v >> 8);
+  p[3] = (uint8_t)v;
+}
+
+/***************************************************************************//**
+ * Single-buffer SHA-256: compresses the blocks of one stream in order.
+ ******************************************************************************/
+static void host_sha256_blocks(uint8_t state[SLI_SHA256_MB_STATE_SIZE],
+                               const uint8_t *data,
+                               size_t blocks)
+{
+  uint32_t h[8];
+  uint32_t w[64];
+  uint32_t a, b, c, d, e, f, g, hh, t1, t2;
+  size_t i;
+
+  for (i = 0; i < 8u; i++) {
+    h[i] = host_load_be32(state + (4u * i));
+  }
+
+  for (; blocks > 0; blocks--, data += SLI_SHA256_MB_BLOCK_SIZE) {
+    for (i = 0; i < 16u; i++) {
+      w[i] = host_load_be32(data + (4u * i));
+    }
+    for (; i < 64u; i++) {
+      w[i] = (HOST_ROTR(w[i - 2u], 17u) ^ HOST_ROTR(w[i - 2u], 19u) ^ (w[i - 2u] >> 10u))
+             + w[i - 7u]
+             + (HOST_ROTR(w[i - 15u], 7u) ^ HOST_ROTR(w[i - 15u], 18u) ^ (w[i - 15u] >> 3u))
+             + w[i - 16u];
+    }
+
+    a = h[0];
+    b = h[1];
+    c = h[2];
+    d = h[3];
+    e = h[4];
+    f = h[5];
+    g = h[6];
+    hh = h[7];
+    for (i = 0; i < 64u; i++) {
+      t1 = hh + (HOST_ROTR(e, 6u) ^ HOST_ROTR(e, 11u) ^ HOST_ROTR(e, 25u))
+           + ((e & f) ^ (~e & g)) + host_k[i] + w[i];
+      t2 = (HOST_ROTR(a, 2u) ^ HOST_ROTR(a, 13u) ^ HOST_ROTR(a, 22u))
+           + ((a & b) ^ (a & c) ^ (b & c));
+      hh = g;
+      g = f;
+      f = e;
+      e = d + t1;
+      d = c;
+      c = b;
+      b = a;
+      a = t1 + t2;
+    }
+    h[0] += a;
+    h[1] += b;
+    h[2] += c;
+    h[3] += d;
+    h[4] += e;
+    h[5] += f;
+    h[6] += g;
+    h[7] += hh;
+  }
+
+  for (i = 0; i < 8u; i++) {
+    host_store_be32(state + (4u * i), h[i]);
+  }
+}
+
+/***************************************************************************//**
+ * Pads a message to complete blocks as SHA-256 finish does, and resets its
+ * chaining state to the SHA-256 initial value.
+ ******************************************************************************/
+static void host_message_set(host_message_t *message, const uint8_t *data, size_t length)
+{
+  uint64_t bits = (uint64_t)length * 8u;
+  size_t padded;
+  size_t i;
+
+  padded = ((length + 8u) / SLI_SHA256_MB_BLOCK_SIZE + 1u) * SLI_SHA256_MB_BLOCK_SIZE;
+  memmove(message->data, data, length);
+  message->data[length] = 0x80;
+  memset(message->data + length + 1u, 0, padded - length - 1u);
+  for (i = 0; i < 8u; i++) {
+    message->data[padded - 1u - i] = (uint8_t)(bits >> (8u * i));
+  }
+  message->blocks = padded / SLI_SHA256_MB_BLOCK_SIZE;
+  memcpy(message->state, host_iv, sizeof(host_iv));
+}
+
+/***************************************************************************//**
+ * Fills a buffer with random bytes.
+ ******************************************************************************/
+static void host_random_fill(uint8_t *data, size_t length)
+{
+  for (size_t i = 0; i < length; i++) {
+    data[i] = (uint8_t)rand();
+  }
+}
+
+/***************************************************************************//**
+ * Checks both variants on the FIPS 180-4 examples.
+ ******************************************************************************/
+static void host_check_examples(void)
+{
+  static const struct {
+    const char *text;
+    size_t repeat;
+    uint8_t digest[HOST_DIGEST_SIZE];
+  } examples[] = {
+    { "abc", 1u,
+      { 0xBA, 0x78, 0x16, 0xBF, 0x8F, 0x01, 0xCF, 0xEA, 0x41, 0x41, 0x40, 0xDE, 0x5D, 0xAE, 0x22, 0x23,
+        0xB0, 0x03, 0x61, 0xA3, 0x96, 0x17, 0x7A, 0x9C, 0xB4, 0x10, 0xFF, 0x61, 0xF2, 0x00, 0x15, 0xAD } },
+    { "", 1u,
+      { 0xE3, 0xB0, 0xC4, 0x42, 0x98, 0xFC, 0x1C, 0x14, 0x9A, 0xFB, 0xF4, 0xC8, 0x99, 0x6F, 0xB9, 0x24,
+        0x27, 0xAE, 0x41, 0xE4, 0x64, 0x9B, 0x93, 0x4C, 0xA4, 0x95, 0x99, 0x1B, 0x78, 0x52, 0xB8, 0x55 } },
+    { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1u,
+      { 0x24, 0x8D, 0x6A, 0x61, 0xD2, 0x06, 0x38, 0xB8, 0xE5, 0xC0, 0x26, 0x93, 0x0C, 0x3E, 0x60, 0x39,
+        0xA3, 0x3C, 0xE4, 0x59, 0x64, 0xFF, 0x21, 0x67, 0xF6, 0xEC, 0xED, 0xD4, 0x19, 0xDB, 0x06, 0xC1 } },
+    { "a", 1000000u,
+      { 0xCD, 0xC7, 0x6E, 0x5C, 0x99, 0x14, 0xFB, 0x92, 0x81, 0xA1, 0xC7, 0xE2, 0x84, 0xD7, 0x3E, 0x67,
+        0xF1, 0x80, 0x9A, 0x48, 0xA4, 0x97, 0x20, 0x0E, 0x04, 0x6D, 0x39, 0xCC, 0xC7, 0x11, 0x2C, 0xD0 } },
+  };
+  const size_t count = sizeof(examples) / sizeof(examples[0]);
+  sli_sha256_mb_job_t jobs[sizeof(examples) / sizeof(examples[0])];
+  uint8_t single[sizeof(examples) / sizeof(examples[0])][SLI_SHA256_MB_STATE_SIZE];
+  uint8_t *data[sizeof(examples) / sizeof(examples[0])];
+  size_t blocks[sizeof(examples) / sizeof(examples[0])];
+
+  for (size_t n = 0; n < count; n++) {
+    size_t length = strlen(examples[n].text) * examples[n].repeat;
+    size_t padded = ((length + 8u) / SLI_SHA256_MB_BLOCK_SIZE + 1u) * SLI_SHA256_MB_BLOCK_SIZE;
+    uint64_t bits = (uint64_t)length * 8u;
+
+    data[n] = calloc(padded, 1u);
+    host_expect(data[n] != NULL, "host memory");
+    for (size_t i = 0; i < examples[n].repeat; i++) {
+      memcpy(data[n] + (i * strlen(examples[n].text)), examples[n].text, strlen(examples[n].text));
+    }
+    data[n][length] = 0x80;
+    for (size_t i = 0; i < 8u; i++) {
+      data[n][padded - 1u - i] = (uint8_t)(bits >> (8u * i));
+    }
+    blocks[n] = padded / SLI_SHA256_MB_BLOCK_SIZE;
+
+    memcpy(single[n], host_iv, sizeof(host_iv));
+    host_sha256_blocks(single[n], data[n], blocks[n]);
+    host_expect(memcmp(single[n], examples[n].digest, HOST_DIGEST_SIZE) == 0, "single-buffer digest of an example");
+
+    jobs[n].state = malloc(SLI_SHA256_MB_STATE_SIZE);
+    host_expect(jobs[n].state != NULL, "host memory");
+    memcpy(jobs[n].state, host_iv, sizeof(host_iv));
+    jobs[n].head = NULL;
+    jobs[n].data = data[n];
+    jobs[n].blocks = blocks[n];
+  }
+
+  sli_sha256_mb_process(jobs, count);
+  for (size_t n = 0; n < count; n++) {
+    host_expect(memcmp(jobs[n].state, examples[n].digest, HOST_DIGEST_SIZE) == 0, "multi-buffer digest of an example");
+    free(jobs[n].state);
+    free(data[n]);
+  }
+}
+
+/***************************************************************************//**
+ * Checks the engine against the single-buffer SHA-256 on random batches.
+ *
+ * The messages have unequal lengths so that lanes are refilled while others
+ * are busy. Some jobs pass their first block as head block, some have no
+ * block at all, and some start from a state other than the initial value.
+ ******************************************************************************/
+static void host_check_random(host_message_t *messages)
+{
+  static uint8_t input[HOST_MAX_LENGTH];
+  uint8_t expected[HOST_RANDOM_MAX_COUNT][SLI_SHA256_MB_STATE_SIZE];
+  sli_sha256_mb_job_t jobs[HOST_RANDOM_MAX_COUNT];
+
+  for (uint32_t batch = 0; batch < HOST_RANDOM_BATCHES; batch++) {
+    size_t count = (size_t)(rand() % (int)HOST_RANDOM_MAX_COUNT) + 1u;
+
+    for (size_t n = 0; n < count; n++) {
+      size_t length = (size_t)(rand() % (int)(HOST_RANDOM_MAX_LENGTH + 1u));
+
+      host_random_fill(input, length);
+      host_message_set(&messages[n], input, length);
+      if ((rand() % 4) == 0) {
+        host_random_fill(messages[n].state, SLI_SHA256_MB_STATE_SIZE);
+      }
+
+      memcpy(expected[n], messages[n].state, SLI_SHA256_MB_STATE_SIZE);
+      jobs[n].state = messages[n].state;
+      switch (rand() % 8) {
+        case 0:
+          // Nothing to hash, the state must be left as it is.
+          jobs[n].head = NULL;
+          jobs[n].data = NULL;
+          jobs[n].blocks = messages[n].blocks;
+          break;
+
+        case 1:
+        case 2:
+          // The first block comes from the partial block buffer.
+          host_sha256_blocks(expected[n], messages[n].data, messages[n].blocks);
+          jobs[n].head = messages[n].data;
+          jobs[n].data = messages[n].data + SLI_SHA256_MB_BLOCK_SIZE;
+          jobs[n].blocks = messages[n].blocks - 1u;
+          break;
+
+        default:
+          host_sha256_blocks(expected[n], messages[n].data, messages[n].blocks);
+          jobs[n].head = NULL;
+          jobs[n].data = messages[n].data;
+          jobs[n].blocks = messages[n].blocks;
+          break;
+      }
+    }
+
+    sli_sha256_mb_process(jobs, count);
+    for (size_t n = 0; n < count; n++) {
+      host_expect(memcmp(messages[n].state, expected[n], SLI_SHA256_MB_STATE_SIZE) == 0,
+                  "multi-buffer state of a random message");
+    }
+  }
+}
+
+/***************************************************************************//**
+ * Times the variants on batches of messages of one length.
+ ******************************************************************************/
+static void host_benchmark(host_message_t *messages, size_t count, size_t length, uint32_t mib)
+{
+  static uint8_t input[HOST_MAX_LENGTH];
+  sli_sha256_mb_job_t jobs[HOST_BATCH_MAX];
+  size_t rounds;
+  size_t padded_bytes;
+  volatile uint8_t sink = 0;
+  uint64_t start_ns;
+  uint64_t single_ns;
+  uint64_t one_job_ns;
+  uint64_t batch_ns;
+  double mib_hashed;
+
+  for (size_t n = 0; n < count; n++) {
+    host_random_fill(input, length);
+    host_message_set(&messages[n], input, length);
+  }
+  padded_bytes = count * messages[0].blocks * SLI_SHA256_MB_BLOCK_SIZE;
+  rounds = (((size_t)mib << 20) + padded_bytes - 1u) / padded_bytes;
+  mib_hashed = (double)(rounds * count * length) / (1024.0 * 1024.0);
+
+  start_ns = host_time_ns();
+  for (size_t round = 0; round < rounds; round++) {
+    for (size_t n = 0; n < count; n++) {
+      host_sha256_blocks(messages[n].state, messages[n].data, messages[n].blocks);
+      sink ^= messages[n].state[0];
+    }
+  }
+  single_ns = host_time_ns() - start_ns;
+
+  for (size_t n = 0; n < count; n++) {
+    jobs[n].state = messages[n].state;
+    jobs[n].head = NULL;
+    jobs[n].data = messages[n].data;
+    jobs[n].blocks = messages[n].blocks;
+  }
+
+  start_ns = host_time_ns();
+  for (size_t round = 0; round < rounds; round++) {
+    for (size_t n = 0; n < count; n++) {
+      sli_sha256_mb_process(&jobs[n], 1u);
+      sink ^= messages[n].state[0];
+    }
+  }
+  one_job_ns = host_time_ns() - start_ns;
+
+  start_ns = host_time_ns();
+  for (size_t round = 0; round < rounds; round++) {
+    sli_sha256_mb_process(jobs, count);
+    sink ^= messages[0].state[0];
+  }
+  batch_ns = host_time_ns() - start_ns;
+
+  printf("%8zu %10.1f %10.1f %10.1f %8.2fx\n",
+         length,
+         mib_hashed / ((double)single_ns / 1e9),
+         mib_hashed / ((double)one_job_ns / 1e9),
+         mib_hashed / ((double)batch_ns / 1e9),
+         (double)single_ns / (double)batch_ns);
+  (void)sink;
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Runs the multi-buffer SHA-256 test and benchmark.
+ ******************************************************************************/
+int main(int argc, char *argv[])
+{
+  static const size_t lengths[] = { 55u, 256u, 1024u, 4096u, 16384u };
+  host_message_t *messages;
+  uint32_t seed = 1u;
+  uint32_t batch = HOST_BATCH_DEFAULT;
+  uint32_t mib = HOST_MIB_DEFAULT;
+  int option;
+
+  while ((option = getopt(argc, argv, "n:m:r:")) != -1) {
+    switch (option) {
+      case 'n':
+        batch = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'm':
+        mib = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'r':
+        seed = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      default:
+        fprintf(stderr, "usage: %s [-n messages] [-m MiB] [-r seed]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+  }
+  if ((batch == 0) || (batch > (HOST_BATCH_MAX))) {
+    fprintf(stderr, "the batch must have 1 to %u messages\n", (unsigned)HOST_BATCH_MAX);
+    return EXIT_FAILURE;
+  }
+
+  messages = malloc(((batch > HOST_RANDOM_MAX_COUNT) ? batch : HOST_RANDOM_MAX_COUNT) * sizeof(*messages));
+  if (messages == NULL) {
+    fprintf(stderr, "out of host memory\n");
+    return EXIT_FAILURE;
+  }
+
+  srand(seed);
+  host_check_examples();
+  host_check_random(messages);
+  printf("%u lanes, %" PRIu64 " digest checks ok\n", (unsigned)SLI_SHA256_MB_LANES, host_check_count);
+
+  if (mib > 0) {
+    printf("\n%u messages per batch, MiB/s of message data\n", (unsigned)batch);
+    printf("%8s %10s %10s %10s %9s\n", "bytes", "single", "mb 1 job", "mb batch", "speedup");
+    for (size_t i = 0; i < (sizeof(lengths) / sizeof(lengths[0])); i++) {
+      host_benchmark(messages, batch, lengths[i], mib);
+    }
+  }
+
+  free(messages);
+  return EXIT_SUCCESS;
+}
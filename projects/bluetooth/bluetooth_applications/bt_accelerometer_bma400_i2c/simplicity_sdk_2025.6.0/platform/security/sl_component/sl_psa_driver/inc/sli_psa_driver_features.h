@@ -236,6 +236,20 @@
   #define SLI_PSA_DRIVER_FEATURE_HASH_STATE_64
 #endif
 
+// TODO: add public config option.
+#if defined(SLI_PSA_DRIVER_WRAPPERS_STATIC_DISPATCH) && defined(SLI_PSA_DRIVER_FEATURE_HASH)
+// Hash driver wrappers call the accelerator or the builtin implementation
+// directly based on the algorithm, instead of probing each driver.
+  #define SLI_PSA_DRIVER_FEATURE_STATIC_HASH_DISPATCH
+#endif
+
+// TODO: add public config option.
+#if defined(SLI_PSA_SUPPORT_SHA256_MULTI_BUFFER) \
+  && (defined(SLI_PSA_DRIVER_FEATURE_SHA224) || defined(SLI_PSA_DRIVER_FEATURE_SHA256))
+// Batched hash updates advance SHA-224/SHA-256 streams in software lockstep.
+  #define SLI_PSA_DRIVER_FEATURE_SHA256_MULTI_BUFFER
+#endif
+
 // -------------------------------------
 // MAC
 
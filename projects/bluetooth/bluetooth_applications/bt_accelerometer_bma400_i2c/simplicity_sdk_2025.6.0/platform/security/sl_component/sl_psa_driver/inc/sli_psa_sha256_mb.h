@@ -0,0 +1,108 @@
+/***************************************************************************//**
+ * @file
+ * @brief Multi-buffer software SHA-256 block engine.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#ifndef SLI_PSA_SHA256_MB_H
+#define SLI_PSA_SHA256_MB_H
+
+/// @cond DO_NOT_INCLUDE_WITH_DOXYGEN
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Defines
+
+/// Size in bytes of one SHA-224/SHA-256 message block.
+#define SLI_SHA256_MB_BLOCK_SIZE  64u
+
+/// Size in bytes of the SHA-224/SHA-256 chaining state.
+#define SLI_SHA256_MB_STATE_SIZE  32u
+
+/// Number of streams compressed in lockstep. Eight lanes are only used when
+/// the compiler can map a 256-bit vector onto native registers (AVX2).
+/// Compilers without GCC vector extensions fall back to one lane, which can
+/// also be selected by defining this to 1u, e.g. to compare the two.
+#ifndef SLI_SHA256_MB_LANES
+#if defined(__GNUC__) && defined(__AVX2__)
+  #define SLI_SHA256_MB_LANES     8u
+#elif defined(__GNUC__)
+  #define SLI_SHA256_MB_LANES     4u
+#else
+  #define SLI_SHA256_MB_LANES     1u
+#endif
+#endif
+
+// -----------------------------------------------------------------------------
+// Typedefs
+
+/// One independent SHA-224/SHA-256 stream to be advanced by a number of
+/// complete blocks. The optional head block is consumed before data, which
+/// lets a caller flush a partially buffered block and the bulk input of the
+/// same stream in a single job.
+typedef struct {
+  uint8_t *state;                     ///< Big-endian chaining state, updated in place
+  const uint8_t *head;                ///< Optional single block consumed first, or NULL
+  const uint8_t *data;                ///< Contiguous complete blocks, or NULL
+  size_t blocks;                      ///< Number of blocks available at data
+} sli_sha256_mb_job_t;
+
+// -----------------------------------------------------------------------------
+// Prototypes
+
+/*******************************************************************************
+ * @brief
+ *   Run the SHA-256 compression function over a set of independent streams.
+ *
+ * @details
+ *   Up to SLI_SHA256_MB_LANES jobs are compressed in lockstep, one block per
+ *   lane per round. Whenever a lane runs out of blocks its state is written
+ *   back and the lane is refilled from the next pending job, so streams of
+ *   unequal length keep the lanes busy. The engine has no hardware or
+ *   platform dependencies and can be built for the host.
+ *
+ * @param[in,out] jobs
+ *   Array of jobs. The state buffer of each job is updated in place. Two jobs
+ *   must not share a state buffer.
+ *
+ * @param[in] job_count
+ *   Number of entries in jobs.
+ ******************************************************************************/
+void sli_sha256_mb_process(sli_sha256_mb_job_t *jobs, size_t job_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+/// @endcond
+
+#endif // SLI_PSA_SHA256_MB_H
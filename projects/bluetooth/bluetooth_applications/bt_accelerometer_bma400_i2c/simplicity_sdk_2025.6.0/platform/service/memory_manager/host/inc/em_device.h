@@ -0,0 +1,60 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the device header used by the Memory Manager
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef EM_DEVICE_H
+#define EM_DEVICE_H
+
+#include <stdint.h>
+
+#define __INLINE         inline
+#define __STATIC_INLINE  static inline
+
+#define __CLZ(value)     ((uint8_t)__builtin_clz(value))
+
+// RAM banks of the BGM220PC22HNA, see bgm220pc22hna.h. The RAM is a buffer
+// allocated by the host tool, at address host_sram_base.
+extern uintptr_t host_sram_base;
+
+#define SRAM_BASE        host_sram_base
+#define SRAM_SIZE        0x8000UL
+
+#define DMEM_BANK0_SIZE  0x6000UL
+#define DMEM_BANK1_SIZE  0x2000UL
+#define DMEM_BANK2_SIZE  0x0UL
+#define DMEM_BANK3_SIZE  0x0UL
+#define DMEM_BANK4_SIZE  0x0UL
+#define DMEM_BANK5_SIZE  0x0UL
+#define DMEM_BANK6_SIZE  0x0UL
+#define DMEM_BANK7_SIZE  0x0UL
+#define DMEM_NUM_BANKS   0x2UL
+
+#define _SYSCFG_DMEM0RETNCTRL_MASK  0x00000003UL
+
+#endif // EM_DEVICE_H
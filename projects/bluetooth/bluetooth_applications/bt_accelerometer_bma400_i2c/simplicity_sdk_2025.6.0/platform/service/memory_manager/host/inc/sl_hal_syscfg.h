@@ -0,0 +1,55 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the SYSCFG RAM retention control API
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef SL_HAL_SYSCFG_H
+#define SL_HAL_SYSCFG_H
+
+#include <stdint.h>
+
+// The DMEM0RETNCTRL register is a variable defined by the host tool.
+extern uint32_t host_dmem0retnctrl;
+
+static inline uint32_t sl_hal_syscfg_read_dmem0retnctrl(void)
+{
+  return host_dmem0retnctrl;
+}
+
+static inline void sl_hal_syscfg_mask_dmem0retnctrl(uint32_t mask)
+{
+  host_dmem0retnctrl |= mask;
+}
+
+static inline void sl_hal_syscfg_zero_dmem0retnctrl(void)
+{
+  host_dmem0retnctrl = 0;
+}
+
+#endif // SL_HAL_SYSCFG_H
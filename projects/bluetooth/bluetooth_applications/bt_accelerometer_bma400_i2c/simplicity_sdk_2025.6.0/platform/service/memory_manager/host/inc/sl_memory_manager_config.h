@@ -0,0 +1,72 @@
+/***************************************************************************//**
+ * @file
+ * @brief Memory Manager configuration for the host tools
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_MEMORY_MANAGER_CONFIG_H
+#define SL_MEMORY_MANAGER_CONFIG_H
+
+// The options that change the heap layout or the block selection can be set
+// on the make command line to compare allocator configurations, e.g.
+// make MIN_SIZE=48 SEGREGATED=1 SIZE_CLASS=1. The RAM retention shrinking is
+// enabled by the retention test build and the lock-free pools by the pool
+// stress test build. The other features do not apply on the host.
+
+#ifndef SL_MEMORY_MANAGER_BLOCK_ALLOCATION_MIN_SIZE
+#define SL_MEMORY_MANAGER_BLOCK_ALLOCATION_MIN_SIZE   (32)
+#endif
+
+#define SL_MEMORY_MANAGER_STATISTICS_API_ENABLE  1
+
+#ifndef SL_MEMORY_MANAGER_SEGREGATED_FREE_LISTS_ENABLE
+#define SL_MEMORY_MANAGER_SEGREGATED_FREE_LISTS_ENABLE  0
+#endif
+
+#ifndef SL_MEMORY_MANAGER_LOCK_FREE_POOLS_ENABLE
+#define SL_MEMORY_MANAGER_LOCK_FREE_POOLS_ENABLE  0
+#endif
+
+#ifndef SL_MEMORY_MANAGER_SIZE_CLASS_POOLS_ENABLE
+#define SL_MEMORY_MANAGER_SIZE_CLASS_POOLS_ENABLE  0
+#endif
+
+#define SL_MEMORY_MANAGER_SIZE_CLASS_POOL_BLOCK_COUNT  16
+
+#define SL_MEMORY_MANAGER_HEAP_CHECK_SLEEP_BLOCK_COUNT  0
+
+#define SL_MEMORY_MANAGER_HEAP_CHECK_OWNER_COUNT  64
+
+#ifndef SL_MEMORY_MANAGER_RAM_RETENTION_SHRINK_ENABLE
+#define SL_MEMORY_MANAGER_RAM_RETENTION_SHRINK_ENABLE  0
+#endif
+
+#define SL_MEMORY_MANAGER_TRACE_RECORDER_ENABLE  0
+
+#define SL_MEMORY_MANAGER_TRACE_RECORDER_RECORD_COUNT  128
+
+#endif // SL_MEMORY_MANAGER_CONFIG_H
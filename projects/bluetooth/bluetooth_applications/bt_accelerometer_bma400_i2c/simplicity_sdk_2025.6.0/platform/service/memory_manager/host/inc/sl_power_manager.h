@@ -0,0 +1,68 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the Power Manager energy mode transition API
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef SL_POWER_MANAGER_H
+#define SL_POWER_MANAGER_H
+
+#include <stdint.h>
+
+// Only the energy mode transition events used by the RAM retention shrinking.
+// The host tool that subscribes also delivers the transitions.
+
+#define SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM2     (1 << 4)
+#define SL_POWER_MANAGER_EVENT_TRANSITION_LEAVING_EM2      (1 << 5)
+
+typedef enum {
+  SL_POWER_MANAGER_EM0 = 0,
+  SL_POWER_MANAGER_EM1,
+  SL_POWER_MANAGER_EM2,
+  SL_POWER_MANAGER_EM3,
+  SL_POWER_MANAGER_EM4,
+} sl_power_manager_em_t;
+
+typedef uint32_t sl_power_manager_em_transition_event_t;
+
+typedef void (*sl_power_manager_em_transition_on_event_t)(sl_power_manager_em_t from,
+                                                          sl_power_manager_em_t to);
+
+typedef struct {
+  const sl_power_manager_em_transition_event_t event_mask;
+  const sl_power_manager_em_transition_on_event_t on_event;
+} sl_power_manager_em_transition_event_info_t;
+
+typedef struct {
+  const sl_power_manager_em_transition_event_info_t *info;
+} sl_power_manager_em_transition_event_handle_t;
+
+void sl_power_manager_subscribe_em_transition_event(sl_power_manager_em_transition_event_handle_t *event_handle,
+                                                    const sl_power_manager_em_transition_event_info_t *event_info);
+
+#endif // SL_POWER_MANAGER_H
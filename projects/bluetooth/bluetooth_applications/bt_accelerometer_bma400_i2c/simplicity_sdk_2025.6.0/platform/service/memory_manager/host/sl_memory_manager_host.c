@@ -0,0 +1,958 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stress test and trace replay for the Memory Manager heap
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Runs the heap allocator of the Memory Manager on Linux, over a heap region
+ * allocated with malloc(). Each operation of a synthetic workload or of a trace
+ * is timed, then the heap is checked with the test utility integrity checkers,
+ * the block walk is compared with the heap statistics and the content of all
+ * the live blocks is verified. At the end, all the blocks are freed and the
+ * heap must be back to its initial state.
+ *
+ * Usage: sl_memory_manager_host [options] [trace_file]
+ *   -s <seed>   Seed of the synthetic workload. Default: 1.
+ *   -n <steps>  Number of synthetic operations. Default: 100000.
+ *   -H <bytes>  Heap size. Default: 49152.
+ *   -o <file>   Write the synthetic workload as a text trace.
+ *   -q          Only check the heap at the end, for latency measurements
+ *               closer to the target.
+ *   -b          The trace file is a stream of the allocation trace recorder.
+ *   -t <heap>:<lt>:<st>
+ *               Tracker handles of a recorder stream: the addresses of
+ *               sli_mm_heap_name, sli_mm_heap_malloc_lt_name and
+ *               sli_mm_heap_malloc_st_name in the recording image.
+ *   -P <percent>
+ *               Scale the block count of the pools. Default: 100.
+ *
+ * When a trace file is given, it is replayed instead of the synthetic
+ * workload. Text trace format, one operation per line, '#' starts a comment:
+ *   a <id> <size> <align> <lt|st>   Allocate a block
+ *   m <id> <size>                   Allocate a block with sl_malloc()
+ *   r <id> <size>                   Reallocate a block
+ *   f <id>                          Free a block
+ *   v <id> <size> <align>           Reserve a block
+ *   x <id>                          Release a reserved block
+ *   c <pool> <size> <count>         Create a pool
+ *   d <pool>                        Delete a pool
+ *   p <id> <pool>                   Allocate a block from a pool
+ *   q <id>                          Free a block to its pool
+ * Block identifiers are in the range [0, HOST_SLOT_COUNT) and pool identifiers
+ * in the range [0, HOST_POOL_COUNT). An alignment of 0 selects the default
+ * alignment.
+ *
+ * Replaying a recorder stream with several heap sizes (-H), pool sizes (-P)
+ * and builds of the Makefile (MIN_SIZE, SEGREGATED, SIZE_CLASS) compares allocator
+ * configurations with a field workload.
+ ******************************************************************************/
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sl_memory_manager.h"
+#include "sl_memory_manager_region.h"
+#include "sli_memory_manager.h"
+#include "sl_common.h"
+#include "sl_memory_manager_host.h"
+
+#if !defined(SLI_MEMORY_MANAGER_ENABLE_TEST_UTILITIES)
+#error "The Memory Manager host tool requires SLI_MEMORY_MANAGER_ENABLE_TEST_UTILITIES."
+#endif
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+#define HOST_HEAP_SIZE_DEFAULT        (48u * 1024u)
+#define HOST_HEAP_ADDR_ALIGN          4096u
+#define HOST_STEP_COUNT_DEFAULT       100000u
+
+// Number of block identifiers used by the synthetic workload. The last
+// identifiers are used for reservations and pool blocks.
+#define HOST_SYNTHETIC_BLOCK_COUNT    200u
+#define HOST_SYNTHETIC_RESERVE_COUNT  8u
+#define HOST_SYNTHETIC_POOL_COUNT     24u
+
+#define HOST_POOL_BLOCK_SIZE          24u
+#define HOST_POOL_BLOCK_COUNT         32u
+
+#define HOST_LINE_LEN_MAX             128u
+
+/*******************************************************************************
+ ********************************   DATA TYPES   *******************************
+ ******************************************************************************/
+
+typedef enum {
+  HOST_SLOT_EMPTY,
+  HOST_SLOT_BLOCK,
+  HOST_SLOT_RESERVED,
+  HOST_SLOT_POOL
+} host_slot_kind_t;
+
+// Block owned by the workload. The block is filled with a pattern that is
+// verified after each operation.
+typedef struct {
+  host_slot_kind_t kind;
+  uint8_t pattern;
+  uint32_t pool;
+  void *ptr;
+  size_t size;
+  sl_memory_reservation_t reservation;
+} host_slot_t;
+
+// Latency samples of one operation type, in nanoseconds.
+typedef struct {
+  uint32_t *samples;
+  size_t count;
+  size_t capacity;
+  uint32_t failure_count;
+} host_latency_t;
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+static const char *const host_op_names[HOST_OP_COUNT] = {
+  "alloc", "realloc", "free", "reserve", "release", "pool alloc", "pool free",
+  "pool create", "pool delete", "malloc"
+};
+
+static void *host_heap_addr;
+static size_t host_heap_size = HOST_HEAP_SIZE_DEFAULT;
+
+static host_slot_t host_slots[HOST_SLOT_COUNT];
+static host_latency_t host_latency[HOST_OP_COUNT];
+static sl_memory_pool_t host_pools[HOST_POOL_COUNT];
+static bool host_pool_live[HOST_POOL_COUNT];
+static uint32_t host_pool_scale = 100u;
+static sl_memory_heap_check_t host_heap_check;
+
+static bool host_check_every_step = true;
+static size_t host_step;
+static size_t host_used_size_max;
+static double host_fragmentation_peak;
+static size_t host_fragmentation_peak_step;
+static size_t host_fragmentation_peak_free_size;
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Reports an error and exits.
+ ******************************************************************************/
+static void host_fail(const char *reason, const void *block)
+{
+  fprintf(stderr, "FAIL at step %zu: %s", host_step, reason);
+  if (block != NULL) {
+    fprintf(stderr, " (heap offset %td)", (const uint8_t *)block - (const uint8_t *)host_heap_addr);
+  }
+  fprintf(stderr, "\n");
+  exit(EXIT_FAILURE);
+}
+
+/***************************************************************************//**
+ * Returns a monotonic timestamp in nanoseconds.
+ ******************************************************************************/
+static uint64_t host_time_ns(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/***************************************************************************//**
+ * Records the latency of an operation.
+ ******************************************************************************/
+static void host_latency_add(host_op_type_t type, uint64_t latency_ns)
+{
+  host_latency_t *latency = &host_latency[type];
+
+  if (latency->count == latency->capacity) {
+    latency->capacity = (latency->capacity == 0) ? 1024u : (latency->capacity * 2u);
+    latency->samples = realloc(latency->samples, latency->capacity * sizeof(uint32_t));
+    if (latency->samples == NULL) {
+      host_fail("out of host memory", NULL);
+    }
+  }
+  latency->samples[latency->count++] = (latency_ns > UINT32_MAX) ? UINT32_MAX : (uint32_t)latency_ns;
+}
+
+/***************************************************************************//**
+ * Fills a block with the pattern of its slot.
+ ******************************************************************************/
+static void host_slot_fill(host_slot_t *slot, size_t from)
+{
+  if (slot->size > from) {
+    memset((uint8_t *)slot->ptr + from, slot->pattern, slot->size - from);
+  }
+}
+
+/***************************************************************************//**
+ * Walks the heap blocks and compares them with the heap statistics.
+ ******************************************************************************/
+static void host_check_walk(void)
+{
+  sli_block_metadata_t *block = sli_memory_get_first_block(&sli_general_purpose_heap);
+  // Padding before the first block after a heap start alignment is in use.
+  size_t used_size = (size_t)((uint8_t *)block - (uint8_t *)host_heap_addr);
+  uint32_t free_count = 0;
+
+  for (;; ) {
+    used_size += SLI_BLOCK_METADATA_SIZE_BYTE;
+    if (block->block_in_use) {
+      used_size += SLI_BLOCK_LEN_DWORD_TO_BYTE(sli_block_len_dword_decode(block));
+    } else {
+      free_count++;
+    }
+    if (sli_block_offset_next_dword_decode(block) == 0) {
+      break;
+    }
+    block = (sli_block_metadata_t *)((uint64_t *)block + sli_block_offset_next_dword_decode(block));
+  }
+
+  for (uint32_t ix = 0; ix < SLI_MAX_RESERVATION_COUNT; ix++) {
+    if (sli_reservation_handle_ptr_table[ix] != NULL) {
+      used_size += sli_reservation_handle_ptr_table[ix]->block_size;
+    }
+  }
+
+  if (used_size != sl_memory_get_used_heap_size()) {
+    fprintf(stderr, "used size %zu, walk %zu\n", sl_memory_get_used_heap_size(), used_size);
+    host_fail("used heap size does not match the blocks", NULL);
+  }
+  if (free_count != sli_general_purpose_heap.free_blocks_number) {
+    fprintf(stderr, "free blocks %" PRIu32 ", walk %" PRIu32 "\n",
+            sli_general_purpose_heap.free_blocks_number, free_count);
+    host_fail("free block count does not match the blocks", NULL);
+  }
+}
+
+/***************************************************************************//**
+ * Checks the heap metadata, the heap statistics and the content of the live
+ * blocks.
+ ******************************************************************************/
+static void host_check_heap(void)
+{
+  sli_block_metadata_t *corrupted = sli_memory_check_heap_integrity_forwards();
+  void *corrupted_block = NULL;
+  uint32_t pass_count = host_heap_check.pass_count;
+
+  if (corrupted != NULL) {
+    host_fail("forwards heap integrity check", corrupted);
+  }
+  corrupted = sli_memory_check_heap_integrity_backwards();
+  if (corrupted != NULL) {
+    host_fail("backwards heap integrity check", corrupted);
+  }
+
+  // The incremental checker must complete a pass from wherever it stopped.
+  while (host_heap_check.pass_count == pass_count) {
+    if (sl_memory_heap_check_integrity_step(&sli_general_purpose_heap, &host_heap_check,
+                                            SIZE_MAX, &corrupted_block) != SL_STATUS_OK) {
+      host_fail("incremental heap integrity check", corrupted_block);
+    }
+  }
+
+  host_check_walk();
+
+  for (uint32_t id = 0; id < HOST_SLOT_COUNT; id++) {
+    const host_slot_t *slot = &host_slots[id];
+
+    for (size_t i = 0; i < slot->size; i++) {
+      if (((const uint8_t *)slot->ptr)[i] != slot->pattern) {
+        host_fail("block content overwritten", slot->ptr);
+      }
+    }
+  }
+}
+
+/***************************************************************************//**
+ * Samples the heap usage and fragmentation after an operation.
+ ******************************************************************************/
+static void host_sample_heap(void)
+{
+  sl_memory_heap_info_t heap_info;
+
+  sl_memory_get_heap_info(&heap_info);
+
+  if (heap_info.used_size > host_used_size_max) {
+    host_used_size_max = heap_info.used_size;
+  }
+
+  // Fragmentation is the part of the free memory that cannot be returned by
+  // a single allocation.
+  if (heap_info.free_size > 0) {
+    double fragmentation = 1.0 - ((double)heap_info.free_block_largest_size / (double)heap_info.free_size);
+
+    if (fragmentation > host_fragmentation_peak) {
+      host_fragmentation_peak = fragmentation;
+      host_fragmentation_peak_step = host_step;
+      host_fragmentation_peak_free_size = heap_info.free_size;
+    }
+  }
+}
+
+/***************************************************************************//**
+ * Applies one operation to the heap.
+ *
+ * @return  true if the operation was done, false if it was skipped because the
+ *          slot is not in the right state or failed because the heap is full.
+ ******************************************************************************/
+static bool host_apply(const host_op_t *op)
+{
+  host_slot_t *slot;
+  sl_status_t status = SL_STATUS_OK;
+  uint64_t start;
+  void *ptr = NULL;
+
+  if ((op->id >= HOST_SLOT_COUNT) || (op->pool >= HOST_POOL_COUNT)) {
+    host_fail("identifier out of range", NULL);
+  }
+  slot = &host_slots[op->id];
+
+  switch (op->type) {
+    case HOST_OP_ALLOC:
+    case HOST_OP_MALLOC:
+    case HOST_OP_RESERVE:
+      if (slot->kind != HOST_SLOT_EMPTY) {
+        return false;
+      }
+      break;
+
+    case HOST_OP_POOL_ALLOC:
+      if ((slot->kind != HOST_SLOT_EMPTY) || !host_pool_live[op->pool]) {
+        return false;
+      }
+      break;
+
+    case HOST_OP_POOL_CREATE:
+      if (host_pool_live[op->pool]) {
+        return false;
+      }
+      break;
+
+    case HOST_OP_POOL_DELETE:
+      if (!host_pool_live[op->pool]) {
+        return false;
+      }
+      break;
+
+    case HOST_OP_REALLOC:
+    case HOST_OP_FREE:
+      if (slot->kind != HOST_SLOT_BLOCK) {
+        return false;
+      }
+      break;
+
+    case HOST_OP_RELEASE:
+      if (slot->kind != HOST_SLOT_RESERVED) {
+        return false;
+      }
+      break;
+
+    case HOST_OP_POOL_FREE:
+      if (slot->kind != HOST_SLOT_POOL) {
+        return false;
+      }
+      break;
+
+    default:
+      host_fail("unknown operation", NULL);
+      break;
+  }
+
+  start = host_time_ns();
+  switch (op->type) {
+    case HOST_OP_ALLOC:
+      status = sl_memory_alloc_advanced(op->size, op->align, op->block_type, &ptr);
+      break;
+
+    case HOST_OP_MALLOC:
+      ptr = sl_malloc(op->size);
+      status = (ptr != NULL) ? SL_STATUS_OK : SL_STATUS_ALLOCATION_FAILED;
+      break;
+
+    case HOST_OP_REALLOC:
+      status = sl_memory_realloc(slot->ptr, op->size, &ptr);
+      break;
+
+    case HOST_OP_FREE:
+      status = sl_memory_free(slot->ptr);
+      break;
+
+    case HOST_OP_RESERVE:
+      status = sl_memory_reserve_block(op->size, op->align, &slot->reservation, &ptr);
+      break;
+
+    case HOST_OP_RELEASE:
+      status = sl_memory_release_block(&slot->reservation);
+      break;
+
+    case HOST_OP_POOL_ALLOC:
+      status = sl_memory_pool_alloc(&host_pools[op->pool], &ptr);
+      break;
+
+    case HOST_OP_POOL_FREE:
+      status = sl_memory_pool_free(&host_pools[slot->pool], slot->ptr);
+      break;
+
+    case HOST_OP_POOL_CREATE:
+      status = sl_memory_create_pool(op->size,
+                                     SL_MAX((op->count * host_pool_scale) / 100u, 1u),
+                                     &host_pools[op->pool]);
+      break;
+
+    case HOST_OP_POOL_DELETE:
+      status = sl_memory_delete_pool(&host_pools[op->pool]);
+      break;
+
+    default:
+      break;
+  }
+  host_latency_add(op->type, host_time_ns() - start);
+
+  if (status != SL_STATUS_OK) {
+    // A pool is not deleted while blocks are allocated from it, which only
+    // happens when a recorder stream lost events.
+    switch (op->type) {
+      case HOST_OP_FREE:
+      case HOST_OP_RELEASE:
+      case HOST_OP_POOL_FREE:
+        host_fail("free of a live block failed", slot->ptr);
+        break;
+
+      default:
+        host_latency[op->type].failure_count++;
+        break;
+    }
+    return false;
+  }
+
+  switch (op->type) {
+    case HOST_OP_POOL_CREATE:
+    case HOST_OP_POOL_DELETE:
+      host_pool_live[op->pool] = (op->type == HOST_OP_POOL_CREATE);
+      break;
+
+    case HOST_OP_ALLOC:
+    case HOST_OP_MALLOC:
+    case HOST_OP_RESERVE:
+    case HOST_OP_POOL_ALLOC:
+      if ((op->type != HOST_OP_POOL_ALLOC)
+          && (((uintptr_t)ptr % ((op->align == SL_MEMORY_BLOCK_ALIGN_DEFAULT) ? SLI_WORD_SIZE_64 : op->align)) != 0)) {
+        host_fail("block not aligned as requested", ptr);
+      }
+      slot->kind = ((op->type == HOST_OP_ALLOC) || (op->type == HOST_OP_MALLOC)) ? HOST_SLOT_BLOCK
+                   : (op->type == HOST_OP_RESERVE) ? HOST_SLOT_RESERVED : HOST_SLOT_POOL;
+      slot->pool = op->pool;
+      slot->ptr = ptr;
+      slot->size = (op->type == HOST_OP_POOL_ALLOC) ? host_pools[op->pool].block_size : op->size;
+      slot->pattern = (uint8_t)(op->id * 37u + host_step);
+      host_slot_fill(slot, 0);
+      break;
+
+    case HOST_OP_REALLOC:
+      slot->ptr = ptr;
+      if (op->size > slot->size) {
+        size_t old_size = slot->size;
+
+        slot->size = op->size;
+        host_slot_fill(slot, old_size);
+      } else {
+        slot->size = op->size;
+      }
+      break;
+
+    default:
+      slot->kind = HOST_SLOT_EMPTY;
+      slot->ptr = NULL;
+      slot->size = 0;
+      break;
+  }
+
+  return true;
+}
+
+/***************************************************************************//**
+ * Runs one operation and the checks that follow it.
+ ******************************************************************************/
+static void host_step_run(const host_op_t *op, FILE *trace_out)
+{
+  if (trace_out != NULL) {
+    switch (op->type) {
+      case HOST_OP_ALLOC:
+        fprintf(trace_out, "a %" PRIu32 " %zu %zu %s\n", op->id, op->size,
+                (op->align == SL_MEMORY_BLOCK_ALIGN_DEFAULT) ? 0u : op->align,
+                (op->block_type == BLOCK_TYPE_LONG_TERM) ? "lt" : "st");
+        break;
+
+      case HOST_OP_MALLOC:
+        fprintf(trace_out, "m %" PRIu32 " %zu\n", op->id, op->size);
+        break;
+
+      case HOST_OP_REALLOC:
+        fprintf(trace_out, "r %" PRIu32 " %zu\n", op->id, op->size);
+        break;
+
+      case HOST_OP_RESERVE:
+        fprintf(trace_out, "v %" PRIu32 " %zu %zu\n", op->id, op->size,
+                (op->align == SL_MEMORY_BLOCK_ALIGN_DEFAULT) ? 0u : op->align);
+        break;
+
+      case HOST_OP_POOL_ALLOC:
+        fprintf(trace_out, "p %" PRIu32 " %" PRIu32 "\n", op->id, op->pool);
+        break;
+
+      case HOST_OP_POOL_CREATE:
+        fprintf(trace_out, "c %" PRIu32 " %zu %zu\n", op->pool, op->size, op->count);
+        break;
+
+      case HOST_OP_POOL_DELETE:
+        fprintf(trace_out, "d %" PRIu32 "\n", op->pool);
+        break;
+
+      default:
+        fprintf(trace_out, "%c %" PRIu32 "\n", "a?f?x?q"[op->type], op->id);
+        break;
+    }
+  }
+
+  host_apply(op);
+  host_sample_heap();
+  if (host_check_every_step) {
+    host_check_heap();
+  }
+  host_step++;
+}
+
+/***************************************************************************//**
+ * Runs the synthetic workload: mixed long-term and short-term blocks, some
+ * with a larger alignment, reallocations, reservations and pool blocks.
+ ******************************************************************************/
+static void host_run_synthetic(uint32_t step_count, FILE *trace_out)
+{
+  host_op_t pool_op = {
+    .type = HOST_OP_POOL_CREATE,
+    .size = HOST_POOL_BLOCK_SIZE,
+    .count = HOST_POOL_BLOCK_COUNT,
+  };
+
+  host_step_run(&pool_op, trace_out);
+
+  for (uint32_t i = 0; i < step_count; i++) {
+    uint32_t draw = (uint32_t)rand() % 20u;
+    host_op_t op = { 0 };
+
+    op.align = SL_MEMORY_BLOCK_ALIGN_DEFAULT;
+    op.block_type = BLOCK_TYPE_LONG_TERM;
+
+    if (draw < 8u) {
+      op.id = (uint32_t)rand() % HOST_SYNTHETIC_BLOCK_COUNT;
+      op.type = (host_slots[op.id].kind == HOST_SLOT_EMPTY) ? HOST_OP_ALLOC : HOST_OP_FREE;
+      // Mostly small blocks with a tail of larger ones.
+      op.size = 1u + ((uint32_t)rand() % (((rand() % 8) != 0) ? 64u : 600u));
+      if ((rand() % 5) == 0) {
+        op.align = (size_t)16u << ((uint32_t)rand() % 4u);
+      }
+      if ((rand() % 2) == 0) {
+        op.block_type = BLOCK_TYPE_SHORT_TERM;
+      }
+      // Half of the default long-term blocks go through sl_malloc(), which
+      // serves the small ones from the size-class pools when they are enabled.
+      if ((op.type == HOST_OP_ALLOC) && (op.align == SL_MEMORY_BLOCK_ALIGN_DEFAULT)
+          && (op.block_type == BLOCK_TYPE_LONG_TERM) && ((op.id % 2u) == 0)) {
+        op.type = HOST_OP_MALLOC;
+      }
+    } else if (draw < 14u) {
+      op.id = (uint32_t)rand() % HOST_SYNTHETIC_BLOCK_COUNT;
+      op.type = HOST_OP_FREE;
+    } else if (draw < 17u) {
+      op.id = (uint32_t)rand() % HOST_SYNTHETIC_BLOCK_COUNT;
+      op.type = HOST_OP_REALLOC;
+      op.size = 1u + ((uint32_t)rand() % 300u);
+    } else if (draw < 18u) {
+      op.id = HOST_SYNTHETIC_BLOCK_COUNT + ((uint32_t)rand() % HOST_SYNTHETIC_RESERVE_COUNT);
+      op.type = (host_slots[op.id].kind == HOST_SLOT_EMPTY) ? HOST_OP_RESERVE : HOST_OP_RELEASE;
+      op.size = 8u + ((uint32_t)rand() % 400u);
+    } else {
+      op.id = HOST_SYNTHETIC_BLOCK_COUNT + HOST_SYNTHETIC_RESERVE_COUNT
+              + ((uint32_t)rand() % HOST_SYNTHETIC_POOL_COUNT);
+      op.type = (host_slots[op.id].kind == HOST_SLOT_EMPTY) ? HOST_OP_POOL_ALLOC : HOST_OP_POOL_FREE;
+    }
+
+    host_step_run(&op, trace_out);
+  }
+}
+
+/***************************************************************************//**
+ * Parses one line of a text trace.
+ *
+ * @return  true if the line holds an operation.
+ ******************************************************************************/
+static bool host_parse_line(const char *line, size_t line_number, host_op_t *op)
+{
+  char code;
+  char type[3] = { 0 };
+  int count;
+
+  memset(op, 0, sizeof(*op));
+  op->align = SL_MEMORY_BLOCK_ALIGN_DEFAULT;
+  op->block_type = BLOCK_TYPE_LONG_TERM;
+
+  if (sscanf(line, " %c", &code) != 1 || code == '#') {
+    return false;
+  }
+
+  switch (code) {
+    case 'a':
+      op->type = HOST_OP_ALLOC;
+      count = sscanf(line, " a %" SCNu32 " %zu %zu %2s", &op->id, &op->size, &op->align, type);
+      if ((count == 4) && (strcmp(type, "st") == 0)) {
+        op->block_type = BLOCK_TYPE_SHORT_TERM;
+      }
+      count = (count >= 3) ? 1 : 0;
+      break;
+
+    case 'm':
+      op->type = HOST_OP_MALLOC;
+      count = (sscanf(line, " m %" SCNu32 " %zu", &op->id, &op->size) == 2) ? 1 : 0;
+      break;
+
+    case 'r':
+      op->type = HOST_OP_REALLOC;
+      count = (sscanf(line, " r %" SCNu32 " %zu", &op->id, &op->size) == 2) ? 1 : 0;
+      break;
+
+    case 'v':
+      op->type = HOST_OP_RESERVE;
+      count = (sscanf(line, " v %" SCNu32 " %zu %zu", &op->id, &op->size, &op->align) >= 2) ? 1 : 0;
+      break;
+
+    case 'c':
+      op->type = HOST_OP_POOL_CREATE;
+      count = (sscanf(line, " c %" SCNu32 " %zu %zu", &op->pool, &op->size, &op->count) == 3) ? 1 : 0;
+      break;
+
+    case 'd':
+      op->type = HOST_OP_POOL_DELETE;
+      count = sscanf(line, " d %" SCNu32, &op->pool);
+      break;
+
+    case 'p':
+      op->type = HOST_OP_POOL_ALLOC;
+      count = (sscanf(line, " p %" SCNu32 " %" SCNu32, &op->id, &op->pool) >= 1) ? 1 : 0;
+      break;
+
+    case 'f':
+    case 'x':
+    case 'q':
+      op->type = (code == 'f') ? HOST_OP_FREE
+                 : (code == 'x') ? HOST_OP_RELEASE : HOST_OP_POOL_FREE;
+      count = sscanf(line + 1, " %" SCNu32, &op->id);
+      break;
+
+    default:
+      count = 0;
+      break;
+  }
+
+  if (op->align == 0) {
+    op->align = SL_MEMORY_BLOCK_ALIGN_DEFAULT;
+  }
+
+  if (count != 1) {
+    fprintf(stderr, "line %zu: %s", line_number, line);
+    host_fail("invalid trace line", NULL);
+  }
+  return true;
+}
+
+/***************************************************************************//**
+ * Replays a text trace.
+ ******************************************************************************/
+static void host_run_trace(const char *path)
+{
+  char line[HOST_LINE_LEN_MAX];
+  size_t line_number = 0;
+  host_op_t op;
+  FILE *file = fopen(path, "r");
+
+  if (file == NULL) {
+    perror(path);
+    exit(EXIT_FAILURE);
+  }
+
+  while (fgets(line, sizeof(line), file) != NULL) {
+    line_number++;
+    if (host_parse_line(line, line_number, &op)) {
+      host_step_run(&op, NULL);
+    }
+  }
+
+  fclose(file);
+}
+
+/***************************************************************************//**
+ * Replays a stream of the allocation trace recorder.
+ ******************************************************************************/
+static void host_run_recorder(const char *path, const host_recorder_trackers_t *trackers)
+{
+  host_recorder_stats_t stats;
+  host_op_t *ops;
+  size_t op_count = host_recorder_read(path, trackers, &ops, &stats);
+
+  printf("%zu records: %zu events lost on the device, %zu failed allocations, "
+         "%zu records of unknown blocks, %zu records of other trackers\n",
+         stats.record_count, stats.dropped_count, stats.failed_count,
+         stats.unmatched_count, stats.ignored_count);
+
+  for (size_t i = 0; i < op_count; i++) {
+    host_step_run(&ops[i], NULL);
+  }
+
+  free(ops);
+}
+
+/***************************************************************************//**
+ * Frees all the blocks and deletes all the pools left by the workload,
+ * including the size-class pools of sl_malloc().
+ ******************************************************************************/
+static void host_drain(void)
+{
+  static const host_op_type_t free_ops[] = {
+    [HOST_SLOT_BLOCK] = HOST_OP_FREE,
+    [HOST_SLOT_RESERVED] = HOST_OP_RELEASE,
+    [HOST_SLOT_POOL] = HOST_OP_POOL_FREE,
+  };
+
+  for (uint32_t id = 0; id < HOST_SLOT_COUNT; id++) {
+    if (host_slots[id].kind != HOST_SLOT_EMPTY) {
+      host_op_t op = { .type = free_ops[host_slots[id].kind], .id = id };
+
+      host_step_run(&op, NULL);
+    }
+  }
+
+  for (uint32_t pool = 0; pool < HOST_POOL_COUNT; pool++) {
+    if (host_pool_live[pool]) {
+      host_op_t op = { .type = HOST_OP_POOL_DELETE, .pool = pool };
+
+      host_step_run(&op, NULL);
+      if (host_pool_live[pool]) {
+        host_fail("cannot delete a pool after freeing its blocks", NULL);
+      }
+    }
+  }
+
+#if defined(SLI_MEMORY_MANAGER_SIZE_CLASS_POOLS)
+  if (sli_memory_size_class_delete_pools() != SL_STATUS_OK) {
+    host_fail("cannot delete the size-class pools after freeing their blocks", NULL);
+  }
+#endif
+}
+
+/***************************************************************************//**
+ * Compares two latency samples for qsort().
+ ******************************************************************************/
+static int host_compare_samples(const void *a, const void *b)
+{
+  uint32_t sample_a = *(const uint32_t *)a;
+  uint32_t sample_b = *(const uint32_t *)b;
+
+  return (sample_a > sample_b) - (sample_a < sample_b);
+}
+
+/***************************************************************************//**
+ * Prints the latency percentiles, the peak fragmentation and the high
+ * watermark.
+ ******************************************************************************/
+static void host_report(void)
+{
+  printf("%-11s %9s %7s %7s %7s %7s %7s %8s\n",
+         "operation", "count", "p50 ns", "p90 ns", "p99 ns", "p99.9", "max ns", "failed");
+
+  for (uint32_t type = 0; type < HOST_OP_COUNT; type++) {
+    host_latency_t *latency = &host_latency[type];
+    size_t n = latency->count;
+
+    if (n == 0) {
+      continue;
+    }
+    qsort(latency->samples, n, sizeof(uint32_t), host_compare_samples);
+    printf("%-11s %9zu %7" PRIu32 " %7" PRIu32 " %7" PRIu32 " %7" PRIu32 " %7" PRIu32 " %8" PRIu32 "\n",
+           host_op_names[type], n,
+           latency->samples[(n * 50u) / 100u],
+           latency->samples[(n * 90u) / 100u],
+           latency->samples[(n * 99u) / 100u],
+           latency->samples[(n * 999u) / 1000u],
+           latency->samples[n - 1u],
+           latency->failure_count);
+  }
+
+  printf("peak fragmentation: %.1f%% at step %zu (%zu bytes free)\n",
+         host_fragmentation_peak * 100.0, host_fragmentation_peak_step, host_fragmentation_peak_free_size);
+  printf("high watermark: %zu of %zu bytes (highest used size seen: %zu)\n",
+         sl_memory_get_heap_high_watermark(), sl_memory_get_total_heap_size(), host_used_size_max);
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Gets size and location of the heap: the region allocated by the host tool.
+ ******************************************************************************/
+sl_memory_region_t sl_memory_get_heap_region(void)
+{
+  sl_memory_region_t region;
+
+  region.addr = host_heap_addr;
+  region.size = host_heap_size;
+  return region;
+}
+
+/***************************************************************************//**
+ * Runs the stress test or the trace replay.
+ ******************************************************************************/
+int main(int argc, char *argv[])
+{
+  uint32_t seed = 1u;
+  uint32_t step_count = HOST_STEP_COUNT_DEFAULT;
+  const char *trace_out_path = NULL;
+  FILE *trace_out = NULL;
+  bool recorder_stream = false;
+  host_recorder_trackers_t trackers = { 0 };
+  size_t initial_used_size;
+  int option;
+
+  while ((option = getopt(argc, argv, "s:n:H:o:qbt:P:")) != -1) {
+    switch (option) {
+      case 's':
+        seed = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'n':
+        step_count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'H':
+        host_heap_size = SLI_ALIGN_ROUND_DOWN((size_t)strtoul(optarg, NULL, 0), (size_t)SLI_WORD_SIZE_64);
+        break;
+
+      case 'o':
+        trace_out_path = optarg;
+        break;
+
+      case 'q':
+        host_check_every_step = false;
+        break;
+
+      case 'b':
+        recorder_stream = true;
+        break;
+
+      case 't':
+        if (sscanf(optarg, "%" SCNx32 ":%" SCNx32 ":%" SCNx32,
+                   &trackers.heap, &trackers.malloc_lt, &trackers.malloc_st) != 3) {
+          fprintf(stderr, "invalid tracker handles: %s\n", optarg);
+          return EXIT_FAILURE;
+        }
+        break;
+
+      case 'P':
+        host_pool_scale = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      default:
+        fprintf(stderr, "usage: %s [-s seed] [-n steps] [-H heap_size] [-o trace_out] [-q] "
+                        "[-b -t heap:lt:st] [-P pool_percent] [trace_file]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+  }
+
+  if (recorder_stream && ((optind >= argc) || (trackers.heap == 0))) {
+    fprintf(stderr, "a recorder stream needs a trace file and the tracker handles (-t)\n");
+    return EXIT_FAILURE;
+  }
+
+  host_heap_addr = aligned_alloc(HOST_HEAP_ADDR_ALIGN, SLI_ALIGN_ROUND_UP(host_heap_size, HOST_HEAP_ADDR_ALIGN));
+  if (host_heap_addr == NULL) {
+    host_fail("cannot allocate the heap region", NULL);
+  }
+
+  sl_memory_init();
+  initial_used_size = sl_memory_get_used_heap_size();
+  host_check_heap();
+
+  if (recorder_stream) {
+    host_run_recorder(argv[optind], &trackers);
+  } else if (optind < argc) {
+    host_run_trace(argv[optind]);
+  } else {
+    if (trace_out_path != NULL) {
+      trace_out = fopen(trace_out_path, "w");
+      if (trace_out == NULL) {
+        perror(trace_out_path);
+        return EXIT_FAILURE;
+      }
+    }
+    srand(seed);
+    host_run_synthetic(step_count, trace_out);
+    if (trace_out != NULL) {
+      fclose(trace_out);
+    }
+  }
+
+  // Latencies and fragmentation are reported for the workload only.
+  host_report();
+  if (sl_memory_get_heap_high_watermark() < host_used_size_max) {
+    host_fail("high watermark lower than the used size", NULL);
+  }
+
+  host_check_every_step = true;
+  host_drain();
+  if (sl_memory_get_used_heap_size() != initial_used_size) {
+    fprintf(stderr, "used size %zu, initially %zu\n", sl_memory_get_used_heap_size(), initial_used_size);
+    host_fail("heap not back to its initial usage after freeing all the blocks", NULL);
+  }
+  if (sli_general_purpose_heap.free_blocks_number != 1u) {
+    host_fail("free blocks not merged back after freeing all the blocks", NULL);
+  }
+
+  printf("%zu steps ok\n", host_step);
+  return EXIT_SUCCESS;
+}
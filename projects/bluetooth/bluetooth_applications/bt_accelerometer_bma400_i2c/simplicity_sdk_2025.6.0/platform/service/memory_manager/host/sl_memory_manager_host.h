@@ -0,0 +1,105 @@
+/***************************************************************************//**
+ * @file
+ * @brief Shared definitions of the Memory Manager host tool
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_MEMORY_MANAGER_HOST_H
+#define SL_MEMORY_MANAGER_HOST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sl_memory_manager.h"
+
+// Number of block identifiers usable in a trace.
+#define HOST_SLOT_COUNT  4096u
+
+// Number of pools usable in a trace.
+#define HOST_POOL_COUNT  16u
+
+typedef enum {
+  HOST_OP_ALLOC,
+  HOST_OP_REALLOC,
+  HOST_OP_FREE,
+  HOST_OP_RESERVE,
+  HOST_OP_RELEASE,
+  HOST_OP_POOL_ALLOC,
+  HOST_OP_POOL_FREE,
+  HOST_OP_POOL_CREATE,
+  HOST_OP_POOL_DELETE,
+  HOST_OP_MALLOC,
+  HOST_OP_COUNT
+} host_op_type_t;
+
+// One operation of a workload.
+typedef struct {
+  host_op_type_t type;
+  uint32_t id;                        // Block identifier
+  uint32_t pool;                      // Pool identifier
+  size_t size;                        // Block size
+  size_t align;                       // Block alignment
+  size_t count;                       // Pool block count
+  sl_memory_block_type_t block_type;
+} host_op_t;
+
+// Tracker handles of the heap records, from the symbol table of the image
+// that recorded the trace.
+typedef struct {
+  uint32_t heap;                      // sli_mm_heap_name
+  uint32_t malloc_lt;                 // sli_mm_heap_malloc_lt_name
+  uint32_t malloc_st;                 // sli_mm_heap_malloc_st_name
+} host_recorder_trackers_t;
+
+// Records of a recorder stream that could not be replayed.
+typedef struct {
+  size_t record_count;                // Records read
+  size_t dropped_count;               // Events lost on the device
+  size_t failed_count;                // Allocations that failed on the device
+  size_t unmatched_count;             // Records about unknown blocks
+  size_t ignored_count;               // Records of other trackers
+} host_recorder_stats_t;
+
+/***************************************************************************//**
+ * Converts a stream of the allocation trace recorder to workload operations.
+ *
+ * @param[in]  path      Path of the binary recorder stream.
+ * @param[in]  trackers  Tracker handles of the heap records.
+ * @param[out] ops       Receives the operations, to be freed by the caller.
+ * @param[out] stats     Receives the records that could not be converted.
+ *
+ * @return  Number of operations.
+ *
+ * @note The recorder does not keep the alignment of the allocations, so all
+ *       blocks are allocated with the default alignment.
+ ******************************************************************************/
+size_t host_recorder_read(const char *path,
+                          const host_recorder_trackers_t *trackers,
+                          host_op_t **ops,
+                          host_recorder_stats_t *stats);
+
+#endif // SL_MEMORY_MANAGER_HOST_H
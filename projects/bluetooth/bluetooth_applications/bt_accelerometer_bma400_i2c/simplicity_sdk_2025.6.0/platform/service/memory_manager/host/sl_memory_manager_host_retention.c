@@ -0,0 +1,402 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the Memory Manager RAM retention shrinking
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Checks the RAM banks released in EM2 by the RAM retention shrinking.
+ *
+ * The RAM is a buffer laid out as the BGM220PC22HNA RAM, see em_device.h, and
+ * the heap is its last HOST_HEAP_SIZE bytes. A fixed scenario then a random
+ * workload of long-term and short-term blocks is run. After each step, the
+ * mask of the released banks is compared with a reference computed from a
+ * byte map of the heap, both for the device banks and for a layout of smaller
+ * banks, where a free bank can sit between two allocated blocks.
+ *
+ * Usage: sl_memory_manager_host_retention [-s seed] [-n steps]
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "em_device.h"
+#include "sl_hal_syscfg.h"
+#include "sl_power_manager.h"
+#include "sl_memory_manager.h"
+#include "sl_memory_manager_region.h"
+#include "sli_memory_manager.h"
+
+#if !defined(SLI_MEMORY_MANAGER_RAM_RETENTION_SHRINK)
+#error "The retention test requires SL_MEMORY_MANAGER_RAM_RETENTION_SHRINK_ENABLE."
+#endif
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+#define HOST_RAM_ADDR_ALIGN      4096u
+
+// Static data and stack below the heap, half of bank 0.
+#define HOST_HEAP_OFFSET         0x4000u
+#define HOST_HEAP_SIZE           (SRAM_SIZE - HOST_HEAP_OFFSET)
+
+#define HOST_SMALL_BANK_SIZE     0x1000u
+#define HOST_SMALL_BANK_COUNT    (SRAM_SIZE / HOST_SMALL_BANK_SIZE)
+
+#define HOST_STEP_COUNT_DEFAULT  20000u
+#define HOST_BLOCK_COUNT         48u
+#define HOST_BLOCK_SIZE_MAX      2048u
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+static const uint32_t host_device_bank_size[DMEM_NUM_BANKS] = {
+  DMEM_BANK0_SIZE,
+  DMEM_BANK1_SIZE,
+};
+
+static uint32_t host_small_bank_size[HOST_SMALL_BANK_COUNT];
+
+static uint8_t *host_ram;
+static const sl_power_manager_em_transition_event_info_t *host_em_event_info;
+static size_t host_step;
+
+// Set if the heap byte at the same offset must be retained.
+static bool host_retained[HOST_HEAP_SIZE];
+
+/*******************************************************************************
+ ***************************  GLOBAL VARIABLES   *******************************
+ ******************************************************************************/
+
+uintptr_t host_sram_base;
+
+uint32_t host_dmem0retnctrl;
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Reports an error and exits.
+ ******************************************************************************/
+static void host_fail(const char *what, uint32_t mask, uint32_t expected)
+{
+  fprintf(stderr, "FAIL at step %zu: %s: mask 0x%02x, expected 0x%02x\n",
+          host_step, what, (unsigned)mask, (unsigned)expected);
+  exit(EXIT_FAILURE);
+}
+
+/***************************************************************************//**
+ * Computes the released banks from a byte map of the heap: all the bytes are
+ * retained except the free block data payload after the free list links, and
+ * the blocks reserved without retention.
+ ******************************************************************************/
+static uint32_t host_reference_mask(const uint32_t *bank_size, uint32_t bank_count)
+{
+  const sl_memory_heap_t *heap = &sli_general_purpose_heap;
+  const sli_block_metadata_t *block = sli_memory_get_first_block(heap);
+  size_t bank_start = 0;
+  uint32_t mask = 0;
+
+  memset(host_retained, true, sizeof(host_retained));
+  while (true) {
+    if (block->block_in_use == 0) {
+      size_t offset = (size_t)((const uint8_t *)block - (const uint8_t *)heap->base_addr)
+                      + SLI_BLOCK_METADATA_SIZE_BYTE;
+      size_t len = SLI_BLOCK_LEN_DWORD_TO_BYTE(sli_block_len_dword_decode(block));
+#if defined(SLI_MEMORY_MANAGER_FREE_BINS)
+      offset += sizeof(sli_free_block_link_t);
+      len = (len > sizeof(sli_free_block_link_t)) ? (len - sizeof(sli_free_block_link_t)) : 0;
+#endif
+      memset(&host_retained[offset], false, len);
+    }
+    if (sli_block_offset_next_dword_decode(block) == 0) {
+      break;
+    }
+    block = (const sli_block_metadata_t *)((const uint64_t *)block + sli_block_offset_next_dword_decode(block));
+  }
+  memset(&host_retained[HOST_HEAP_SIZE - reserve_no_retention_size], false, reserve_no_retention_size);
+
+  for (uint32_t bank = 0; bank < bank_count; bank++) {
+    size_t bank_end = bank_start + bank_size[bank];
+    bool is_released = (bank > 0) && (bank_size[bank] != 0) && (bank_start >= HOST_HEAP_OFFSET);
+
+    for (size_t addr = bank_start; is_released && (addr < bank_end); addr++) {
+      is_released = !host_retained[addr - HOST_HEAP_OFFSET];
+    }
+    if (is_released) {
+      mask |= (1UL << bank);
+    }
+    bank_start = bank_end;
+  }
+
+  return mask;
+}
+
+/***************************************************************************//**
+ * Checks the released banks against the reference, for both bank layouts.
+ * Checks them against the expected device banks too, unless expected is -1.
+ ******************************************************************************/
+static void host_check(const char *what, int32_t expected)
+{
+  uint32_t mask = sl_memory_get_unretained_ram_bank_mask();
+  uint32_t reference = host_reference_mask(host_device_bank_size, DMEM_NUM_BANKS);
+  uint32_t small_mask;
+  uint32_t small_reference;
+
+  if (mask != reference) {
+    host_fail(what, mask, reference);
+  }
+  if ((expected >= 0) && (mask != (uint32_t)expected)) {
+    host_fail(what, mask, (uint32_t)expected);
+  }
+
+  small_mask = sli_memory_get_unretained_bank_mask(&sli_general_purpose_heap,
+                                                   host_sram_base,
+                                                   host_small_bank_size,
+                                                   HOST_SMALL_BANK_COUNT);
+  small_reference = host_reference_mask(host_small_bank_size, HOST_SMALL_BANK_COUNT);
+  if (small_mask != small_reference) {
+    host_fail(what, small_mask, small_reference);
+  }
+  host_step++;
+}
+
+/***************************************************************************//**
+ * Allocates a block or exits.
+ ******************************************************************************/
+static void *host_alloc(size_t size, sl_memory_block_type_t type)
+{
+  void *block;
+
+  if (sl_memory_alloc(size, type, &block) != SL_STATUS_OK) {
+    fprintf(stderr, "FAIL at step %zu: cannot allocate %zu bytes\n", host_step, size);
+    exit(EXIT_FAILURE);
+  }
+  return block;
+}
+
+/***************************************************************************//**
+ * Runs the energy mode transitions through the Power Manager subscription and
+ * checks the retention control register.
+ ******************************************************************************/
+static void host_check_em2(void)
+{
+  uint32_t mask = sl_memory_get_unretained_ram_bank_mask();
+
+  host_dmem0retnctrl = 0;
+  host_em_event_info->on_event(SL_POWER_MANAGER_EM0, SL_POWER_MANAGER_EM2);
+  if (host_dmem0retnctrl != mask) {
+    host_fail("retention control in EM2", host_dmem0retnctrl, mask);
+  }
+  host_em_event_info->on_event(SL_POWER_MANAGER_EM2, SL_POWER_MANAGER_EM0);
+  if (host_dmem0retnctrl != 0) {
+    host_fail("retention control after EM2", host_dmem0retnctrl, 0);
+  }
+}
+
+/***************************************************************************//**
+ * Runs the fixed scenario.
+ *
+ * @note (1) Short-term blocks are allocated from the heap end, in bank 1.
+ *
+ * @note (2) With the small banks, the short-term block only keeps the last
+ *           bank retained, and the banks between it and the long-term block
+ *           are released.
+ ******************************************************************************/
+static void host_run_scenario(void)
+{
+  void *lt;
+  void *st;
+  void *large;
+  void *reserved;
+  sl_memory_reservation_t reservation;
+  uint32_t small_mask;
+
+  host_check("empty heap", 0x2);
+  host_check_em2();
+
+  lt = host_alloc(1024u, BLOCK_TYPE_LONG_TERM);
+  host_check("long-term block in bank 0", 0x2);
+
+  // See Note #1.
+  st = host_alloc(64u, BLOCK_TYPE_SHORT_TERM);
+  host_check("short-term block in bank 1", 0x0);
+  host_check_em2();
+
+  // See Note #2.
+  small_mask = sli_memory_get_unretained_bank_mask(&sli_general_purpose_heap,
+                                                   host_sram_base,
+                                                   host_small_bank_size,
+                                                   HOST_SMALL_BANK_COUNT);
+  if (small_mask != 0x60) {
+    host_fail("free small banks between two blocks", small_mask, 0x60);
+  }
+
+  sl_memory_free(st);
+  host_check("short-term block freed", 0x2);
+
+  large = host_alloc(9u * 1024u, BLOCK_TYPE_LONG_TERM);
+  host_check("long-term block across banks 0 and 1", 0x0);
+  sl_memory_free(large);
+  host_check("long-term block across banks freed", 0x2);
+
+  if (sl_memory_reserve_block(256u, SL_MEMORY_BLOCK_ALIGN_DEFAULT, &reservation, &reserved) != SL_STATUS_OK) {
+    host_fail("reserve a block", 0, 0);
+  }
+  host_check("reserved block", -1);
+  sl_memory_release_block(&reservation);
+  host_check("reserved block released", 0x2);
+
+  sl_memory_free(lt);
+  host_check("long-term block freed", 0x2);
+
+  // The reservation without retention sits after the last free block payload.
+  if (sl_memory_reserve_no_retention(1024u, SL_MEMORY_BLOCK_ALIGN_DEFAULT, &reserved) != SL_STATUS_OK) {
+    host_fail("reserve a block without retention", 0, 0);
+  }
+  host_check("block reserved without retention", 0x2);
+  host_check_em2();
+
+  st = host_alloc(64u, BLOCK_TYPE_SHORT_TERM);
+  host_check("short-term block below the reservation", 0x0);
+  sl_memory_free(st);
+  host_check("short-term block below the reservation freed", 0x2);
+}
+
+/***************************************************************************//**
+ * Runs a random workload of long-term and short-term blocks.
+ ******************************************************************************/
+static void host_run_random(uint32_t step_count)
+{
+  void *blocks[HOST_BLOCK_COUNT] = { NULL };
+
+  for (uint32_t step = 0; step < step_count; step++) {
+    uint32_t index = (uint32_t)rand() % HOST_BLOCK_COUNT;
+
+    if (blocks[index] != NULL) {
+      sl_memory_free(blocks[index]);
+      blocks[index] = NULL;
+    } else {
+      size_t size = 1u + ((size_t)rand() % HOST_BLOCK_SIZE_MAX);
+      sl_memory_block_type_t type = ((rand() & 1) != 0) ? BLOCK_TYPE_LONG_TERM : BLOCK_TYPE_SHORT_TERM;
+
+      if (sl_memory_alloc(size, type, &blocks[index]) != SL_STATUS_OK) {
+        blocks[index] = NULL;
+      }
+    }
+    host_check("random workload", -1);
+  }
+
+  for (uint32_t index = 0; index < HOST_BLOCK_COUNT; index++) {
+    sl_memory_free(blocks[index]);
+  }
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Gets size and location of the heap: the end of the RAM buffer.
+ ******************************************************************************/
+sl_memory_region_t sl_memory_get_heap_region(void)
+{
+  sl_memory_region_t region;
+
+  region.addr = host_ram + HOST_HEAP_OFFSET;
+  region.size = HOST_HEAP_SIZE;
+  return region;
+}
+
+/***************************************************************************//**
+ * Subscribes to the energy mode transitions, delivered by the host tool.
+ ******************************************************************************/
+void sl_power_manager_subscribe_em_transition_event(sl_power_manager_em_transition_event_handle_t *event_handle,
+                                                    const sl_power_manager_em_transition_event_info_t *event_info)
+{
+  event_handle->info = event_info;
+  host_em_event_info = event_info;
+}
+
+/***************************************************************************//**
+ * Runs the retention test.
+ ******************************************************************************/
+int main(int argc, char *argv[])
+{
+  uint32_t seed = 1u;
+  uint32_t step_count = HOST_STEP_COUNT_DEFAULT;
+  int option;
+
+  while ((option = getopt(argc, argv, "s:n:")) != -1) {
+    switch (option) {
+      case 's':
+        seed = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'n':
+        step_count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      default:
+        fprintf(stderr, "usage: %s [-s seed] [-n steps]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+  }
+
+  for (uint32_t bank = 0; bank < HOST_SMALL_BANK_COUNT; bank++) {
+    host_small_bank_size[bank] = HOST_SMALL_BANK_SIZE;
+  }
+
+  host_ram = aligned_alloc(HOST_RAM_ADDR_ALIGN, SRAM_SIZE);
+  if (host_ram == NULL) {
+    fprintf(stderr, "cannot allocate the RAM buffer\n");
+    return EXIT_FAILURE;
+  }
+  host_sram_base = (uintptr_t)host_ram;
+
+  sl_memory_init();
+  sl_memory_ram_retention_init();
+  if (host_em_event_info == NULL) {
+    fprintf(stderr, "no energy mode transition subscription\n");
+    return EXIT_FAILURE;
+  }
+
+  host_run_scenario();
+  srand(seed);
+  host_run_random(step_count);
+  host_check("all blocks freed", 0x2);
+
+  printf("%zu retention checks ok\n", host_step);
+  return EXIT_SUCCESS;
+}
@@ -57,6 +57,7 @@ extern "C" {
  *   - A dynamic allocation API
  *   - A memory pool API
  *   - A dynamic reservation API
+ *   - A memory arena API
  *
  * The Memory Manager can be used in an RTOS context as it is thread-safe by
  * protecting adequately its internal shared resources.
@@ -115,6 +116,8 @@ extern "C" {
  *   - Creating and deleting memory pools. Allocating and freeing fixed-size
  * blocks from a given pool.
  *   - Reserving and releasing blocks.
+ *   - Creating memory arenas, allocating from them and freeing all their
+ * allocations at once.
  *   - Getting statistics about the heap usage and the stack.
  *   - Retargeting the standard C library memory functions malloc()/free()/
  * calloc()/realloc() to the Memory Manager ones.
@@ -408,6 +411,59 @@ extern "C" {
  * }
  * @endcode
  *
+ * ### Memory Arena
+ *
+ * The memory arena API allows to:
+ *   - Create an arena backed by a single reserved block: sl_memory_arena_create().
+ *   - Destroy an arena and release its block: sl_memory_arena_destroy().
+ *   - Get a block of any size and alignment from the arena: sl_memory_arena_alloc().
+ *   - Free all the blocks of the arena at once: sl_memory_arena_reset().
+ *
+ * Memory arenas are convenient for a group of allocations that share the same
+ * lifetime, for example the state of a connection or of a transaction. An arena
+ * block is taken by moving a pointer forward in the reserved block, so it has no
+ * metadata and no search cost. Arena blocks cannot be freed individually: the
+ * whole arena is emptied in one step with sl_memory_arena_reset().
+ * The function sl_memory_arena_get_high_watermark() returns the highest number
+ * of bytes used in the arena, which helps to size the arena.
+ *
+ * The memory arena API uses an arena handle of type
+ * @ref sl_memory_arena_t "sl_memory_arena_t{}" provided by the caller, in the
+ * same way as the memory pool handle.
+ *
+ * The following code snippet shows a typical memory arena API sequence:
+ * @code{.c}
+ * uint8_t *ptr8;
+ * sl_status_t status;
+ * sl_memory_arena_t arena1_handle = { 0 };
+ *
+ * status = sl_memory_arena_create(512, &arena1_handle);
+ * if (status != SL_STATUS_OK) {
+ *   // Process the error condition.
+ * }
+ *
+ * status = sl_memory_arena_alloc(&arena1_handle,
+ *                                100,
+ *                                SL_MEMORY_BLOCK_ALIGN_DEFAULT,
+ *                                (void **)&ptr8);
+ * if (status != SL_STATUS_OK) {
+ *   // Process the error condition.
+ * }
+ *
+ * memset(ptr8, 0xFF, 100);
+ *
+ * // Free all the blocks allocated from the arena.
+ * status = sl_memory_arena_reset(&arena1_handle);
+ * if (status != SL_STATUS_OK) {
+ *   // Process the error condition.
+ * }
+ *
+ * status = sl_memory_arena_destroy(&arena1_handle);
+ * if (status != SL_STATUS_OK) {
+ *   // Process the error condition.
+ * }
+ * @endcode
+ *
  * \subsubsection subsubsection-statistics Statistics
  *
  * As your code is allocating and freeing blocks, you may want to know at a certain
@@ -434,6 +490,41 @@ extern "C" {
  * stack and/or heap, simply call respectively the function sl_memory_get_stack_region()
  * and/or sl_memory_get_heap_region().
  *
+ * When SL_STACK_HIGH_WATERMARK_ENABLE is 1, the unused stack is painted with a
+ * known pattern at startup and sl_memory_get_stack_high_watermark() returns the
+ * highest number of stack bytes used since then. Use it on a device running its
+ * most demanding scenarios to size SL_STACK_SIZE: the heap extends over the
+ * RAM left unused, so the bytes removed from the stack are given to the heap.
+ * When SL_STACK_GUARD_SIZE is not 0, the bottom of the stack is also made
+ * read-only with the MPU, so that a stack overflow triggers a fault instead of
+ * silently corrupting memory.
+ *
+ * A heap corruption, for instance a buffer overflow that overwrites the metadata
+ * of the next block, may go unnoticed until much later. The function
+ * sl_memory_check_heap_integrity_step() checks the metadata of a given number of
+ * blocks per call and resumes where the previous call stopped, so that the whole
+ * heap is checked over several calls at a bounded cost per call. It can be
+ * called from the main loop. The check restarts from the heap start each time a
+ * block is allocated, freed or reserved in between. When
+ * SL_MEMORY_MANAGER_HEAP_CHECK_SLEEP_BLOCK_COUNT is not 0, a check step also
+ * runs each time the Power Manager is about to put the system to sleep. When a
+ * corrupted block is found and the memory profiler is enabled, a log event
+ * with the block address and the return address of the code that allocated it
+ * is sent to the memory profiler, followed by a snapshot. The return addresses
+ * are recorded at allocation time in a table of
+ * SL_MEMORY_MANAGER_HEAP_CHECK_OWNER_COUNT entries.
+ *
+ * Sleep current in EM2 grows with the amount of retained RAM. When
+ * SL_MEMORY_MANAGER_RAM_RETENTION_SHRINK_ENABLE is 1, the heap RAM banks that
+ * hold no allocated block, no block metadata and no reserved block are not
+ * retained each time the device enters EM2. A bank that only holds the data
+ * payload of free blocks is released wherever it sits in the heap, so a
+ * short-term block allocated from the heap end only keeps its own bank
+ * retained. Blocks allocated with sl_memory_reserve_no_retention() are never
+ * retained. Call sl_memory_ram_retention_init() once after the Power Manager
+ * initialization, and sl_memory_get_unretained_ram_bank_mask() to know which
+ * banks are released.
+ *
  * ### C/C++ Toolchains Standard Memory Functions Retarget/Overload
  *
  * A program can perform dynamic memory allocations and deallocations using the
@@ -633,6 +724,20 @@ typedef struct sl_memory_pool {
   size_t block_size;                   ///< Size of each block.
 } sl_memory_pool_t;
 
+/// @brief Memory arena handle.
+typedef struct {
+  sl_memory_reservation_t reservation; ///< Reserved block backing the arena.
+  size_t used_size;                    ///< Bytes used from the start of the reserved block.
+  size_t high_watermark;               ///< Highest value of used_size.
+} sl_memory_arena_t;
+
+/// @brief Incremental heap integrity check state.
+typedef struct {
+  void *cursor;                        ///< Metadata of the next block to check. NULL to start from the heap start.
+  uint32_t pass_count;                 ///< Number of complete passes over the heap without corruption.
+  void *corrupted_block;               ///< First corrupted block found, NULL if none.
+} sl_memory_heap_check_t;
+
 // ----------------------------------------------------------------------------
 // PROTOTYPES
 
@@ -988,6 +1093,90 @@ uint32_t sl_memory_pool_get_free_block_count(const sl_memory_pool_t *pool_handle
  ******************************************************************************/
 uint32_t sl_memory_pool_get_used_block_count(const sl_memory_pool_t *pool_handle);
 
+/***************************************************************************//**
+ * Creates a memory arena in the general purpose heap.
+ *
+ * @param[in] size          Size of the arena, in bytes.
+ * @param[in] arena_handle  Handle to the memory arena.
+ *
+ * @note  This function assumes the 'arena_handle' is provided by the caller,
+ *        for example as a global variable.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_memory_arena_create(size_t size,
+                                   sl_memory_arena_t *arena_handle);
+
+/***************************************************************************//**
+ * Destroys a memory arena and releases its reserved block.
+ *
+ * @param[in] arena_handle  Handle to the memory arena.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ *
+ * @note All the blocks allocated from the arena become invalid.
+ ******************************************************************************/
+sl_status_t sl_memory_arena_destroy(sl_memory_arena_t *arena_handle);
+
+/***************************************************************************//**
+ * Allocates a block from a memory arena.
+ *
+ * @param[in]  arena_handle  Handle to the memory arena.
+ * @param[in]  size          Size of the block, in bytes.
+ * @param[in]  align         Required alignment for the block, in bytes.
+ * @param[out] block         Pointer to a variable that will receive the address
+ *                           of the allocated block. NULL in case of error
+ *                           condition.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ *
+ * @note  Required alignment of memory block (in bytes) MUST be a power of 2
+ *        and can range from 1 to 512 bytes.
+ *        The define SL_MEMORY_BLOCK_ALIGN_DEFAULT can be specified to select
+ *        the default alignment.
+ ******************************************************************************/
+sl_status_t sl_memory_arena_alloc(sl_memory_arena_t *arena_handle,
+                                  size_t size,
+                                  size_t align,
+                                  void **block);
+
+/***************************************************************************//**
+ * Frees all the blocks allocated from a memory arena.
+ *
+ * @param[in] arena_handle  Handle to the memory arena.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ *
+ * @note The high watermark of the arena is kept.
+ ******************************************************************************/
+sl_status_t sl_memory_arena_reset(sl_memory_arena_t *arena_handle);
+
+/***************************************************************************//**
+ * Gets the number of bytes currently used in a memory arena, including the
+ * alignment padding between blocks.
+ *
+ * @param[in] arena_handle  Handle to the memory arena.
+ *
+ * @return  Used size in bytes.
+ ******************************************************************************/
+size_t sl_memory_arena_get_used_size(const sl_memory_arena_t *arena_handle);
+
+/***************************************************************************//**
+ * Gets the highest number of bytes used in a memory arena.
+ *
+ * @param[in] arena_handle  Handle to the memory arena.
+ *
+ * @return  High watermark in bytes.
+ ******************************************************************************/
+size_t sl_memory_arena_get_high_watermark(const sl_memory_arena_t *arena_handle);
+
+/***************************************************************************//**
+ * Resets the high watermark of a memory arena to its current used size.
+ *
+ * @param[in] arena_handle  Handle to the memory arena.
+ ******************************************************************************/
+void sl_memory_arena_reset_high_watermark(sl_memory_arena_t *arena_handle);
+
 /***************************************************************************//**
  * Populates an sl_memory_heap_info_t{} structure with the current status of
  * the heap.
@@ -1032,6 +1221,46 @@ size_t sl_memory_get_heap_high_watermark(void);
  ******************************************************************************/
 void sl_memory_reset_heap_high_watermark(void);
 
+/***************************************************************************//**
+ * Checks the integrity of the next blocks of the heap.
+ *
+ * @param[in]  block_count      Maximum number of blocks to check.
+ * @param[out] corrupted_block  Pointer to variable that will receive the
+ *                              address of the first corrupted block, as
+ *                              returned to the code that allocated it. Can be
+ *                              NULL.
+ *
+ * @return  SL_STATUS_OK if no corruption was found so far.
+ *          SL_STATUS_FAIL if a corrupted block was found.
+ *
+ * @note Each call checks up to 'block_count' blocks, in a critical section,
+ *       starting where the previous call stopped. The check restarts from the
+ *       heap start if the heap blocks changed since the previous call.
+ *       Once a corrupted block is found, this function returns it without
+ *       checking the heap again.
+ ******************************************************************************/
+sl_status_t sl_memory_check_heap_integrity_step(size_t block_count,
+                                                void **corrupted_block);
+
+/***************************************************************************//**
+ * Initializes the automatic RAM retention shrinking.
+ *
+ * @note Subscribes to the Power Manager energy mode transitions. Must be called
+ *       after the Power Manager initialization. Does nothing unless
+ *       SL_MEMORY_MANAGER_RAM_RETENTION_SHRINK_ENABLE is 1.
+ ******************************************************************************/
+void sl_memory_ram_retention_init(void);
+
+/***************************************************************************//**
+ * Gets the RAM banks that are not retained in EM2 given the current heap
+ * usage.
+ *
+ * @return  Bit mask of the RAM banks, bit n for bank n, as written in the RAM
+ *          retention control register. 0 if
+ *          SL_MEMORY_MANAGER_RAM_RETENTION_SHRINK_ENABLE is 0.
+ ******************************************************************************/
+uint32_t sl_memory_get_unretained_ram_bank_mask(void);
+
 /***************************************************************************//**
  * Allocates a memory block from a specific heap instance.
  *
@@ -1177,6 +1406,46 @@ sl_status_t sl_memory_heap_create_pool(sl_memory_heap_t *heap,
                                        uint32_t block_count,
                                        sl_memory_pool_t *pool_handle);
 
+/***************************************************************************//**
+ * Creates a memory arena from a specific heap instance.
+ *
+ * @param[in] heap          Handle to the heap instance.
+ * @param[in] size          Size of the arena, in bytes.
+ * @param[in] arena_handle  Handle to the memory arena.
+ *
+ * @note  This function assumes the 'arena_handle' is provided by the caller,
+ *        for example as a global variable.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_memory_heap_create_arena(sl_memory_heap_t *heap,
+                                        size_t size,
+                                        sl_memory_arena_t *arena_handle);
+
+/***************************************************************************//**
+ * Checks the integrity of the next blocks of a specific heap instance.
+ *
+ * @param[in]  heap             Handle to the heap instance.
+ * @param[in]  check_handle     Handle to the check state. Must be zeroed
+ *                              before the first call.
+ * @param[in]  block_count      Maximum number of blocks to check.
+ * @param[out] corrupted_block  Pointer to variable that will receive the
+ *                              address of the first corrupted block. Can be
+ *                              NULL.
+ *
+ * @return  SL_STATUS_OK if no corruption was found so far.
+ *          SL_STATUS_FAIL if a corrupted block was found.
+ *
+ * @note The check restarts from the heap start if the heap blocks changed, or
+ *       if another check handle ran a step on the heap, since the previous
+ *       call. Steps with several check handles interleaved on the same heap
+ *       never complete a pass.
+ ******************************************************************************/
+sl_status_t sl_memory_heap_check_integrity_step(sl_memory_heap_t *heap,
+                                                sl_memory_heap_check_t *check_handle,
+                                                size_t block_count,
+                                                void **corrupted_block);
+
 /** @} (end addtogroup memory_manager) */
 
 #ifdef __cplusplus
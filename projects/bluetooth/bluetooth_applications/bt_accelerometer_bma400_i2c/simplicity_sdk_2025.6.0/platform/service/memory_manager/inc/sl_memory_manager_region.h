@@ -68,6 +68,26 @@ sl_memory_region_t sl_memory_get_stack_region(void);
  ******************************************************************************/
 sl_memory_region_t sl_memory_get_heap_region(void);
 
+/***************************************************************************//**
+ * Gets the highest number of stack bytes used since startup or since the last
+ * call to sl_memory_reset_stack_high_watermark().
+ *
+ * @return  Stack high watermark in bytes. 0 if SL_STACK_HIGH_WATERMARK_ENABLE
+ *          is 0.
+ *
+ * @note The stack is painted with a known pattern and the high watermark is
+ *       the distance from the top of the stack to the lowest word that no
+ *       longer holds the pattern. A local variable that is never written
+ *       does not count as used, so keep a margin when sizing the stack.
+ ******************************************************************************/
+size_t sl_memory_get_stack_high_watermark(void);
+
+/***************************************************************************//**
+ * Resets the stack high watermark by painting again the stack below the
+ * current stack pointer.
+ ******************************************************************************/
+void sl_memory_reset_stack_high_watermark(void);
+
 /** @} end addtogroup memory_manager) */
 
 #ifdef __cplusplus
@@ -0,0 +1,134 @@
+/***************************************************************************//**
+ * @file
+ * @brief Allocation trace recorder behind the memory profiler stubs
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SLI_MEMORY_PROFILER_TRACE_H
+#define SLI_MEMORY_PROFILER_TRACE_H
+
+#include <stdint.h>
+#include "sl_status.h"
+#include "sl_iostream.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @cond DO_NOT_INCLUDE_WITH_DOXYGEN
+
+/***************************************************************************//**
+ * @addtogroup memory_profiler_trace Memory Profiler Trace Recorder
+ * @{
+ *
+ * @brief Allocation trace recorder for offline replay
+ *
+ * When `SL_MEMORY_MANAGER_TRACE_RECORDER_ENABLE` is set and the Memory
+ * Profiler component is not included, the Memory Profiler stub functions
+ * record every tracking call as a fixed-size binary record in a RAM ring
+ * buffer. The application periodically calls
+ * @ref sli_memory_profiler_trace_drain() from thread context to write the
+ * pending records to an I/O stream.
+ *
+ * The stream is a plain sequence of @ref sli_memory_profiler_trace_record_t in
+ * little-endian byte order. The tracker field holds the tracker handle, which
+ * is the address of an object in the application image. A host tool resolves
+ * it through the ELF symbol table, e.g. `sli_mm_heap_name` identifies the
+ * heap-level records that carry the full block including metadata, while
+ * `sli_mm_heap_malloc_lt_name` and `sli_mm_heap_malloc_st_name` carry the
+ * size requested by the caller. Replaying the heap-level and pool records
+ * against a host build of the Memory Manager allows evaluating other heap
+ * sizes, pool counts and `SL_MEMORY_MANAGER_BLOCK_ALLOCATION_MIN_SIZE` values
+ * with a field workload. The host tool in `platform/service/memory_manager/host`
+ * does this replay.
+ *
+ * Records are never overwritten. While the ring buffer is full, new events are
+ * counted and reported with a single @ref SLI_MEMORY_PROFILER_TRACE_OP_DROPPED
+ * record as soon as there is room again.
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// Defines
+
+/// Bit position of the operation in the op_size field of a record
+#define SLI_MEMORY_PROFILER_TRACE_OP_SHIFT   24u
+
+/// Mask of the size in the op_size field of a record. Larger sizes saturate.
+#define SLI_MEMORY_PROFILER_TRACE_SIZE_MASK  0x00FFFFFFu
+
+// -----------------------------------------------------------------------------
+// Typedefs
+
+/// Operations stored in a trace record. Values are part of the stream format.
+typedef enum {
+  SLI_MEMORY_PROFILER_TRACE_OP_POOL_TRACKER = 0x01, ///< Pool tracker created: address, size
+  SLI_MEMORY_PROFILER_TRACE_OP_DELETE_TRACKER = 0x02, ///< Tracker deleted
+  SLI_MEMORY_PROFILER_TRACE_OP_ALLOC = 0x03,        ///< Allocation: address (0 if failed), size, pc
+  SLI_MEMORY_PROFILER_TRACE_OP_REALLOC = 0x04,      ///< Reallocation: new address, size, original address in pc
+  SLI_MEMORY_PROFILER_TRACE_OP_FREE = 0x05,         ///< Free: address
+  SLI_MEMORY_PROFILER_TRACE_OP_OWNERSHIP = 0x06,    ///< Ownership of address taken at pc
+  SLI_MEMORY_PROFILER_TRACE_OP_LOG = 0x07,          ///< Generic log: log identifier in tracker, arg1 in address, arg2 in size, pc
+  SLI_MEMORY_PROFILER_TRACE_OP_DROPPED = 0x7F,      ///< Number of events lost in size
+} sli_memory_profiler_trace_op_t;
+
+/// Binary trace record, 20 bytes
+typedef struct {
+  uint32_t tick;      ///< Sleeptimer tick count when the event was recorded
+  uint32_t tracker;   ///< Tracker handle
+  uint32_t address;   ///< Block address
+  uint32_t pc;        ///< Return address of the caller, 0 if not known
+  uint32_t op_size;   ///< Operation in the upper 8 bits, size in the lower 24 bits
+} sli_memory_profiler_trace_record_t;
+
+// -----------------------------------------------------------------------------
+// Prototypes
+
+/***************************************************************************//**
+ * Writes the pending trace records to an I/O stream.
+ *
+ * @param[in] stream  I/O stream to write to, or SL_IOSTREAM_STDOUT for the
+ *                    default stream.
+ *
+ * @return  SL_STATUS_OK if all pending records were written,
+ *          SL_STATUS_NOT_AVAILABLE if the trace recorder is disabled,
+ *          or the error returned by the stream. Records that could not be
+ *          written are kept for the next call.
+ *
+ * @note This function must not be called from interrupt context, nor
+ *       concurrently from several threads.
+ ******************************************************************************/
+sl_status_t sli_memory_profiler_trace_drain(sl_iostream_t *stream);
+
+/** @} (end addtogroup memory_profiler_trace) */
+
+/// @endcond
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SLI_MEMORY_PROFILER_TRACE_H
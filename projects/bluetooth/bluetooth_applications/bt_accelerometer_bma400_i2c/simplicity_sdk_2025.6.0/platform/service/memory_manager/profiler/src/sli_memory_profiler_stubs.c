@@ -29,8 +29,87 @@
  ******************************************************************************/
 
 #include "sli_memory_profiler.h"
+#include "sli_memory_profiler_trace.h"
+#include "sl_memory_manager_config.h"
 #include "sl_status.h"
 
+#if defined(SL_MEMORY_MANAGER_TRACE_RECORDER_ENABLE) && (SL_MEMORY_MANAGER_TRACE_RECORDER_ENABLE == 1)
+#include "sl_core.h"
+#include "sl_sleeptimer.h"
+
+#define TRACE_RECORDER_PRESENT
+
+// Ring buffer of trace records. Producers only add records at trace_head and
+// the single consumer only removes them at trace_tail, so the consumer can
+// write the records from the ring buffer without holding a critical section.
+static sli_memory_profiler_trace_record_t trace_ring[SL_MEMORY_MANAGER_TRACE_RECORDER_RECORD_COUNT];
+static uint32_t trace_head;
+static uint32_t trace_tail;
+static uint32_t trace_used;
+static uint32_t trace_dropped;
+
+/* Store one record in the ring buffer, which must have room for it */
+static void trace_store(uint32_t tick,
+                        sli_memory_tracker_handle_t tracker_handle,
+                        const void *ptr,
+                        size_t size,
+                        const void *pc,
+                        sli_memory_profiler_trace_op_t op)
+{
+  sli_memory_profiler_trace_record_t *record;
+
+  if (size > SLI_MEMORY_PROFILER_TRACE_SIZE_MASK) {
+    size = SLI_MEMORY_PROFILER_TRACE_SIZE_MASK;
+  }
+
+  record = &trace_ring[trace_head];
+  record->tick = tick;
+  record->tracker = (uint32_t)(uintptr_t)tracker_handle;
+  record->address = (uint32_t)(uintptr_t)ptr;
+  record->pc = (uint32_t)(uintptr_t)pc;
+  record->op_size = ((uint32_t)op << SLI_MEMORY_PROFILER_TRACE_OP_SHIFT) | (uint32_t)size;
+
+  trace_head++;
+  if (trace_head == SL_MEMORY_MANAGER_TRACE_RECORDER_RECORD_COUNT) {
+    trace_head = 0;
+  }
+  trace_used++;
+}
+
+/* Record one tracking event */
+static void trace_record(sli_memory_profiler_trace_op_t op,
+                         sli_memory_tracker_handle_t tracker_handle,
+                         const void *ptr,
+                         size_t size,
+                         const void *pc)
+{
+  uint32_t tick = sl_sleeptimer_get_tick_count();
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  if (trace_dropped != 0) {
+    // Report the lost events before anything else, so that a replay knows
+    // that the trace has a gap.
+    if (trace_used <= (SL_MEMORY_MANAGER_TRACE_RECORDER_RECORD_COUNT - 2u)) {
+      trace_store(tick, NULL, NULL, trace_dropped, NULL, SLI_MEMORY_PROFILER_TRACE_OP_DROPPED);
+      trace_dropped = 0;
+    }
+  }
+
+  if ((trace_dropped == 0) && (trace_used < SL_MEMORY_MANAGER_TRACE_RECORDER_RECORD_COUNT)) {
+    trace_store(tick, tracker_handle, ptr, size, pc, op);
+  } else {
+    trace_dropped++;
+  }
+  CORE_EXIT_ATOMIC();
+}
+
+#define TRACE_RECORD(op, tracker_handle, ptr, size, pc) \
+  trace_record((op), (tracker_handle), (ptr), (size), (pc))
+#else
+#define TRACE_RECORD(op, tracker_handle, ptr, size, pc)
+#endif
+
 /* Create a memory tracker */
 sl_status_t sli_memory_profiler_create_tracker(sli_memory_tracker_handle_t tracker_handle,
                                                const char *description)
@@ -51,6 +130,7 @@ sl_status_t sli_memory_profiler_create_pool_tracker(sli_memory_tracker_handle_t
   (void) description;
   (void) ptr;
   (void) size;
+  TRACE_RECORD(SLI_MEMORY_PROFILER_TRACE_OP_POOL_TRACKER, tracker_handle, ptr, size, NULL);
   return SL_STATUS_NOT_AVAILABLE;
 }
 
@@ -66,6 +146,7 @@ void sli_memory_profiler_describe_tracker(sli_memory_tracker_handle_t tracker_ha
 void sli_memory_profiler_delete_tracker(sli_memory_tracker_handle_t tracker_handle)
 {
   (void) tracker_handle;
+  TRACE_RECORD(SLI_MEMORY_PROFILER_TRACE_OP_DELETE_TRACKER, tracker_handle, NULL, 0, NULL);
 }
 
 /* Track the allocation of a memory block */
@@ -74,6 +155,20 @@ void sli_memory_profiler_track_alloc(sli_memory_tracker_handle_t tracker_handle,
   (void) tracker_handle;
   (void) ptr;
   (void) size;
+  TRACE_RECORD(SLI_MEMORY_PROFILER_TRACE_OP_ALLOC, tracker_handle, ptr, size, NULL);
+}
+
+/* Track the reallocation of a previously allocated memory block */
+void sli_memory_profiler_track_realloc(sli_memory_tracker_handle_t tracker_handle,
+                                       void * ptr,
+                                       void * realloced_ptr,
+                                       size_t size)
+{
+  (void) tracker_handle;
+  (void) ptr;
+  (void) realloced_ptr;
+  (void) size;
+  TRACE_RECORD(SLI_MEMORY_PROFILER_TRACE_OP_REALLOC, tracker_handle, realloced_ptr, size, ptr);
 }
 
 /* Track the allocation of a memory block and record ownership */
@@ -86,6 +181,7 @@ void sli_memory_profiler_track_alloc_with_ownership(sli_memory_tracker_handle_t
   (void) ptr;
   (void) size;
   (void) pc;
+  TRACE_RECORD(SLI_MEMORY_PROFILER_TRACE_OP_ALLOC, tracker_handle, ptr, size, pc);
 }
 
 /* Track the freeing of a memory block */
@@ -93,6 +189,7 @@ void sli_memory_profiler_track_free(sli_memory_tracker_handle_t tracker_handle,
 {
   (void) tracker_handle;
   (void) ptr;
+  TRACE_RECORD(SLI_MEMORY_PROFILER_TRACE_OP_FREE, tracker_handle, ptr, 0, NULL);
 }
 
 /* Track the transfer of memory allocation ownership */
@@ -103,6 +200,7 @@ void sli_memory_profiler_track_ownership(sli_memory_tracker_handle_t tracker_han
   (void) tracker_handle;
   (void) ptr;
   (void) pc;
+  TRACE_RECORD(SLI_MEMORY_PROFILER_TRACE_OP_OWNERSHIP, tracker_handle, ptr, 0, pc);
 }
 
 /* Trigger the creation of a snapshot of the current state */
@@ -123,4 +221,47 @@ void sli_memory_profiler_log(uint32_t log_id,
   (void) arg2;
   (void) arg3;
   (void) pc;
+  TRACE_RECORD(SLI_MEMORY_PROFILER_TRACE_OP_LOG, (sli_memory_tracker_handle_t)(uintptr_t)log_id, (void *)(uintptr_t)arg1, arg2, pc);
+}
+
+/* Write the pending trace records to an I/O stream */
+sl_status_t sli_memory_profiler_trace_drain(sl_iostream_t *stream)
+{
+#if defined(TRACE_RECORDER_PRESENT)
+  sl_status_t status = SL_STATUS_OK;
+  uint32_t tail = trace_tail;
+  uint32_t count;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  count = trace_used;
+  CORE_EXIT_ATOMIC();
+
+  while ((count != 0) && (status == SL_STATUS_OK)) {
+    // Write the contiguous part up to the end of the ring buffer first
+    uint32_t chunk = SL_MEMORY_MANAGER_TRACE_RECORDER_RECORD_COUNT - tail;
+    if (chunk > count) {
+      chunk = count;
+    }
+
+    status = sl_iostream_write(stream, &trace_ring[tail], chunk * sizeof(trace_ring[0]));
+    if (status == SL_STATUS_OK) {
+      tail += chunk;
+      if (tail == SL_MEMORY_MANAGER_TRACE_RECORDER_RECORD_COUNT) {
+        tail = 0;
+      }
+      count -= chunk;
+
+      CORE_ENTER_ATOMIC();
+      trace_tail = tail;
+      trace_used -= chunk;
+      CORE_EXIT_ATOMIC();
+    }
+  }
+
+  return status;
+#else
+  (void) stream;
+  return SL_STATUS_NOT_AVAILABLE;
+#endif
 }
@@ -0,0 +1,268 @@
+/***************************************************************************//**
+ * @file
+ * @brief Memory Manager Driver's Memory Arena Feature Implementation.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sl_memory_manager.h"
+#include "sli_memory_manager.h"
+
+#include "sl_assert.h"
+#include "sl_bit.h"
+#include "sl_core.h"
+
+#if defined(SL_COMPONENT_CATALOG_PRESENT)
+#include "sl_component_catalog.h"
+#endif
+
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
+#include "sli_memory_profiler.h"
+#endif
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Creates a memory arena.
+ ******************************************************************************/
+sl_status_t sl_memory_arena_create(size_t size,
+                                   sl_memory_arena_t *arena_handle)
+{
+  return sl_memory_heap_create_arena(&sli_general_purpose_heap, size, arena_handle);
+}
+
+/***************************************************************************//**
+ * Destroys a memory arena.
+ *
+ * @note The arena_handle provided is not freed. It can be reused in a new call
+ *       to sl_memory_arena_create() to create another arena.
+ ******************************************************************************/
+sl_status_t sl_memory_arena_destroy(sl_memory_arena_t *arena_handle)
+{
+  if (arena_handle == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
+  // Delete the memory tracker
+  sli_memory_profiler_delete_tracker(arena_handle);
+#endif
+
+  arena_handle->used_size = 0;
+
+  return sl_memory_release_block(&arena_handle->reservation);
+}
+
+/***************************************************************************//**
+ * Allocates a block from a memory arena.
+ *
+ * @note The block is taken right after the last allocated block, after any
+ *       padding required by the alignment. The padding is computed on the
+ *       block address so that the reserved block alignment does not matter.
+ ******************************************************************************/
+sl_status_t sl_memory_arena_alloc(sl_memory_arena_t *arena_handle,
+                                  size_t size,
+                                  size_t align,
+                                  void **block)
+{
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
+  void * volatile return_address = sli_memory_profiler_get_return_address();
+#endif
+  size_t block_align = (align == SL_MEMORY_BLOCK_ALIGN_DEFAULT) ? SLI_BLOCK_ALLOC_MIN_ALIGN : align;
+  uintptr_t base_addr;
+  uintptr_t block_addr;
+  size_t used_size;
+  CORE_DECLARE_IRQ_STATE;
+
+  // Check proper alignment characteristics.
+  EFM_ASSERT((align == SL_MEMORY_BLOCK_ALIGN_DEFAULT)
+             || (SL_MATH_IS_PWR2(align)
+                 && (align <= SL_MEMORY_BLOCK_ALIGN_512_BYTES)));
+
+  if ((arena_handle == NULL) || (block == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  // No block allocated yet.
+  *block = NULL;
+
+  if (size == 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  base_addr = (uintptr_t)arena_handle->reservation.block_address;
+
+  CORE_ENTER_ATOMIC();
+
+  block_addr = SLI_ALIGN_ROUND_UP(base_addr + arena_handle->used_size, block_align);
+  used_size = (size_t)(block_addr - base_addr);
+
+  if ((used_size > arena_handle->reservation.block_size)
+      || (size > (arena_handle->reservation.block_size - used_size))) {
+    CORE_EXIT_ATOMIC();
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
+    sli_memory_profiler_track_alloc_with_ownership(arena_handle, NULL, size, return_address);
+#endif
+    return SL_STATUS_ALLOCATION_FAILED;
+  }
+
+  used_size += size;
+  arena_handle->used_size = used_size;
+  if (used_size > arena_handle->high_watermark) {
+    arena_handle->high_watermark = used_size;
+  }
+
+  CORE_EXIT_ATOMIC();
+
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
+  sli_memory_profiler_track_alloc_with_ownership(arena_handle, (void *)block_addr, size, return_address);
+#endif
+
+  *block = (void *)block_addr;
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Frees all the blocks allocated from a memory arena.
+ ******************************************************************************/
+sl_status_t sl_memory_arena_reset(sl_memory_arena_t *arena_handle)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if (arena_handle == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
+  // Blocks are not freed individually, so start over with a new tracker.
+  sli_memory_profiler_delete_tracker(arena_handle);
+  sli_memory_profiler_create_pool_tracker(arena_handle,
+                                          NULL,
+                                          arena_handle->reservation.block_address,
+                                          arena_handle->reservation.block_size);
+#endif
+
+  CORE_ENTER_ATOMIC();
+  arena_handle->used_size = 0;
+  CORE_EXIT_ATOMIC();
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Gets the number of bytes currently used in a memory arena.
+ ******************************************************************************/
+size_t sl_memory_arena_get_used_size(const sl_memory_arena_t *arena_handle)
+{
+  if (arena_handle == NULL) {
+    return 0;
+  }
+
+  return arena_handle->used_size;
+}
+
+/***************************************************************************//**
+ * Gets the highest number of bytes used in a memory arena.
+ ******************************************************************************/
+size_t sl_memory_arena_get_high_watermark(const sl_memory_arena_t *arena_handle)
+{
+  if (arena_handle == NULL) {
+    return 0;
+  }
+
+  return arena_handle->high_watermark;
+}
+
+/***************************************************************************//**
+ * Resets the high watermark of a memory arena.
+ ******************************************************************************/
+void sl_memory_arena_reset_high_watermark(sl_memory_arena_t *arena_handle)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if (arena_handle == NULL) {
+    return;
+  }
+
+  CORE_ENTER_ATOMIC();
+  arena_handle->high_watermark = arena_handle->used_size;
+  CORE_EXIT_ATOMIC();
+}
+
+/***************************************************************************//**
+ * Creates a memory arena from a specific heap instance.
+ ******************************************************************************/
+sl_status_t sl_memory_heap_create_arena(sl_memory_heap_t *heap,
+                                        size_t size,
+                                        sl_memory_arena_t *arena_handle)
+{
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
+  void * volatile return_address = sli_memory_profiler_get_return_address();
+#endif
+  sl_status_t status;
+  void *block = NULL;
+
+  // Make sure the heap handle isn't NULL.
+  EFM_ASSERT(heap != NULL);
+
+  if (arena_handle == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  if (size == 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  // The whole arena resides in one reserved block, so that freeing every
+  // arena allocation is only a matter of rewinding the used size.
+  status = sl_memory_heap_reserve_block(heap,
+                                        size,
+                                        SL_MEMORY_BLOCK_ALIGN_DEFAULT,
+                                        &arena_handle->reservation,
+                                        &block);
+
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
+  sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, block, return_address);
+#endif
+
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
+  // Create the tracker for the arena with no description. The code that
+  // created the arena can add the tracker description if relevant.
+  sli_memory_profiler_create_pool_tracker(arena_handle, NULL, block, arena_handle->reservation.block_size);
+#endif
+
+  arena_handle->used_size = 0;
+  arena_handle->high_watermark = 0;
+
+  return status;
+}
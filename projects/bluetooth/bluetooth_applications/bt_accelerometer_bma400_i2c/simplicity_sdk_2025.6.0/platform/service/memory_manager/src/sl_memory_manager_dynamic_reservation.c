@@ -46,7 +46,7 @@
 #include "sl_component_catalog.h"
 #endif
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
 #include "sli_memory_profiler.h"
 #endif
 
@@ -104,14 +104,15 @@ sl_status_t sl_memory_release_block(sl_memory_reservation_t *handle)
 
   free_lt_list_head = (sli_block_metadata_t *)heap->free_lt_list_head;
   free_st_list_head = (sli_block_metadata_t *)heap->free_st_list_head;
-  current_metadata = (sli_block_metadata_t *)heap->base_addr;
+  current_metadata = sli_memory_get_first_block(heap);
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_free(sli_mm_heap_name, handle->block_address);
 #endif
 
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_ATOMIC();
+  sli_memory_increment_heap_generation();
 
   // Find neighbours by searching from the heap start. See Note #1.
   while ((uintptr_t)current_metadata < (uintptr_t)handle->block_address) {
@@ -140,8 +141,14 @@ sl_status_t sl_memory_release_block(sl_memory_reservation_t *handle)
     // |...|Metadata Free block|Data Free block|R1||
     if ((prev_block->block_in_use == 0) && (reserved_block_offset < SLI_BLOCK_RESERVATION_MIN_SIZE_DWORD)) {
       // New freed block's previous block is free, so merge both free blocks.
+      FREE_BINS_REMOVE(heap, prev_block);
       new_free_block = prev_block;
-      prev_block = (sli_block_metadata_t *)((uint64_t *)prev_block - sli_block_offset_prev_dword_decode(prev_block));
+      if (sli_block_offset_prev_dword_decode(prev_block) != 0) {
+        prev_block = (sli_block_metadata_t *)((uint64_t *)prev_block - sli_block_offset_prev_dword_decode(prev_block));
+      } else {
+        // Merged block is at the heap start.
+        prev_block = NULL;
+      }
       new_free_block_length += sli_block_len_dword_decode(new_free_block) + SLI_BLOCK_METADATA_SIZE_DWORD;
     } else {
       // Create a new free block, because previous block is a dynamic allocation, a reserved block or the start of the heap.
@@ -163,6 +170,7 @@ sl_status_t sl_memory_release_block(sl_memory_reservation_t *handle)
     // Make sure there's no reserved block between the freed block and the next block.
     if ((next_block->block_in_use == 0) && (reserved_block_offset < SLI_BLOCK_RESERVATION_MIN_SIZE_DWORD)) {
       // New freed block's following block is free, so merge both free blocks.
+      FREE_BINS_REMOVE(heap, next_block);
       new_free_block_length += sli_block_len_dword_decode(next_block) + reserved_block_offset + SLI_BLOCK_METADATA_SIZE_DWORD;
       // Invalidate the next block metadata.
       sli_block_len_dword_encode(next_block, 0);
@@ -201,7 +209,6 @@ sl_status_t sl_memory_release_block(sl_memory_reservation_t *handle)
     // Heap start.
     sli_block_offset_prev_dword_encode(new_free_block, 0);
   }
-
   if (free_lt_list_head == NULL             // LT list is empty. Freed block becomes the new 1st element.
       || free_lt_list_head > new_free_block // LT list not empty. Verify if freed block becomes the head.
       || sli_block_len_dword_decode(free_lt_list_head) == 0) {
@@ -216,6 +223,8 @@ sl_status_t sl_memory_release_block(sl_memory_reservation_t *handle)
   // Update the heap's head pointers.
   heap->free_lt_list_head = (void *)free_lt_list_head;
   heap->free_st_list_head = (void *)free_st_list_head;
+  // Links are written in the free payload, so only insert once the merged metadata has been inspected.
+  FREE_BINS_INSERT(heap, new_free_block);
 
 #if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
   // Decrease heap usage statistic.
@@ -240,13 +249,13 @@ sl_status_t sl_memory_release_block(sl_memory_reservation_t *handle)
  ******************************************************************************/
 sl_status_t sl_memory_reservation_handle_alloc(sl_memory_reservation_t **handle)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   sl_status_t status;
 
   status = sl_memory_alloc(sizeof(sl_memory_reservation_t), BLOCK_TYPE_LONG_TERM, (void**)handle);
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, *handle, return_address);
 #endif
   if (status != SL_STATUS_OK) {
@@ -294,7 +303,7 @@ sl_status_t sl_memory_heap_reserve_block(sl_memory_heap_t *heap,
                                          sl_memory_reservation_t *handle,
                                          void **block)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
 
@@ -346,13 +355,14 @@ sl_status_t sl_memory_heap_reserve_block(sl_memory_heap_t *heap,
 
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_ATOMIC();
+  sli_memory_increment_heap_generation();
 
 // For block reservations, the size_adjusted contains the metadata.
   size_adjusted = sli_memory_find_free_block(heap, size_real, block_align, BLOCK_TYPE_SHORT_TERM, true, &free_block_metadata);
 
   if ((free_block_metadata == NULL) || (size_adjusted == 0)) {
     CORE_EXIT_ATOMIC();
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
     sli_memory_profiler_track_alloc_with_ownership(sli_mm_heap_name, NULL, size, return_address);
 #endif
     return SL_STATUS_ALLOCATION_FAILED;
@@ -362,6 +372,7 @@ sl_status_t sl_memory_heap_reserve_block(sl_memory_heap_t *heap,
   // SLI_BLOCK_METADATA_SIZE_BYTE is added to the free block length to get the real remaining size as size_adjusted contains the metadata size.
   block_size_remaining = (current_block_len + SLI_BLOCK_METADATA_SIZE_BYTE) - size_adjusted;
 
+  FREE_BINS_REMOVE(heap, free_block_metadata);
   heap->free_blocks_number--;
 
   // Split free and reserved blocks if possible.
@@ -370,6 +381,7 @@ sl_status_t sl_memory_heap_reserve_block(sl_memory_heap_t *heap,
 
     // Changes size of free block.
     sli_block_len_dword_encode(free_block_metadata, (block_len_dw - SLI_BLOCK_LEN_BYTE_TO_DWORD(size_real)));
+    FREE_BINS_INSERT(heap, free_block_metadata);
 
     // Create a new block = reserved block returned to requester. This new block is the nearest to the heap end.
     reserved_blk = (sli_block_metadata_t *)((uint8_t *)free_block_metadata + block_size_remaining);
@@ -426,8 +438,8 @@ sl_status_t sl_memory_heap_reserve_block(sl_memory_heap_t *heap,
   *block = reserved_blk;
 
 #if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
-  // Heap usage size statistic.
-  heap->used_size += size_real;
+  // Heap usage size statistic. The block size includes the remaining size when the free block is not split.
+  heap->used_size += handle->block_size;
   if (heap->used_size > heap->high_watermark) {
     heap->high_watermark = heap->used_size;
   }
@@ -440,7 +452,7 @@ sl_status_t sl_memory_heap_reserve_block(sl_memory_heap_t *heap,
 
   CORE_EXIT_ATOMIC();
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_alloc(sli_mm_heap_name, handle->block_address, size_real);
   sli_memory_profiler_track_alloc_with_ownership(sli_mm_heap_reservation_name,
                                                  handle->block_address,
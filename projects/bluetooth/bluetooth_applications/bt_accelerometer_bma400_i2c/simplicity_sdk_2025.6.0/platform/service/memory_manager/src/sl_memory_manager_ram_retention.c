@@ -0,0 +1,347 @@
+/***************************************************************************//**
+ * @file
+ * @brief Memory Manager Driver's Automatic RAM Retention Shrinking Implementation.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sl_memory_manager.h"
+#include "sli_memory_manager.h"
+
+#include "sl_assert.h"
+#include "sl_core.h"
+
+#if defined(SL_COMPONENT_CATALOG_PRESENT)
+#include "sl_component_catalog.h"
+#endif
+
+#if defined(SLI_MEMORY_MANAGER_RAM_RETENTION_SHRINK)
+#include "sl_hal_syscfg.h"
+#include "sl_power_manager.h"
+#endif
+
+#if defined(SLI_MEMORY_MANAGER_RAM_RETENTION_SHRINK)
+/*******************************************************************************
+ ***************************   LOCAL VARIABLES   *******************************
+ ******************************************************************************/
+
+// Size of each RAM bank, in address order. Bank n is controlled by bit n of
+// the DMEM0 retention control register.
+static const uint32_t ram_bank_size[] = {
+  DMEM_BANK0_SIZE,
+#if (DMEM_NUM_BANKS > 1)
+  DMEM_BANK1_SIZE,
+#endif
+#if (DMEM_NUM_BANKS > 2)
+  DMEM_BANK2_SIZE,
+#endif
+#if (DMEM_NUM_BANKS > 3)
+  DMEM_BANK3_SIZE,
+#endif
+#if (DMEM_NUM_BANKS > 4)
+  DMEM_BANK4_SIZE,
+#endif
+#if (DMEM_NUM_BANKS > 5)
+  DMEM_BANK5_SIZE,
+#endif
+#if (DMEM_NUM_BANKS > 6)
+  DMEM_BANK6_SIZE,
+#endif
+#if (DMEM_NUM_BANKS > 7)
+  DMEM_BANK7_SIZE,
+#endif
+};
+
+// Heap generation for which unretained_bank_mask was computed.
+static uint32_t mask_generation;
+
+// RAM banks not retained in EM2 for the heap generation mask_generation.
+static uint32_t unretained_bank_mask;
+
+// Set once unretained_bank_mask is valid.
+static bool is_mask_valid = false;
+
+// Retention control register value before entering EM2.
+static uint32_t saved_retention_control;
+
+static sl_power_manager_em_transition_event_handle_t em_transition_event_handle;
+#endif
+
+/*******************************************************************************
+ *************************   LOCAL FUNCTION PROTOTYPES   ***********************
+ ******************************************************************************/
+
+static uint32_t get_bank_mask(uintptr_t ram_base,
+                              const uint32_t *bank_size,
+                              uint32_t bank_count,
+                              uintptr_t start,
+                              uintptr_t end);
+
+#if defined(SLI_MEMORY_MANAGER_RAM_RETENTION_SHRINK)
+static void on_em_transition(sl_power_manager_em_t from,
+                             sl_power_manager_em_t to);
+
+static uint32_t get_unretained_bank_mask(void);
+
+static const sl_power_manager_em_transition_event_info_t em_transition_event_info = {
+  .event_mask = SL_POWER_MANAGER_EVENT_TRANSITION_ENTERING_EM2
+                | SL_POWER_MANAGER_EVENT_TRANSITION_LEAVING_EM2,
+  .on_event = on_em_transition,
+};
+#endif
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Initializes the automatic RAM retention shrinking.
+ ******************************************************************************/
+void sl_memory_ram_retention_init(void)
+{
+#if defined(SLI_MEMORY_MANAGER_RAM_RETENTION_SHRINK)
+  sl_power_manager_subscribe_em_transition_event(&em_transition_event_handle,
+                                                 &em_transition_event_info);
+#endif
+}
+
+/***************************************************************************//**
+ * Gets the RAM banks that are not retained in EM2 given the current heap
+ * usage.
+ ******************************************************************************/
+uint32_t sl_memory_get_unretained_ram_bank_mask(void)
+{
+#if defined(SLI_MEMORY_MANAGER_RAM_RETENTION_SHRINK)
+  uint32_t mask;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  mask = get_unretained_bank_mask();
+  CORE_EXIT_ATOMIC();
+
+  return mask;
+#else
+  return 0;
+#endif
+}
+
+/***************************************************************************//**
+ * Gets the RAM banks that can be left unretained.
+ *
+ * @note (1) The lowest bank is always retained, as it holds the stack and the
+ *           static data. A bank shared with memory outside the heap is
+ *           retained too.
+ *
+ * @note (2) The data payload of a free block does not need to be retained,
+ *           except the free list links it holds with segregated free lists.
+ *           Everything else between two free payloads is retained: allocated
+ *           blocks, block metadata, and reserved blocks, which fill the gaps
+ *           between a block and its next neighbour.
+ *
+ * @note (3) The blocks reserved with sl_memory_reserve_no_retention() are
+ *           taken from the heap end, after the last block. Any other space
+ *           after the last block is made of reserved blocks.
+ ******************************************************************************/
+uint32_t sli_memory_get_unretained_bank_mask(const sl_memory_heap_t *heap,
+                                             uintptr_t ram_base,
+                                             const uint32_t *bank_size,
+                                             uint32_t bank_count)
+{
+  uintptr_t heap_start = (uintptr_t)heap->base_addr;
+  uintptr_t heap_end = heap_start + heap->size;
+  uintptr_t no_retention_start = heap_end;
+  uintptr_t retained_start = heap_start;
+  uintptr_t bank_start = ram_base;
+  uintptr_t payload_end;
+  const sli_block_metadata_t *block;
+  uint32_t offset_next_dw;
+  uint32_t mask = 0;
+
+  // See Note #1.
+  for (uint32_t bank = 0; bank < bank_count; bank++) {
+    uintptr_t bank_end = bank_start + bank_size[bank];
+
+    if ((bank > 0)
+        && (bank_size[bank] != 0)
+        && (bank_start >= heap_start)
+        && (bank_end <= heap_end)) {
+      mask |= (1UL << bank);
+    }
+
+    bank_start = bank_end;
+  }
+
+  if (mask == 0) {
+    return 0;
+  }
+
+  if (heap == &sli_general_purpose_heap) {
+    no_retention_start -= reserve_no_retention_size;
+  }
+
+  block = sli_memory_get_first_block(heap);
+  while (true) {
+    if (!SLI_ADDR_IS_ALIGNED(block, SLI_WORD_SIZE_64)
+        || ((uintptr_t)block > (heap_end - SLI_BLOCK_METADATA_SIZE_BYTE))) {
+      return 0;
+    }
+
+    payload_end = (uintptr_t)block + SLI_BLOCK_METADATA_SIZE_BYTE
+                  + SLI_BLOCK_LEN_DWORD_TO_BYTE(sli_block_len_dword_decode(block));
+    if (payload_end > heap_end) {
+      return 0;
+    }
+
+    if (!block->block_in_use) {
+      // See Note #2.
+      uintptr_t free_start = (uintptr_t)block + SLI_BLOCK_METADATA_SIZE_BYTE;
+#if defined(SLI_MEMORY_MANAGER_FREE_BINS)
+      free_start += sizeof(sli_free_block_link_t);
+#endif
+      if (free_start < payload_end) {
+        mask &= ~get_bank_mask(ram_base, bank_size, bank_count, retained_start, free_start);
+        retained_start = payload_end;
+      }
+    }
+
+    offset_next_dw = sli_block_offset_next_dword_decode(block);
+    if (offset_next_dw == 0) {
+      break;
+    }
+
+    if (((uintptr_t)block + SLI_BLOCK_LEN_DWORD_TO_BYTE(offset_next_dw)) < payload_end) {
+      return 0;
+    }
+
+    block = (const sli_block_metadata_t *)((const uint64_t *)block + offset_next_dw);
+    if (((uintptr_t)block > (heap_end - SLI_BLOCK_METADATA_SIZE_BYTE))
+        || (sli_block_offset_prev_dword_decode(block) != offset_next_dw)) {
+      return 0;
+    }
+  }
+
+  // See Note #3.
+  mask &= ~get_bank_mask(ram_base, bank_size, bank_count, retained_start, no_retention_start);
+
+  return mask;
+}
+
+#if defined(SLI_MEMORY_MANAGER_RAM_RETENTION_SHRINK)
+/*******************************************************************************
+ ***************************   LOCAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Energy mode transition callback.
+ *
+ * @param[in]  from  Energy mode left.
+ * @param[in]  to    Energy mode entered.
+ *
+ * @note (1) RAM retention only matters in EM2, so the retention control
+ *           register is restored when leaving EM2. Banks that another module
+ *           chose not to retain are left as they were.
+ ******************************************************************************/
+static void on_em_transition(sl_power_manager_em_t from,
+                             sl_power_manager_em_t to)
+{
+  if (to == SL_POWER_MANAGER_EM2) {
+    saved_retention_control = sl_hal_syscfg_read_dmem0retnctrl();
+    sl_hal_syscfg_mask_dmem0retnctrl(get_unretained_bank_mask());
+  } else if (from == SL_POWER_MANAGER_EM2) {
+    // See Note #1.
+    sl_hal_syscfg_zero_dmem0retnctrl();
+    if (saved_retention_control != 0) {
+      sl_hal_syscfg_mask_dmem0retnctrl(saved_retention_control);
+    }
+  }
+}
+
+/***************************************************************************//**
+ * Gets the RAM banks that can be left unretained, with interrupts disabled.
+ *
+ * @return  Bit mask of the RAM banks, bit n for bank n.
+ *
+ * @note The heap is only walked again when blocks were allocated, freed or
+ *       reserved since the previous call.
+ ******************************************************************************/
+static uint32_t get_unretained_bank_mask(void)
+{
+  uint32_t generation = sli_memory_get_heap_generation();
+
+  if (!is_mask_valid || (mask_generation != generation)) {
+    unretained_bank_mask = sli_memory_get_unretained_bank_mask(&sli_general_purpose_heap,
+                                                               SRAM_BASE,
+                                                               ram_bank_size,
+                                                               DMEM_NUM_BANKS);
+    mask_generation = generation;
+    is_mask_valid = true;
+  }
+
+  return unretained_bank_mask;
+}
+
+#endif
+
+/***************************************************************************//**
+ * Gets the RAM banks that overlap an address range.
+ *
+ * @param[in]  ram_base    Start address of the first RAM bank.
+ * @param[in]  bank_size   Size of each RAM bank, in address order.
+ * @param[in]  bank_count  Number of RAM banks.
+ * @param[in]  start       Start address of the range.
+ * @param[in]  end         Address past the end of the range.
+ *
+ * @return  Bit mask of the RAM banks, bit n for bank n. 0 if the range is
+ *          empty.
+ ******************************************************************************/
+static uint32_t get_bank_mask(uintptr_t ram_base,
+                              const uint32_t *bank_size,
+                              uint32_t bank_count,
+                              uintptr_t start,
+                              uintptr_t end)
+{
+  uintptr_t bank_start = ram_base;
+  uint32_t mask = 0;
+
+  if (start >= end) {
+    return 0;
+  }
+
+  for (uint32_t bank = 0; (bank < bank_count) && (bank_start < end); bank++) {
+    uintptr_t bank_end = bank_start + bank_size[bank];
+
+    if (bank_end > start) {
+      mask |= (1UL << bank);
+    }
+
+    bank_start = bank_end;
+  }
+
+  return mask;
+}
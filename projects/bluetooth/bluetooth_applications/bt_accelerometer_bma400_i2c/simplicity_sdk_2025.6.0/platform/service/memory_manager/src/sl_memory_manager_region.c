@@ -27,14 +27,38 @@
  * 3. This notice may not be removed or altered from any source distribution.
  *
  ******************************************************************************/
+#include <stdbool.h>
 #include <stdint.h>
 #include "em_device.h"
 #include "sl_memory_manager_region.h"
 #include "sl_memory_manager_region_config.h"
+#include "sli_memory_manager.h"
 #include "sl_component_catalog.h"
 
+#if (SL_STACK_GUARD_SIZE > 0)
+#include "sl_mpu.h"
+#endif
+
 #define IAR_HEAP_BLOCK_NAME      "MEMORY_MANAGER_HEAP"
 
+// Word written in the unused stack to detect later which part was used.
+#define STACK_PAINT_PATTERN            0xC5C5C5C5u
+
+// Number of consecutive painted words that must be found below a given word
+// to consider that the stack was never used down to that word.
+#define STACK_PAINT_PROBE_WORD_COUNT   8u
+
+// The MPU regions are defined with a 32-byte granularity.
+#define STACK_GUARD_ALIGNMENT          32u
+
+#if ((SL_STACK_GUARD_SIZE % STACK_GUARD_ALIGNMENT) != 0)
+#error "SL_STACK_GUARD_SIZE must be a multiple of 32 bytes."
+#endif
+
+#if (SL_STACK_GUARD_SIZE > 0) && !defined(SL_CATALOG_MPU_PRESENT)
+#error "SL_STACK_GUARD_SIZE requires the MPU component."
+#endif
+
 // Prevent's compilation errors when building in simulation.
 #ifndef   __USED
   #define __USED
@@ -59,6 +83,17 @@ __root char sl_stack[SL_STACK_SIZE] @ ".stack";
 
 #endif
 
+#if (SL_STACK_HIGH_WATERMARK_ENABLE == 1)
+// Number of words, from the bottom of the painted stack, that are known to
+// still hold the paint pattern.
+static size_t stack_painted_word_count = 0;
+
+static const uint32_t *get_stack_paint_base(void);
+
+static bool is_stack_painted_below(const uint32_t *base,
+                                   size_t word_count);
+#endif
+
 /***************************************************************************//**
  * Gets size and location of the stack.
  ******************************************************************************/
@@ -91,6 +126,134 @@ sl_memory_region_t sl_memory_get_heap_region(void)
   return region;
 }
 
+/***************************************************************************//**
+ * Gets the highest number of stack bytes used.
+ *
+ * @note (1) The stack grows downwards, so the painted words left at the bottom
+ *           of the stack are contiguous. Rather than checking every word from
+ *           the bottom of the stack, a binary search looks for the highest
+ *           word that still has a run of painted words below it. The search
+ *           range is also limited to the words found painted by the previous
+ *           call, as the stack usage can only increase until the next reset.
+ *
+ * @note (2) A run of painted words is required rather than a single word, so
+ *           that a word written with the pattern value or a small local
+ *           variable never written do not stop the search too early. A larger
+ *           local buffer never written can still hide the used stack below
+ *           it.
+ ******************************************************************************/
+size_t sl_memory_get_stack_high_watermark(void)
+{
+#if (SL_STACK_HIGH_WATERMARK_ENABLE == 1)
+  const uint32_t *base = get_stack_paint_base();
+  size_t low = 0;
+  size_t high = stack_painted_word_count;
+  size_t mid;
+
+  // See Note #1.
+  while (low < high) {
+    mid = low + ((high - low + 1u) / 2u);
+    if (is_stack_painted_below(base, mid)) {
+      low = mid;
+    } else {
+      high = mid - 1u;
+    }
+  }
+
+  stack_painted_word_count = low;
+
+  return (size_t)(((uintptr_t)&sl_stack + SL_STACK_SIZE) - (uintptr_t)&base[low]);
+#else
+  return 0;
+#endif
+}
+
+/***************************************************************************//**
+ * Resets the stack high watermark.
+ ******************************************************************************/
+void sl_memory_reset_stack_high_watermark(void)
+{
+  sli_memory_paint_stack();
+}
+
+/***************************************************************************//**
+ * Paints the unused part of the stack.
+ *
+ * @note The words below the current stack pointer are not used by this
+ *       function or its callers. An interrupt taken while painting uses them
+ *       only until it returns, so they can be overwritten.
+ ******************************************************************************/
+void sli_memory_paint_stack(void)
+{
+#if (SL_STACK_HIGH_WATERMARK_ENABLE == 1)
+  uint32_t *base = (uint32_t *)get_stack_paint_base();
+  uint32_t *word = base;
+  uint32_t *stack_pointer = (uint32_t *)__get_MSP();
+
+  while (word < stack_pointer) {
+    *word++ = STACK_PAINT_PATTERN;
+  }
+
+  stack_painted_word_count = (size_t)(word - base);
+#endif
+}
+
+/***************************************************************************//**
+ * Makes the bottom of the stack a read-only MPU region.
+ ******************************************************************************/
+sl_status_t sli_memory_enable_stack_guard(void)
+{
+#if (SL_STACK_GUARD_SIZE > 0)
+  uint32_t guard_begin = SLI_ALIGN_ROUND_UP((uint32_t)&sl_stack, STACK_GUARD_ALIGNMENT);
+
+  return sl_mpu_set_guard_region(guard_begin, SL_STACK_GUARD_SIZE);
+#else
+  return SL_STATUS_OK;
+#endif
+}
+
+#if (SL_STACK_HIGH_WATERMARK_ENABLE == 1)
+/***************************************************************************//**
+ * Gets the lowest stack word that is painted.
+ *
+ * @return  Pointer to the first word above the stack guard, if any.
+ ******************************************************************************/
+static const uint32_t *get_stack_paint_base(void)
+{
+  uintptr_t base = (uintptr_t)&sl_stack;
+
+#if (SL_STACK_GUARD_SIZE > 0)
+  base = SLI_ALIGN_ROUND_UP(base, STACK_GUARD_ALIGNMENT) + SL_STACK_GUARD_SIZE;
+#endif
+
+  return (const uint32_t *)base;
+}
+
+/***************************************************************************//**
+ * Checks if the words right below a given stack word still hold the paint
+ * pattern.
+ *
+ * @param[in] base        Lowest painted stack word.
+ * @param[in] word_count  Index of the word, from base.
+ *
+ * @return  true if the STACK_PAINT_PROBE_WORD_COUNT words below the given word,
+ *          or all of them if there are less, are painted. false otherwise.
+ ******************************************************************************/
+static bool is_stack_painted_below(const uint32_t *base,
+                                   size_t word_count)
+{
+  size_t i = (word_count > STACK_PAINT_PROBE_WORD_COUNT) ? (word_count - STACK_PAINT_PROBE_WORD_COUNT) : 0u;
+
+  for (; i < word_count; i++) {
+    if (base[i] != STACK_PAINT_PATTERN) {
+      return false;
+    }
+  }
+
+  return true;
+}
+#endif
+
 #if defined(__GNUC__)
 /***************************************************************************//**
  * Extends the process data space.
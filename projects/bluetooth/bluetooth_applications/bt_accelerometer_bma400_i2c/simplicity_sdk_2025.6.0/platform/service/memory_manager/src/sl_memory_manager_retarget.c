@@ -29,12 +29,13 @@
  ******************************************************************************/
 
 #include "sl_memory_manager.h"
+#include "sli_memory_manager.h"
 
 #if defined(SL_COMPONENT_CATALOG_PRESENT)
 #include "sl_component_catalog.h"
 #endif
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
 #include "sli_memory_profiler.h"
 #endif
 
@@ -155,7 +156,7 @@ volatile uint32_t retarget_realloc_counter = 0;
 ATTR_EXT_VIS void *STD_LIB_WRAPPER_MALLOC(RARG
                                           size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   VOID_RARG;
@@ -166,7 +167,7 @@ ATTR_EXT_VIS void *STD_LIB_WRAPPER_MALLOC(RARG
   retarget_malloc_counter++;
 #endif
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE,
                                       ptr,
                                       return_address);
@@ -178,14 +179,14 @@ ATTR_EXT_VIS void *STD_LIB_WRAPPER_MALLOC(RARG
 #if defined(__IAR_SYSTEMS_ICC__) && (__VER__ == 9040001)
 void *STD_LIB_WRAPPER_MALLOC_ADVANCED(size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   void *ptr;
 
   ptr = sl_malloc(size);
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE,
                                       ptr,
                                       return_address);
@@ -196,14 +197,14 @@ void *STD_LIB_WRAPPER_MALLOC_ADVANCED(size_t size)
 
 void *STD_LIB_WRAPPER_MALLOC_NO_FREE(size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   void *ptr;
 
   ptr = sl_malloc(size);
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE,
                                       ptr,
                                       return_address);
@@ -253,7 +254,7 @@ ATTR_EXT_VIS void *STD_LIB_WRAPPER_CALLOC(RARG
                                           size_t item_count,
                                           size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   VOID_RARG;
@@ -264,7 +265,7 @@ ATTR_EXT_VIS void *STD_LIB_WRAPPER_CALLOC(RARG
   retarget_calloc_counter++;
 #endif
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE,
                                       ptr,
                                       return_address);
@@ -277,14 +278,14 @@ ATTR_EXT_VIS void *STD_LIB_WRAPPER_CALLOC(RARG
 void *STD_LIB_WRAPPER_CALLOC_ADVANCED(size_t item_count,
                                       size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   void *ptr;
 
   ptr = sl_calloc(item_count, size);
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE,
                                       ptr,
                                       return_address);
@@ -296,14 +297,14 @@ void *STD_LIB_WRAPPER_CALLOC_ADVANCED(size_t item_count,
 void *STD_LIB_WRAPPER_CALLOC_NO_FREE(size_t item_count,
                                      size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   void *ptr;
 
   ptr = sl_calloc(item_count, size);
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE,
                                       ptr,
                                       return_address);
@@ -338,7 +339,7 @@ ATTR_EXT_VIS void *STD_LIB_WRAPPER_REALLOC(RARG
                                            void *ptr,
                                            size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   VOID_RARG;
@@ -349,7 +350,7 @@ ATTR_EXT_VIS void *STD_LIB_WRAPPER_REALLOC(RARG
   retarget_realloc_counter++;
 #endif
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE,
                                       r_ptr,
                                       return_address);
@@ -362,14 +363,14 @@ ATTR_EXT_VIS void *STD_LIB_WRAPPER_REALLOC(RARG
 void *STD_LIB_WRAPPER_REALLOC_ADVANCED(void *ptr,
                                        size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   void *r_ptr;
 
   r_ptr = sl_realloc(ptr, size);
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE,
                                       r_ptr,
                                       return_address);
@@ -75,6 +75,14 @@ uint32_t sli_reservation_alignment_table[SLI_MAX_RESERVATION_COUNT] = { 0 };
 sl_memory_reservation_t sli_reservation_no_retention_table[SLI_MAX_RESERVATION_COUNT] = { 0 };
 #endif
 
+#if defined(SLI_MEMORY_MANAGER_FREE_BINS)
+// Segregated free lists of the general purpose heap.
+static sli_memory_free_bins_t sli_general_purpose_heap_free_bins;
+#endif
+
+// Heap generation. See sli_memory_get_heap_generation().
+static uint32_t sli_heap_generation;
+
 /*******************************************************************************
  ***************************   LOCAL FUNCTIONS   *******************************
  ******************************************************************************/
@@ -172,6 +180,363 @@ static uint32_t get_available_reservation_no_retention_ix(void)
 }
 #endif
 
+/***************************************************************************//**
+ * Computes the size taken from a free block by an allocation, alignment
+ * adjustment included.
+ *
+ * @param[in]  block              Free block selected.
+ * @param[in]  size               Requested size, in bytes.
+ * @param[in]  block_align        Required alignment, in bytes.
+ * @param[in]  type               Type of block (long-term or short term).
+ * @param[in]  block_reservation  Indicates if the free block is for a dynamic
+ *                                reservation.
+ *
+ * @return    Adjusted size, in bytes. Greater than the block length if the
+ *            block cannot hold the allocation.
+ *
+ * @note (1) A short-term block too small to be split has its data payload
+ *           aligned from the block start, like a long-term block. The
+ *           alignment offset may then not fit in the block.
+ ******************************************************************************/
+static size_t memory_block_size_adjusted(const sli_block_metadata_t *block,
+                                         size_t size,
+                                         size_t block_align,
+                                         sl_memory_block_type_t type,
+                                         bool block_reservation)
+{
+  size_t block_len = SLI_BLOCK_LEN_DWORD_TO_BYTE(sli_block_len_dword_decode(block));
+  size_t size_adjusted;
+  void *data_payload;
+  uint8_t *block_end;
+
+  if (type == BLOCK_TYPE_LONG_TERM) {
+    return size + sli_memory_get_align_offset(block, block_align);
+  }
+
+  if (block_align == SLI_BLOCK_ALLOC_MIN_ALIGN) {
+    return size;
+  }
+
+  block_end = (uint8_t *)((uint64_t *)block + SLI_BLOCK_METADATA_SIZE_DWORD + sli_block_len_dword_decode(block));
+  data_payload = (void *)(block_end - size);
+  data_payload = (void *)SLI_ALIGN_ROUND_DOWN(((uintptr_t)data_payload), block_align);
+  size_adjusted = (size_t)(block_end - (uint8_t *)data_payload);
+
+  // See Note #1.
+  if (!block_reservation
+      && (size_adjusted <= block_len)
+      && ((block_len - size_adjusted) < SLI_BLOCK_ALLOCATION_MIN_SIZE)) {
+    size_t size_from_start = size + sli_memory_get_align_offset(block, block_align);
+
+    if (size_from_start > block_len) {
+      return size_from_start;
+    }
+  }
+
+  return size_adjusted;
+}
+
+#if defined(SLI_MEMORY_MANAGER_FREE_BINS)
+/***************************************************************************//**
+ * Gets the segregated free lists of a heap.
+ *
+ * @param[in]  heap  Heap handle.
+ *
+ * @return    Pointer to the heap's free lists, NULL if the heap uses first-fit.
+ *
+ * @note Only the general purpose heap has segregated free lists. They are kept
+ *       outside of the heap handle so that sl_memory_heap_t is unchanged.
+ ******************************************************************************/
+static sli_memory_free_bins_t *free_bins_get(const sl_memory_heap_t *heap)
+{
+  return (heap == &sli_general_purpose_heap) ? &sli_general_purpose_heap_free_bins : NULL;
+}
+
+/***************************************************************************//**
+ * Gets the bin links stored in a free block data payload.
+ *
+ * @param[in]  block  Pointer to free block metadata.
+ *
+ * @return    Pointer to the block's bin links.
+ ******************************************************************************/
+static sli_free_block_link_t *free_bins_link(const sli_block_metadata_t *block)
+{
+  return (sli_free_block_link_t *)((uint8_t *)block + SLI_BLOCK_METADATA_SIZE_BYTE);
+}
+
+/***************************************************************************//**
+ * Converts a block pointer to a bin link offset.
+ *
+ * @param[in]  heap   Heap handle.
+ * @param[in]  block  Pointer to free block metadata.
+ *
+ * @return    Offset of the block from the heap base, in double words.
+ ******************************************************************************/
+static uint32_t free_bins_offset(const sl_memory_heap_t *heap,
+                                 const sli_block_metadata_t *block)
+{
+  return (uint32_t)((const uint64_t *)block - (const uint64_t *)heap->base_addr);
+}
+
+/***************************************************************************//**
+ * Converts a bin link offset to a block pointer.
+ *
+ * @param[in]  heap       Heap handle.
+ * @param[in]  offset_dw  Offset of the block from the heap base, in double words.
+ *
+ * @return    Pointer to free block metadata.
+ ******************************************************************************/
+static sli_block_metadata_t *free_bins_block(const sl_memory_heap_t *heap,
+                                             uint32_t offset_dw)
+{
+  return (sli_block_metadata_t *)((uint64_t *)heap->base_addr + offset_dw);
+}
+
+/***************************************************************************//**
+ * Maps a block length to its first and second level bin indexes.
+ *
+ * @param[in]  len_dw  Block length, in double words. Must not be 0.
+ * @param[out] fl      First level index.
+ * @param[out] sl      Second level index.
+ ******************************************************************************/
+static void free_bins_mapping(uint32_t len_dw,
+                              uint32_t *fl,
+                              uint32_t *sl)
+{
+  uint32_t msb;
+
+  if (len_dw < SLI_FREE_BINS_SL_COUNT) {
+    *fl = 0u;
+    *sl = len_dw;
+  } else {
+    msb = (SLI_DEF_INT_32_NBR_BITS - 1u) - __CLZ(len_dw);
+    *fl = msb - SLI_FREE_BINS_SL_LOG2 + 1u;
+    *sl = (len_dw >> (msb - SLI_FREE_BINS_SL_LOG2)) - SLI_FREE_BINS_SL_COUNT;
+  }
+}
+
+/***************************************************************************//**
+ * Finds the first non-empty bin at or after a given bin.
+ *
+ * @param[in]     bins  Segregated free lists.
+ * @param[in,out] fl    First level index to start from. Updated with the bin found.
+ * @param[in,out] sl    Second level index to start from. Updated with the bin found.
+ *
+ * @return    true if a bin was found, false otherwise.
+ ******************************************************************************/
+static bool free_bins_search_from(const sli_memory_free_bins_t *bins,
+                                  uint32_t *fl,
+                                  uint32_t *sl)
+{
+  uint32_t sl_map;
+  uint32_t fl_map;
+
+  if (*fl >= SLI_FREE_BINS_FL_COUNT) {
+    return false;
+  }
+
+  sl_map = (*sl < SLI_FREE_BINS_SL_COUNT) ? (bins->sl_bitmap[*fl] & (~0u << *sl)) : 0u;
+  if (sl_map == 0u) {
+    fl_map = (*fl + 1u < SLI_DEF_INT_32_NBR_BITS) ? (bins->fl_bitmap & (~0u << (*fl + 1u))) : 0u;
+    if (fl_map == 0u) {
+      return false;
+    }
+    *fl = SL_CTZ(fl_map);
+    sl_map = bins->sl_bitmap[*fl];
+  }
+  *sl = SL_CTZ(sl_map);
+
+  return true;
+}
+
+/***************************************************************************//**
+ * Finds the first non-empty bin whose blocks are all at least len_dw long.
+ *
+ * @param[in]  bins    Segregated free lists.
+ * @param[in]  len_dw  Requested length, in double words. Must not be 0.
+ * @param[out] fl      First level index of the bin found.
+ * @param[out] sl      Second level index of the bin found.
+ *
+ * @return    true if a bin was found, false otherwise.
+ ******************************************************************************/
+static bool free_bins_search(const sli_memory_free_bins_t *bins,
+                             uint32_t len_dw,
+                             uint32_t *fl,
+                             uint32_t *sl)
+{
+  // Round the length up to the next class so that any block of the bin fits.
+  if (len_dw >= SLI_FREE_BINS_SL_COUNT) {
+    len_dw += (1u << (((SLI_DEF_INT_32_NBR_BITS - 1u) - __CLZ(len_dw)) - SLI_FREE_BINS_SL_LOG2)) - 1u;
+  }
+
+  free_bins_mapping(len_dw, fl, sl);
+
+  return free_bins_search_from(bins, fl, sl);
+}
+
+/***************************************************************************//**
+ * Gets a free block of adequate size from the segregated free lists.
+ *
+ * @note (1) The search length accounts for the worst case alignment
+ *           adjustment (alignment minus the minimum alignment) so that the
+ *           block selected can always be used without looking at another one.
+ *           The exact adjusted size is then computed as in the first-fit
+ *           search.
+ *
+ * @note (2) A reservation that takes a whole free block starts at the block
+ *           metadata address. The block at the heap start must keep its
+ *           metadata, so it is skipped when it cannot be split.
+ *
+ * @note (3) The alignment adjustment can exceed the worst case when the space
+ *           before the aligned block becomes a free block, or not fit at all
+ *           in a short-term block too small to be split. See
+ *           sli_memory_get_align_offset(). The other blocks of the bin are
+ *           then tried, in the same order.
+ ******************************************************************************/
+static size_t free_bins_find_free_block(sl_memory_heap_t *heap,
+                                        size_t size,
+                                        size_t align,
+                                        sl_memory_block_type_t type,
+                                        bool block_reservation,
+                                        sli_block_metadata_t **block)
+{
+  const sli_memory_free_bins_t *bins = free_bins_get(heap);
+  sli_block_metadata_t *first_block_metadata;
+  sli_block_metadata_t *current_block_metadata;
+  size_t block_align = (align == SL_MEMORY_BLOCK_ALIGN_DEFAULT) ? SLI_BLOCK_ALLOC_MIN_ALIGN : align;
+  size_t search_size = size + (block_align - SLI_BLOCK_ALLOC_MIN_ALIGN);
+  size_t current_block_len;
+  size_t size_adjusted;
+  uint32_t fl;
+  uint32_t sl;
+
+  *block = NULL;
+
+  // For a block reservation, the metadata's space is available too.
+  if (block_reservation) {
+    search_size = (search_size > SLI_BLOCK_METADATA_SIZE_BYTE) ? (search_size - SLI_BLOCK_METADATA_SIZE_BYTE) : SLI_WORD_SIZE_64;
+  }
+
+  if (!free_bins_search(bins, SLI_BLOCK_LEN_BYTE_TO_DWORD(search_size), &fl, &sl)) {
+    return 0;
+  }
+
+  for (;; ) {
+    // Long-term takes the bin head (closest to heap start), short-term the bin tail.
+    first_block_metadata = bins->bins[fl][sl];
+    if (type == BLOCK_TYPE_SHORT_TERM) {
+      first_block_metadata = free_bins_block(heap, free_bins_link(first_block_metadata)->offset_prev);
+    }
+
+    // See Note #3.
+    current_block_metadata = first_block_metadata;
+    do {
+      current_block_len = SLI_BLOCK_LEN_DWORD_TO_BYTE(sli_block_len_dword_decode(current_block_metadata));
+      current_block_len += block_reservation ? SLI_BLOCK_METADATA_SIZE_BYTE : 0;
+      size_adjusted = memory_block_size_adjusted(current_block_metadata, size, block_align, type, block_reservation);
+
+      // See Note #2.
+      if ((current_block_len >= size_adjusted)
+          && (!block_reservation
+              || ((void *)current_block_metadata != heap->base_addr)
+              || ((current_block_len - size_adjusted) >= SLI_BLOCK_RESERVATION_MIN_SIZE_BYTE))) {
+        *block = current_block_metadata;
+        return size_adjusted;
+      }
+
+      current_block_metadata = free_bins_block(heap, (type == BLOCK_TYPE_LONG_TERM)
+                                               ? free_bins_link(current_block_metadata)->offset_next
+                                               : free_bins_link(current_block_metadata)->offset_prev);
+    } while (current_block_metadata != first_block_metadata);
+
+    sl++;
+    if (!free_bins_search_from(bins, &fl, &sl)) {
+      return 0;
+    }
+  }
+}
+
+/***************************************************************************//**
+ * Adds a free block to the segregated free lists of a heap.
+ ******************************************************************************/
+void sli_memory_free_bins_insert(sl_memory_heap_t *heap,
+                                 sli_block_metadata_t *block)
+{
+  sli_memory_free_bins_t *bins = free_bins_get(heap);
+  sli_free_block_link_t *link;
+  sli_free_block_link_t *head_link;
+  sli_block_metadata_t *head;
+  uint32_t block_offset;
+  uint32_t fl;
+  uint32_t sl;
+
+  if (bins == NULL) {
+    return;
+  }
+
+  free_bins_mapping(sli_block_len_dword_decode(block), &fl, &sl);
+  link = free_bins_link(block);
+  block_offset = free_bins_offset(heap, block);
+  head = bins->bins[fl][sl];
+
+  if (head == NULL) {
+    link->offset_next = block_offset;
+    link->offset_prev = block_offset;
+    bins->bins[fl][sl] = block;
+    bins->sl_bitmap[fl] |= (1u << sl);
+    bins->fl_bitmap |= (1u << fl);
+    return;
+  }
+
+  // Insert between the bin tail and the bin head.
+  head_link = free_bins_link(head);
+  link->offset_next = free_bins_offset(heap, head);
+  link->offset_prev = head_link->offset_prev;
+  free_bins_link(free_bins_block(heap, link->offset_prev))->offset_next = block_offset;
+  head_link->offset_prev = block_offset;
+
+  // Keep blocks closer to the heap start in front. See sli_memory_free_bins_insert() description.
+  if (block < head) {
+    bins->bins[fl][sl] = block;
+  }
+}
+
+/***************************************************************************//**
+ * Removes a free block from the segregated free lists of a heap.
+ ******************************************************************************/
+void sli_memory_free_bins_remove(sl_memory_heap_t *heap,
+                                 sli_block_metadata_t *block)
+{
+  sli_memory_free_bins_t *bins = free_bins_get(heap);
+  sli_free_block_link_t *link;
+  uint32_t fl;
+  uint32_t sl;
+
+  if (bins == NULL) {
+    return;
+  }
+
+  free_bins_mapping(sli_block_len_dword_decode(block), &fl, &sl);
+  link = free_bins_link(block);
+
+  if (link->offset_next == free_bins_offset(heap, block)) {
+    // Last block of the bin.
+    EFM_ASSERT(bins->bins[fl][sl] == block);
+    bins->bins[fl][sl] = NULL;
+    bins->sl_bitmap[fl] &= ~(1u << sl);
+    if (bins->sl_bitmap[fl] == 0u) {
+      bins->fl_bitmap &= ~(1u << fl);
+    }
+  } else {
+    free_bins_link(free_bins_block(heap, link->offset_prev))->offset_next = link->offset_next;
+    free_bins_link(free_bins_block(heap, link->offset_next))->offset_prev = link->offset_prev;
+    if (bins->bins[fl][sl] == block) {
+      bins->bins[fl][sl] = free_bins_block(heap, link->offset_next);
+    }
+  }
+}
+#endif
+
 /***************************************************************************//**
  * Initializes a memory block metadata to some reset values.
  ******************************************************************************/
@@ -180,6 +545,71 @@ void sli_memory_metadata_init(sli_block_metadata_t *block_metadata)
   memset(block_metadata, 0, SLI_BLOCK_METADATA_SIZE_BYTE);
 }
 
+/***************************************************************************//**
+ * Gets the first block of a heap.
+ *
+ * @note (1) When the first block was allocated with an alignment that moved its
+ *           metadata away from the heap start, the metadata left at the heap
+ *           start is flagged with heap_start_align. Its next neighbour offset
+ *           gives the first block.
+ ******************************************************************************/
+sli_block_metadata_t *sli_memory_get_first_block(const sl_memory_heap_t *heap)
+{
+  sli_block_metadata_t *block = (sli_block_metadata_t *)heap->base_addr;
+
+  // See Note #1.
+  if (block->heap_start_align) {
+    block = (sli_block_metadata_t *)((uint64_t *)block + sli_block_offset_next_dword_decode(block));
+  }
+
+  return block;
+}
+
+/***************************************************************************//**
+ * Gets the heap generation.
+ ******************************************************************************/
+uint32_t sli_memory_get_heap_generation(void)
+{
+  return sli_heap_generation;
+}
+
+/***************************************************************************//**
+ * Increments the heap generation.
+ ******************************************************************************/
+void sli_memory_increment_heap_generation(void)
+{
+  sli_heap_generation++;
+}
+
+/***************************************************************************//**
+ * Gets the offset that aligns the data payload of a block kept at its address.
+ *
+ * @note (1) The space before the aligned block is merged into the previous
+ *           block when they are adjacent, or flagged with heap_start_align at
+ *           the heap start. When reserved blocks lie between the previous
+ *           block and this block, the space becomes a free block. The offset
+ *           is then increased to fit at least a minimum size block.
+ ******************************************************************************/
+size_t sli_memory_get_align_offset(const sli_block_metadata_t *block,
+                                   size_t block_align)
+{
+  uintptr_t data_payload = (uintptr_t)block + SLI_BLOCK_METADATA_SIZE_BYTE;
+  size_t align_offset = SLI_ALIGN_ROUND_UP(data_payload, block_align) - data_payload;
+  uint32_t offset_prev_dw = sli_block_offset_prev_dword_decode(block);
+
+  if ((align_offset != 0) && (offset_prev_dw != 0)) {
+    const sli_block_metadata_t *prev_block = (const sli_block_metadata_t *)((const uint64_t *)block - offset_prev_dw);
+
+    // See Note #1.
+    if ((offset_prev_dw != (sli_block_len_dword_decode(prev_block) + SLI_BLOCK_METADATA_SIZE_DWORD))
+        && (align_offset < SLI_BLOCK_ALLOCATION_MIN_SIZE)) {
+      align_offset += SLI_ALIGN_ROUND_UP(SLI_BLOCK_ALLOCATION_MIN_SIZE - align_offset, block_align);
+    }
+  }
+
+  return align_offset;
+}
+
 /***************************************************************************//**
  * Gets pointer pointing to the first free block of adequate size.
  *
@@ -195,7 +625,8 @@ void sli_memory_metadata_init(sli_block_metadata_t *block_metadata)
  *           best data offset needed to align the data payload. The worst
  *           alignment (size_real + block_align) cannot be taken by default
  *           as it may imply loosing too many bytes in internal fragmentation
- *           due to the alignment requirement.
+ *           due to the alignment requirement. For a long-term block, the
+ *           data offset is the one given by sli_memory_get_align_offset().
  ******************************************************************************/
 size_t sli_memory_find_free_block(sl_memory_heap_t *heap,
                                   size_t size,
@@ -207,12 +638,15 @@ size_t sli_memory_find_free_block(sl_memory_heap_t *heap,
   sli_block_metadata_t *current_block_metadata = NULL;
   sli_block_metadata_t *free_lt_list_head = (sli_block_metadata_t *)heap->free_lt_list_head;
   sli_block_metadata_t *free_st_list_head = (sli_block_metadata_t *)heap->free_st_list_head;
-  void *data_payload = NULL;
   size_t size_adjusted = 0;
   size_t current_block_len;
   size_t block_align = (align == SL_MEMORY_BLOCK_ALIGN_DEFAULT) ? SLI_BLOCK_ALLOC_MIN_ALIGN : align;
-  size_t data_payload_offset;
-  bool is_aligned = false;
+
+#if defined(SLI_MEMORY_MANAGER_FREE_BINS)
+  if (free_bins_get(heap) != NULL) {
+    return free_bins_find_free_block(heap, size, align, type, block_reservation, block);
+  }
+#endif
 
   *block = NULL;
 
@@ -228,35 +662,11 @@ size_t sli_memory_find_free_block(sl_memory_heap_t *heap,
 
   // Try to find a block to allocate (first-fit).
   while (current_block_metadata != NULL) {
-    if ((!current_block_metadata->block_in_use) && (current_block_len >= size)) {
-      if (type == BLOCK_TYPE_LONG_TERM) {
-        // Check alignment requested and ensure size of found block can accommodate worst case alignment.
-        // For LT, alignment requirement can be verified here whether the block is split or not.
-        data_payload = (void *)((uint8_t *)current_block_metadata + SLI_BLOCK_METADATA_SIZE_BYTE);
-        is_aligned = SLI_ADDR_IS_ALIGNED(data_payload, block_align);
-        data_payload_offset = (uintptr_t)data_payload % block_align;
-
-        if (is_aligned || (current_block_len >= (size + data_payload_offset))) {
-          // Compute remaining block size given an alignment handling or not.
-          size_adjusted = is_aligned ? size : (size + data_payload_offset);
-          break;
-        }
-      } else {
-        if (block_align == SLI_BLOCK_ALLOC_MIN_ALIGN) {
-          // If alignment is 8 bytes (default min alignment), take the requested adjusted size.
-          size_adjusted = size;
-        } else {
-          // If non 8-byte alignment, search the more optimized size accounting for the required alignment. See Note #3.
-          uint8_t *block_end = (uint8_t *)((uint64_t *)current_block_metadata + SLI_BLOCK_METADATA_SIZE_DWORD + sli_block_len_dword_decode(current_block_metadata));
-
-          data_payload = (void *)(block_end - size);
-          data_payload = (void *)SLI_ALIGN_ROUND_DOWN(((uintptr_t)data_payload), block_align);
-          size_adjusted = (size_t)(block_end - (uint8_t *)data_payload);
-        }
-
-        if (current_block_len >= size_adjusted) {
-          break;
-        }
+    if (!current_block_metadata->block_in_use) {
+      // Size of found block must account for the alignment of the data payload. See Note #2.
+      size_adjusted = memory_block_size_adjusted(current_block_metadata, size, block_align, type, block_reservation);
+      if (current_block_len >= size_adjusted) {
+        break;
       }
     }
 
@@ -300,6 +710,14 @@ sli_block_metadata_t *sli_memory_find_head_free_block(sl_memory_heap_t *heap,
     return NULL;
   }
 
+#if defined(SLI_MEMORY_MANAGER_FREE_BINS)
+  // With segregated free lists, allocations never start from the head pointers. They only
+  // need to reference a valid block, so the walk is skipped to keep allocation bounded.
+  if ((free_bins_get(heap) != NULL) && (block_start_from != NULL)) {
+    return block_start_from;
+  }
+#endif
+
   if (block_start_from != NULL) {
     // Start searching from the given block.
     current_block_metadata = block_start_from;
@@ -307,7 +725,7 @@ sli_block_metadata_t *sli_memory_find_head_free_block(sl_memory_heap_t *heap,
     // Start searching from heap start (long-term [LT]) or near heap end (short-term [ST]).
     // For ST, searching cannot start at the absolute heap end. So the ST head pointer is used as it points
     // to the last free block closest to the heap end.
-    current_block_metadata = (type == BLOCK_TYPE_LONG_TERM) ? (sli_block_metadata_t *)heap->base_addr : (sli_block_metadata_t *)heap->free_st_list_head;
+    current_block_metadata = (type == BLOCK_TYPE_LONG_TERM) ? sli_memory_get_first_block(heap) : (sli_block_metadata_t *)heap->free_st_list_head;
   }
   // Make sure the block isn't NULL to prevent dereferencing a NULL pointer.
   EFM_ASSERT(current_block_metadata != NULL);
@@ -421,6 +839,14 @@ sl_status_t sli_memory_create_heap(void *base_addr,
   sli_block_len_dword_encode(free_lt_list_head, (SLI_BLOCK_LEN_BYTE_TO_DWORD(size - SLI_BLOCK_METADATA_SIZE_BYTE)));
   heap->free_blocks_number++;
 
+#if defined(SLI_MEMORY_MANAGER_FREE_BINS)
+  // Only the general purpose heap has segregated free lists. Other heaps use first-fit.
+  if (heap == &sli_general_purpose_heap) {
+    memset(&sli_general_purpose_heap_free_bins, 0, sizeof(sli_general_purpose_heap_free_bins));
+    sli_memory_free_bins_insert(heap, free_lt_list_head);
+  }
+#endif
+
 #if defined(SL_CATALOG_BANK_RETENTION_CONTROL_PRESENT)
   sli_memory_manager_hal_init(heap);
 #endif
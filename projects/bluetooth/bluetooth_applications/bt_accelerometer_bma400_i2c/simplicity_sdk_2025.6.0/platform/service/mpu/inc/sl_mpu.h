@@ -76,6 +76,25 @@ sl_status_t sl_mpu_disable_execute(uint32_t address_begin,
                                    uint32_t address_end,
                                    uint32_t size);
 
+/***************************************************************************//**
+ * Configures an address range as a read-only guard region and enable MPU.
+ *
+ * @note Configures a MPU region in order to make an address range read-only
+ *       and non-executable, so that any write to it triggers a MemManage
+ *       fault. This is typically used at the bottom of a stack to trap stack
+ *       overflows. A region previously configured that contains the address
+ *       range is split around it.
+ *
+ * @param address_begin Beginning of memory segment. Must be aligned on 32
+ *                      bytes.
+ *
+ * @param size          Size of memory segment. Must be a multiple of 32 bytes.
+ *
+ * @return 0 if successful. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_mpu_set_guard_region(uint32_t address_begin,
+                                    uint32_t size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -250,6 +250,125 @@ sl_status_t sl_mpu_disable_execute(uint32_t address_begin,
   return status;
 }
 
+/**************************************************************************//**
+ * Configures an address range as a read-only guard region and enable MPU.
+ *
+ * @note (1) An access to an address that matches several enabled MPU regions
+ *           triggers a fault. The region that contains the guard is therefore
+ *           split: it keeps the part below the guard and a new region with
+ *           the same attributes covers the part above the guard.
+ *
+ * @note (2) The guard is read-only for privileged code and not accessible to
+ *           non-privileged code, so that a write from either one faults.
+ *****************************************************************************/
+sl_status_t sl_mpu_set_guard_region(uint32_t address_begin,
+                                    uint32_t size)
+{
+  uint32_t guard_limit;
+  uint32_t region_count;
+  uint32_t index_region;
+  uint32_t rbar = 0u;
+  uint32_t rlar = 0u;
+  uint32_t prev_base_address = 0u;
+  uint32_t prev_limit_address = 0u;
+  uint32_t part_rbar[3];
+  uint32_t part_rlar[3];
+  uint32_t part_nbr = 0u;
+  uint32_t new_region_nbr;
+
+  if ((size < MPU_RLAR_LIMIT_ADDRESS_ALIGNMENT)
+      || ((address_begin % MPU_RLAR_LIMIT_ADDRESS_ALIGNMENT) != 0u)
+      || ((size % MPU_RLAR_LIMIT_ADDRESS_ALIGNMENT) != 0u)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  guard_limit = address_begin + size - MPU_RLAR_LIMIT_ADDRESS_ALIGNMENT;
+  region_count = (MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos;
+
+  // Look for a region that overlaps the guard. See Note #1.
+  for (index_region = 0u; index_region < region_nbr; index_region++) {
+    MPU->RNR = index_region;
+    rbar = MPU->RBAR;
+    rlar = MPU->RLAR;
+    prev_base_address = rbar & MPU_RBAR_BASE_Msk;
+    prev_limit_address = rlar & MPU_RLAR_LIMIT_Msk;
+
+    if (!((address_begin > prev_limit_address) || (guard_limit < prev_base_address))) {
+      break;
+    }
+  }
+
+  if (index_region < region_nbr) {
+    // The guard can only split a region that contains it entirely.
+    if ((address_begin < prev_base_address) || (guard_limit > prev_limit_address)) {
+      return SL_STATUS_INVALID_RANGE;
+    }
+
+    // Part of the region below the guard.
+    if (address_begin > prev_base_address) {
+      part_rbar[part_nbr] = rbar;
+      part_rlar[part_nbr] = (rlar & ~MPU_RLAR_LIMIT_Msk)
+                            | ((address_begin - MPU_RLAR_LIMIT_ADDRESS_ALIGNMENT) & MPU_RLAR_LIMIT_Msk);
+      part_nbr++;
+    }
+
+    // Part of the region above the guard.
+    if (guard_limit < prev_limit_address) {
+      part_rbar[part_nbr] = (rbar & ~MPU_RBAR_BASE_Msk)
+                            | ((guard_limit + MPU_RLAR_LIMIT_ADDRESS_ALIGNMENT) & MPU_RBAR_BASE_Msk);
+      part_rlar[part_nbr] = rlar;
+      part_nbr++;
+    }
+  }
+
+  // Guard region. See Note #2.
+  // A bug exists in some versions of ARM_MPU_RBAR(). Set base addr manually.
+  part_rbar[part_nbr] = ARM_MPU_RBAR(MPU_RBAR_BASE_ADDR_NONE,
+                                     ARM_MPU_SH_NON,
+                                     MPU_RBAR_AP_READ_ONLY,
+                                     MPU_RBAR_AP_PRIVILEGED,
+                                     MPU_RBAR_XN_NON_EXECUTION)
+                        | (address_begin & MPU_RBAR_BASE_Msk);
+  part_rlar[part_nbr] = ARM_MPU_RLAR(guard_limit, MPU_MEMORY_ATTRIBUTE_IX_0);
+  part_nbr++;
+
+  // The first part reuses the split region, if any.
+  new_region_nbr = (index_region < region_nbr) ? (region_nbr + part_nbr - 1u)
+                   : (region_nbr + part_nbr);
+  if (new_region_nbr > region_count) {
+    return SL_STATUS_NO_MORE_RESOURCE;
+  }
+
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+
+  ARM_MPU_Disable();
+
+  // Same memory attributes as in sl_mpu_disable_execute_from_ram(), in case
+  // the guard is the first region configured.
+  ARM_MPU_SetMemAttr(MPU_MEMORY_ATTRIBUTE_IX_0,
+                     ARM_MPU_ATTR(ARM_MPU_ATTR_MEMORY_(1, 0, 1, 0), 0));
+
+  for (uint32_t i = 0u; i < part_nbr; i++) {
+    if ((i == 0u) && (index_region < region_nbr)) {
+      ARM_MPU_SetRegion(index_region, part_rbar[i], part_rlar[i]);
+    } else {
+      ARM_MPU_SetRegion(region_nbr, part_rbar[i], part_rlar[i]);
+      region_nbr++;
+    }
+  }
+
+  // Enable MPU with default background region
+  ARM_MPU_Enable(MPU_CTRL_PRIVDEFENA_Msk);
+
+  __DSB();
+  __ISB();
+
+  CORE_EXIT_ATOMIC();
+
+  return SL_STATUS_OK;
+}
+
 #if __CORTEX_M != (0u)
 /**************************************************************************//**
  * MemManage default exception handler. Reset target.
@@ -0,0 +1,186 @@
+/***************************************************************************//**
+ * @file
+ * @brief Main loop profiler.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#ifndef _SL_MAIN_PROFILER_H
+#define _SL_MAIN_PROFILER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sl_status.h"
+#include "sl_main_profiler_config.h"
+
+#if defined(SL_COMPONENT_CATALOG_PRESENT)
+#include "sl_component_catalog.h"
+#endif
+
+#if defined(SL_CATALOG_IOSTREAM_PRESENT)
+#include "sl_iostream.h"
+#endif
+
+/***************************************************************************//**
+ * @addtogroup sl_main System Setup (sl_main)
+ * @{
+ ******************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Profiled sections
+typedef enum {
+  SL_MAIN_PROFILER_PROBE_PLATFORM = 0,   ///< sli_platform_process_action()
+  SL_MAIN_PROFILER_PROBE_SERVICE,        ///< sli_service_process_action()
+  SL_MAIN_PROFILER_PROBE_STACK,          ///< sli_stack_process_action()
+  SL_MAIN_PROFILER_PROBE_INTERNAL_APP,   ///< sli_internal_app_process_action()
+  SL_MAIN_PROFILER_PROBE_APP,            ///< app_process_action()
+  SL_MAIN_PROFILER_PROBE_BT_COMPONENTS,  ///< Component handlers of a Bluetooth event
+  SL_MAIN_PROFILER_PROBE_BT_APP,         ///< sl_bt_on_event()
+  SL_MAIN_PROFILER_PROBE_COUNT
+} sl_main_profiler_probe_t;
+
+/// Statistics of a profiled section
+typedef struct {
+  uint32_t count;                                    ///< Number of runs
+  uint32_t max;                                      ///< Longest run, in cycles
+  uint64_t total;                                    ///< Sum of all runs, in cycles
+  uint32_t buckets[SL_MAIN_PROFILER_BUCKET_COUNT];   ///< Histogram of the runs
+} sl_main_profiler_stats_t;
+
+/// Size of a probe summary in sl_main_profiler_serialize() output
+#define SL_MAIN_PROFILER_SUMMARY_SIZE  12
+
+/******************************************************************************
+ * @brief Runs code and records its duration for a probe.
+ *
+ * @param[in] probe     Probe, sl_main_profiler_probe_t.
+ * @param[in] yourcode  Code to run.
+ *
+ * @note The code is run as is when SL_MAIN_PROFILER_ENABLE is 0.
+ *****************************************************************************/
+#if (SL_MAIN_PROFILER_ENABLE == 1)
+#define SL_MAIN_PROFILER_SECTION(probe, yourcode)                         \
+  {                                                                       \
+    uint64_t sl_main_profiler_start = sl_main_profiler_get_cycles();      \
+    {                                                                     \
+      yourcode                                                            \
+    }                                                                     \
+    sl_main_profiler_record((probe),                                      \
+                            sl_main_profiler_get_elapsed_cycles(          \
+                              sl_main_profiler_start));                   \
+  }
+#else
+#define SL_MAIN_PROFILER_SECTION(probe, yourcode) \
+  {                                               \
+    yourcode                                      \
+  }
+#endif
+
+/******************************************************************************
+ * @brief Initializes the profiler and starts its cycle counter.
+ *
+ * @note The cycle counter is the DWT cycle counter on target and the
+ *       monotonic clock, in nanoseconds, on the host.
+ *****************************************************************************/
+void sl_main_profiler_init(void);
+
+/******************************************************************************
+ * @brief Gets the current cycle count.
+ *
+ * @return Cycle count. The DWT cycle counter is 32-bit and wraps around.
+ *****************************************************************************/
+uint64_t sl_main_profiler_get_cycles(void);
+
+/******************************************************************************
+ * @brief Gets the cycles elapsed since a cycle count.
+ *
+ * @param[in] start  Cycle count from sl_main_profiler_get_cycles().
+ *
+ * @return Elapsed cycles. Durations that do not fit 32 bits are recorded as
+ *         UINT32_MAX.
+ *****************************************************************************/
+uint32_t sl_main_profiler_get_elapsed_cycles(uint64_t start);
+
+/******************************************************************************
+ * @brief Records the duration of a section.
+ *
+ * @param[in] probe   Probe.
+ * @param[in] cycles  Duration, in cycles.
+ *****************************************************************************/
+void sl_main_profiler_record(sl_main_profiler_probe_t probe,
+                             uint32_t cycles);
+
+/******************************************************************************
+ * @brief Gets the statistics of a probe.
+ *
+ * @param[in]  probe  Probe.
+ * @param[out] stats  Statistics.
+ *
+ * @return SL_STATUS_OK if successful, SL_STATUS_INVALID_PARAMETER if the probe
+ *         is not valid.
+ *****************************************************************************/
+sl_status_t sl_main_profiler_get_stats(sl_main_profiler_probe_t probe,
+                                       sl_main_profiler_stats_t *stats);
+
+/******************************************************************************
+ * @brief Clears the statistics of all probes.
+ *****************************************************************************/
+void sl_main_profiler_reset(void);
+
+/******************************************************************************
+ * @brief Writes a summary of all probes, e.g. for a diagnostics GATT
+ *        characteristic.
+ *
+ * @param[out] buffer  Output buffer.
+ * @param[in]  size    Buffer size, in bytes.
+ *
+ * @return Number of bytes written.
+ *
+ * @note For each probe in sl_main_profiler_probe_t order, the run count, the
+ *       longest run and the mean run, as little endian 32-bit values. Probes
+ *       that do not fit in the buffer are left out.
+ *****************************************************************************/
+size_t sl_main_profiler_serialize(uint8_t *buffer,
+                                  size_t size);
+
+#if defined(SL_CATALOG_IOSTREAM_PRESENT)
+/******************************************************************************
+ * @brief Prints the statistics and histograms of all probes.
+ *
+ * @param[in] stream  I/O stream, SL_IOSTREAM_STDOUT for the default stream.
+ *****************************************************************************/
+void sl_main_profiler_dump(sl_iostream_t *stream);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} (end addtogroup sl_main) */
+
+#endif // _SL_MAIN_PROFILER_H
@@ -28,6 +28,7 @@
  *
  ******************************************************************************/
 #include "sl_event_handler.h"
+#include "sl_main_profiler.h"
 
 /******************************************************************************
  * @brief Action(s) to perform periodically from the main loop.
@@ -41,8 +42,8 @@
  *****************************************************************************/
 void sl_main_process_action(void)
 {
-  sli_platform_process_action();
-  sli_service_process_action();
-  sli_stack_process_action();
-  sli_internal_app_process_action();
+  SL_MAIN_PROFILER_SECTION(SL_MAIN_PROFILER_PROBE_PLATFORM, sli_platform_process_action(); )
+  SL_MAIN_PROFILER_SECTION(SL_MAIN_PROFILER_PROBE_SERVICE, sli_service_process_action(); )
+  SL_MAIN_PROFILER_SECTION(SL_MAIN_PROFILER_PROBE_STACK, sli_stack_process_action(); )
+  SL_MAIN_PROFILER_SECTION(SL_MAIN_PROFILER_PROBE_INTERNAL_APP, sli_internal_app_process_action(); )
 }
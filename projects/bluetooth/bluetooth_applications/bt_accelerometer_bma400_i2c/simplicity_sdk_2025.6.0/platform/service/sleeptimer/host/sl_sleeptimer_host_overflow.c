@@ -0,0 +1,330 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the Sleeptimer overflow interrupt against the 64-bit readers
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Checks sl_sleeptimer_get_tick_count64() and sl_sleeptimer_get_time_64()
+ * against the overflow interrupt preempting them.
+ *
+ * The readers do not mask interrupts and rely on the overflow sequence to
+ * start over when the overflow interrupt ran in between their reads. Through
+ * the read hook of the host HAL, the virtual clock is advanced across the
+ * counter wrap-around right before each read of the counter or interrupt
+ * flags made by a reader, one read after the other:
+ * - with the interrupt unmasked, the overflow interrupt runs at that point;
+ * - with the interrupt masked, like for a reader called from a critical
+ *   section or a higher priority interrupt, the overflow is left pending.
+ *
+ * Each value read must be the value before or after the clock was advanced,
+ * and the values read with the hook removed must match the tick count and
+ * time computed from the ticks elapsed on the virtual clock. A set of random
+ * cases follows, where the values read must also never go back.
+ *
+ * The timer frequency is not a divider of 2^32, so that the wall clock
+ * carries a tick rest from one overflow to the next.
+ *
+ * Usage: sl_sleeptimer_host_overflow [-r seed] [-n random cases]
+ ******************************************************************************/
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "sl_sleeptimer.h"
+#include "sl_sleeptimer_host.h"
+
+#if !SL_SLEEPTIMER_WALLCLOCK_CONFIG
+#error "The overflow test requires SL_SLEEPTIMER_WALLCLOCK_CONFIG."
+#endif
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+#define HOST_COUNTER_START         (UINT32_MAX - 1000u)
+#define HOST_TIME_START            3944678400ULL // 2025-01-01 00:00:00, 1900 epoch
+#define HOST_COUNTER_TICKS         (UINT32_MAX + (uint64_t)1)
+#define HOST_READ_COUNT_MAX        16u
+#define HOST_RANDOM_COUNT_DEFAULT  100000u
+
+/*******************************************************************************
+ ********************************   DATA TYPES   *******************************
+ ******************************************************************************/
+
+// Reader under test.
+typedef uint64_t (*host_reader_t)(void);
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+// Ticks on the counter when the time was set.
+static uint32_t host_set_counter;
+
+// Read, counted from 0 for each call of a reader, before which the clock is
+// advanced.
+static uint32_t host_inject_index;
+static uint32_t host_read_index;
+static uint64_t host_inject_ticks;
+static bool host_is_injected;
+
+static uint64_t host_check_count;
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Checks a condition.
+ ******************************************************************************/
+static void host_expect(bool condition, const char *what)
+{
+  if (!condition) {
+    fprintf(stderr, "FAIL: %s\n", what);
+    exit(EXIT_FAILURE);
+  }
+  host_check_count++;
+}
+
+/***************************************************************************//**
+ * Reads the 64-bit tick count.
+ ******************************************************************************/
+static uint64_t host_read_tick_count(void)
+{
+  return sl_sleeptimer_get_tick_count64();
+}
+
+/***************************************************************************//**
+ * Reads the 64-bit time.
+ ******************************************************************************/
+static uint64_t host_read_time(void)
+{
+  return sl_sleeptimer_get_time_64();
+}
+
+/***************************************************************************//**
+ * Computes the tick count from the ticks elapsed on the virtual clock.
+ ******************************************************************************/
+static uint64_t host_expected_tick_count(void)
+{
+  return HOST_COUNTER_START + sl_sleeptimer_host_get_elapsed_ticks();
+}
+
+/***************************************************************************//**
+ * Computes the time from the ticks elapsed on the virtual clock. The time was
+ * set before the first overflow.
+ ******************************************************************************/
+static uint64_t host_expected_time(void)
+{
+  uint32_t freq = sl_sleeptimer_get_timer_frequency();
+
+  return HOST_TIME_START - (host_set_counter / freq) + (host_expected_tick_count() / freq);
+}
+
+/***************************************************************************//**
+ * Advances the clock before the selected read of the reader.
+ *
+ * @note The overflow interrupt reads the registers too, so the hook is removed
+ *       while the clock is advanced.
+ ******************************************************************************/
+static void host_read_hook(void)
+{
+  if (host_read_index++ == host_inject_index) {
+    sl_sleeptimer_host_set_read_hook(NULL);
+    sl_sleeptimer_host_advance(host_inject_ticks);
+    sl_sleeptimer_host_set_read_hook(host_read_hook);
+    host_is_injected = true;
+  }
+}
+
+/***************************************************************************//**
+ * Advances the clock until the counter is a number of ticks before its
+ * wrap-around.
+ ******************************************************************************/
+static void host_move_before_wrap(uint32_t ticks_to_wrap)
+{
+  uint32_t counter = sl_sleeptimer_get_tick_count();
+
+  sl_sleeptimer_host_advance((uint32_t)(0u - ticks_to_wrap - counter));
+}
+
+/***************************************************************************//**
+ * Runs a reader with the clock advanced before one of its reads.
+ *
+ * @param reader Reader under test.
+ * @param read_index Read before which the clock is advanced.
+ * @param ticks Ticks to advance the clock by.
+ * @param masked true to leave the overflow pending until the reader returns.
+ * @param previous Value read by the previous case, to check it never goes back.
+ *
+ * @return true if the clock was advanced, false if the reader made fewer reads.
+ ******************************************************************************/
+static bool host_check_read(host_reader_t reader,
+                            uint32_t read_index,
+                            uint64_t ticks,
+                            bool masked,
+                            uint64_t *previous)
+{
+  bool is_time = (reader == host_read_time);
+  uint64_t before;
+  uint64_t value;
+  uint64_t after;
+
+  before = reader();
+  host_expect(before == (is_time ? host_expected_time() : host_expected_tick_count()),
+              "value before the overflow");
+  host_expect(before >= *previous, "value never goes back");
+
+  host_inject_index = read_index;
+  host_inject_ticks = ticks;
+  host_read_index = 0;
+  host_is_injected = false;
+  sl_sleeptimer_host_set_irq_masked(masked);
+  sl_sleeptimer_host_set_read_hook(host_read_hook);
+  value = reader();
+  sl_sleeptimer_host_set_read_hook(NULL);
+  sl_sleeptimer_host_set_irq_masked(false);
+
+  after = reader();
+  host_expect(after == (is_time ? host_expected_time() : host_expected_tick_count()),
+              "value after the overflow");
+  if (host_is_injected) {
+    host_expect((value == before) || (value == after), "value read across the overflow");
+  } else {
+    host_expect(value == before, "value read without overflow");
+  }
+  *previous = after;
+
+  return host_is_injected;
+}
+
+/***************************************************************************//**
+ * Advances the clock across the wrap-around before each read of the readers.
+ ******************************************************************************/
+static void host_check_all_reads(void)
+{
+  static const uint32_t ticks_to_wrap[] = { 1u, 2u, 1000u, 40000u };
+  static const uint32_t ticks_past_wrap[] = { 0u, 1u, 31999u, 32000u, 100000u };
+  uint64_t previous = 0;
+  uint32_t case_count = 0;
+
+  for (uint32_t masked = 0; masked < 2u; masked++) {
+    for (uint32_t reader = 0; reader < 2u; reader++) {
+      for (size_t wrap = 0; wrap < (sizeof(ticks_to_wrap) / sizeof(ticks_to_wrap[0])); wrap++) {
+        for (size_t past = 0; past < (sizeof(ticks_past_wrap) / sizeof(ticks_past_wrap[0])); past++) {
+          uint32_t read_index;
+
+          previous = 0;
+          for (read_index = 0; read_index < HOST_READ_COUNT_MAX; read_index++) {
+            host_move_before_wrap(ticks_to_wrap[wrap]);
+            if (!host_check_read((reader == 0) ? host_read_tick_count : host_read_time,
+                                 read_index,
+                                 (uint64_t)ticks_to_wrap[wrap] + ticks_past_wrap[past],
+                                 masked != 0,
+                                 &previous)) {
+              break;
+            }
+            case_count++;
+          }
+          host_expect(read_index < HOST_READ_COUNT_MAX, "reader completes");
+        }
+      }
+    }
+  }
+  printf("%" PRIu32 " overflows before a read checked\n", case_count);
+}
+
+/***************************************************************************//**
+ * Advances the clock by random steps before random reads of the readers.
+ ******************************************************************************/
+static void host_check_random_reads(uint32_t count)
+{
+  uint64_t previous_tick_count = 0;
+  uint64_t previous_time = 0;
+
+  for (uint32_t index = 0; index < count; index++) {
+    bool is_time = ((rand() & 1) != 0);
+    uint64_t ticks = (uint32_t)rand() % 200000u;
+
+    host_move_before_wrap((uint32_t)rand() % 100000u);
+    (void)host_check_read(is_time ? host_read_time : host_read_tick_count,
+                          (uint32_t)rand() % 8u,
+                          ticks,
+                          (rand() & 1) != 0,
+                          is_time ? &previous_time : &previous_tick_count);
+  }
+  printf("%" PRIu32 " random overflows checked\n", count);
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Runs the overflow test.
+ ******************************************************************************/
+int main(int argc, char *argv[])
+{
+  uint32_t seed = 1u;
+  uint32_t random_count = HOST_RANDOM_COUNT_DEFAULT;
+  int option;
+
+  while ((option = getopt(argc, argv, "r:n:")) != -1) {
+    switch (option) {
+      case 'r':
+        seed = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'n':
+        random_count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      default:
+        fprintf(stderr, "usage: %s [-r seed] [-n random cases]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+  }
+  srand(seed);
+
+  sl_sleeptimer_host_set_counter(HOST_COUNTER_START);
+  sl_sleeptimer_init();
+  host_expect((HOST_COUNTER_TICKS % sl_sleeptimer_get_timer_frequency()) != 0,
+              "timer frequency leaves a tick rest");
+  host_set_counter = sl_sleeptimer_get_tick_count();
+  host_expect(sl_sleeptimer_set_time_64(HOST_TIME_START) == SL_STATUS_OK, "set time");
+
+  host_check_all_reads();
+  host_check_random_reads(random_count);
+  printf("%" PRIu64 " overflow checks ok\n", host_check_count);
+
+  return EXIT_SUCCESS;
+}
@@ -64,6 +64,30 @@
 #define TIME_64_BIT_YEAR_MAX                    (11899u - TIME_NTP_EPOCH)                                ///< Max 64 bit format year based from a 1900 epoch
 #define TIME_64_TO_32_EPOCH_OFFSET_SEC          TIME_NTP_EPOCH_OFFSET_SEC
 #define TIME_UNIX_TO_NTP_MAX                    (0xFFFFFFFF - TIME_NTP_EPOCH_OFFSET_SEC)
+#define TIME_DAY_PER_ERA                        (146097u)                                                ///< Days in 400 years
+#define TIME_DAY_COUNT_MARCH_0000_TO_NTP_EPOCH  (693901u)                                                ///< Days from March 1st of year 0 to the NTP epoch
+
+#if !defined(SL_SLEEPTIMER_TIMER_QUEUE)
+#define SL_SLEEPTIMER_TIMER_QUEUE_DELTA_LIST    0
+#define SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP      1
+#define SL_SLEEPTIMER_TIMER_QUEUE               SL_SLEEPTIMER_TIMER_QUEUE_DELTA_LIST
+#endif
+
+#if (SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP)
+#if !defined(SL_SLEEPTIMER_TIMER_HEAP_SIZE)
+#define SL_SLEEPTIMER_TIMER_HEAP_SIZE           32
+#endif
+#if (SL_SLEEPTIMER_TIMER_HEAP_SIZE < 1) || (SL_SLEEPTIMER_TIMER_HEAP_SIZE > 1024)
+#error "SL_SLEEPTIMER_TIMER_HEAP_SIZE must be between 1 and 1024."
+#endif
+#endif
+
+#if !defined(SL_SLEEPTIMER_SLACK_TIMER_COUNT)
+#define SL_SLEEPTIMER_SLACK_TIMER_COUNT         4
+#endif
+#if (SL_SLEEPTIMER_SLACK_TIMER_COUNT < 1) || (SL_SLEEPTIMER_SLACK_TIMER_COUNT > 255)
+#error "SL_SLEEPTIMER_SLACK_TIMER_COUNT must be between 1 and 255."
+#endif
 
 // Minimum count difference used when evaluating if a timer expired or not after an interrupt
 // by comparing the current count value and the expected expiration count value.
@@ -84,6 +108,9 @@ typedef uint32_t sl_sleeptimer_tick_count_t;
 // Overflow counter used to provide 64-bits tick count.
 static volatile uint32_t overflow_counter;
 
+// Incremented each time the overflow counter or the wall clock is updated.
+static volatile uint32_t overflow_sequence;
+
 #if SL_SLEEPTIMER_WALLCLOCK_CONFIG
 // Current time count.
 static volatile sl_sleeptimer_timestamp_64_t second_count;
@@ -100,12 +127,56 @@ static uint32_t calculated_sec_count = 0;
 // Timer frequency in Hz.
 static uint32_t timer_frequency;
 
-// Head of timer list.
+#if (SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP)
+// Timer heap entry.
+typedef struct {
+  sl_sleeptimer_timer_handle_t *handle; // Running timer.
+  uint64_t deadline;                    // Expiration tick count since initialization.
+  uint32_t sequence;                    // Insertion order, for timers with the same deadline.
+} timer_heap_entry_t;
+
+// Running timers, as a binary min-heap ordered by expiration time. The handle
+// layout is shared with prebuilt libraries, so the expiration time is kept
+// here and the delta field of a timer in the heap holds its heap position.
+static timer_heap_entry_t timer_heap[SL_SLEEPTIMER_TIMER_HEAP_SIZE];
+
+// Number of timers in the heap.
+static uint32_t timer_heap_count;
+
+// Ticks elapsed since initialization at last update of the timer queue.
+static uint64_t timer_queue_time;
+
+// Sequence number given to the next timer inserted in the heap.
+static uint32_t timer_sequence;
+#endif
+
+// Head of timer list. With the min-heap, holds the timers started while the
+// heap was full.
 static sl_sleeptimer_timer_handle_t *timer_head;
 
-// Count at last update of delta of first timer.
+// Slack of a running timer.
+typedef struct {
+  const sl_sleeptimer_timer_handle_t *handle; // Running timer.
+  sl_sleeptimer_tick_count_t slack;           // Ticks the timer may expire late.
+} slack_timer_t;
+
+// Running timers started with a slack. Timers that are not in this table have
+// no slack. The handle layout is shared with prebuilt libraries, so the slack
+// is kept here.
+static slack_timer_t slack_timers[SL_SLEEPTIMER_SLACK_TIMER_COUNT];
+
+// Number of timers in the slack table.
+static uint32_t slack_timer_count;
+
+// Count at last update of the timer queue.
 static volatile sl_sleeptimer_tick_count_t last_delta_update_count;
 
+// Count at which the timer compare was last set.
+static volatile sl_sleeptimer_tick_count_t next_compare_count;
+
+// Timer compare interrupts and timer expirations since the last reset.
+static sl_sleeptimer_wakeup_statistics_t wakeup_statistics;
+
 // Initialization flag.
 static bool is_sleeptimer_initialized = false;
 
@@ -119,17 +190,58 @@ static uint32_t max_millisecond_conversion;
 static volatile bool sleep_on_isr_exit = false;
 
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
-static void delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
-                                    sl_sleeptimer_tick_count_t timeout);
+static sl_status_t timer_queue_insert(sl_sleeptimer_timer_handle_t *handle,
+                                      sl_sleeptimer_tick_count_t timeout);
 
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
-static sl_status_t delta_list_remove_timer(sl_sleeptimer_timer_handle_t *handle);
+static sl_status_t timer_queue_remove(sl_sleeptimer_timer_handle_t *handle);
 
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
 static sl_status_t set_comparator_for_next_timer(void);
 
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
-static void update_delta_list(void);
+static void update_timer_queue(void);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static sl_sleeptimer_timer_handle_t *get_first_timer(void);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static sl_sleeptimer_timer_handle_t *get_expired_timer(void);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static bool is_timer_in_queue(const sl_sleeptimer_timer_handle_t *handle);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static bool get_queued_timer_delay(const sl_sleeptimer_timer_handle_t *handle,
+                                   sl_sleeptimer_tick_count_t *delay);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static sl_sleeptimer_tick_count_t get_coalesced_delay(void);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static sl_status_t set_timer_slack(const sl_sleeptimer_timer_handle_t *handle,
+                                   sl_sleeptimer_tick_count_t slack);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static sl_sleeptimer_tick_count_t get_timer_slack(const sl_sleeptimer_timer_handle_t *handle);
+
+#if (SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP)
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static bool is_timer_in_heap(const sl_sleeptimer_timer_handle_t *handle);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static sl_sleeptimer_tick_count_t get_timer_delay(const timer_heap_entry_t *entry);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static bool timer_heap_is_before(const timer_heap_entry_t *entry_a,
+                                 const timer_heap_entry_t *entry_b);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static void timer_heap_sift_up(uint32_t index);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+static void timer_heap_sift_down(uint32_t index);
+#endif
 
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
 __STATIC_INLINE uint32_t div_to_log2(uint32_t div);
@@ -141,6 +253,7 @@ SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
 static sl_status_t create_timer(sl_sleeptimer_timer_handle_t *handle,
                                 sl_sleeptimer_tick_count_t timeout_initial,
                                 sl_sleeptimer_tick_count_t timeout_periodic,
+                                sl_sleeptimer_tick_count_t slack,
                                 sl_sleeptimer_timer_callback_t callback,
                                 void *callback_data,
                                 uint8_t priority,
@@ -158,9 +271,10 @@ static void delay_callback(sl_sleeptimer_timer_handle_t *handle,
 
 #if SL_SLEEPTIMER_WALLCLOCK_CONFIG
 static bool is_leap_year(uint16_t year);
-static uint16_t number_of_leap_days(uint32_t base_year, uint32_t current_year);
 
-static sl_sleeptimer_weekDay_t compute_day_of_week(uint32_t day);
+static uint32_t days_from_civil(uint16_t year, sl_sleeptimer_month_t month, uint8_t month_day);
+static void civil_from_days(uint32_t days, sl_sleeptimer_date_t *date);
+
 static sl_sleeptimer_weekDay_t compute_day_of_week_64(uint64_t day);
 static uint16_t compute_day_of_year(sl_sleeptimer_month_t month, uint8_t day, bool isLeapYear);
 
@@ -181,6 +295,11 @@ static const uint8_t days_in_month[2u][12] = {
   { 31u, 28u, 31u, 30u, 31u, 30u, 31u, 31u, 30u, 31u, 30u, 31u },
   { 31u, 29u, 31u, 30u, 31u, 30u, 31u, 31u, 30u, 31u, 30u, 31u }
 };
+
+static const uint16_t days_before_month[12] = {
+  /* Jan  Feb  Mar  Apr   May   Jun   Jul   Aug   Sep   Oct   Nov   Dec */
+  0u, 31u, 59u, 90u, 120u, 151u, 181u, 212u, 243u, 273u, 304u, 334u
+};
 #endif
 
 /**************************************************************************//**
@@ -192,9 +311,15 @@ sl_status_t sl_sleeptimer_init(void)
 
   CORE_ENTER_ATOMIC();
   if (!is_sleeptimer_initialized) {
+#if (SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP)
+    timer_heap_count = 0u;
+    timer_queue_time = 0u;
+#endif
     timer_head  = NULL;
+    slack_timer_count = 0u;
     last_delta_update_count = 0u;
     overflow_counter = 0u;
+    overflow_sequence++;
     sleeptimer_hal_init_timer();
     sleeptimer_hal_enable_int(SLEEPTIMER_EVENT_OF);
     timer_frequency = sleeptimer_hal_get_timer_frequency();
@@ -225,6 +350,26 @@ sl_status_t sl_sleeptimer_start_timer(sl_sleeptimer_timer_handle_t *handle,
                                       void *callback_data,
                                       uint8_t priority,
                                       uint16_t option_flags)
+{
+  return sl_sleeptimer_start_timer_with_slack(handle,
+                                              timeout,
+                                              0,
+                                              callback,
+                                              callback_data,
+                                              priority,
+                                              option_flags);
+}
+
+/**************************************************************************//**
+ * Starts a 32 bits timer that may expire late.
+ *****************************************************************************/
+sl_status_t sl_sleeptimer_start_timer_with_slack(sl_sleeptimer_timer_handle_t *handle,
+                                                 uint32_t timeout,
+                                                 uint32_t slack,
+                                                 sl_sleeptimer_timer_callback_t callback,
+                                                 void *callback_data,
+                                                 uint8_t priority,
+                                                 uint16_t option_flags)
 {
   bool is_running = false;
 
@@ -243,6 +388,7 @@ sl_status_t sl_sleeptimer_start_timer(sl_sleeptimer_timer_handle_t *handle,
   return create_timer(handle,
                       timeout,
                       0,
+                      slack,
                       callback,
                       callback_data,
                       priority,
@@ -273,6 +419,7 @@ sl_status_t sl_sleeptimer_restart_timer(sl_sleeptimer_timer_handle_t *handle,
   return create_timer(handle,
                       timeout,
                       0,
+                      0,
                       callback,
                       callback_data,
                       priority,
@@ -306,6 +453,7 @@ sl_status_t sl_sleeptimer_start_periodic_timer(sl_sleeptimer_timer_handle_t *han
   return create_timer(handle,
                       timeout,
                       timeout,
+                      0,
                       callback,
                       callback_data,
                       priority,
@@ -321,10 +469,32 @@ sl_status_t sl_sleeptimer_start_periodic_timer_ms(sl_sleeptimer_timer_handle_t *
                                                   void *callback_data,
                                                   uint8_t priority,
                                                   uint16_t option_flags)
+{
+  return sl_sleeptimer_start_periodic_timer_ms_with_slack(handle,
+                                                          timeout_ms,
+                                                          0,
+                                                          callback,
+                                                          callback_data,
+                                                          priority,
+                                                          option_flags);
+}
+
+/**************************************************************************//**
+ * Starts a 32 bits periodic timer using milliseconds as the timebase, that may
+ * expire late.
+ *****************************************************************************/
+sl_status_t sl_sleeptimer_start_periodic_timer_ms_with_slack(sl_sleeptimer_timer_handle_t *handle,
+                                                             uint32_t timeout_ms,
+                                                             uint32_t slack_ms,
+                                                             sl_sleeptimer_timer_callback_t callback,
+                                                             void *callback_data,
+                                                             uint8_t priority,
+                                                             uint16_t option_flags)
 {
   bool is_running = false;
   sl_status_t status;
   uint32_t timeout_tick;
+  uint32_t slack_tick;
 
   if (handle == NULL) {
     return SL_STATUS_NULL_POINTER;
@@ -340,6 +510,11 @@ sl_status_t sl_sleeptimer_start_periodic_timer_ms(sl_sleeptimer_timer_handle_t *
     return status;
   }
 
+  status = sl_sleeptimer_ms32_to_tick(slack_ms, &slack_tick);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
   // Calculate ms to ticks conversion error
   handle->conversion_error = 1000
                              - (((uint64_t)timeout_ms * sl_sleeptimer_get_timer_frequency())
@@ -355,6 +530,7 @@ sl_status_t sl_sleeptimer_start_periodic_timer_ms(sl_sleeptimer_timer_handle_t *
   return create_timer(handle,
                       timeout_tick,
                       timeout_tick,
+                      slack_tick,
                       callback,
                       callback_data,
                       priority,
@@ -385,6 +561,7 @@ sl_status_t sl_sleeptimer_restart_periodic_timer(sl_sleeptimer_timer_handle_t *h
   return create_timer(handle,
                       timeout,
                       timeout,
+                      0,
                       callback,
                       callback_data,
                       priority,
@@ -433,6 +610,7 @@ sl_status_t sl_sleeptimer_restart_periodic_timer_ms(sl_sleeptimer_timer_handle_t
   return create_timer(handle,
                       timeout_tick,
                       timeout_tick,
+                      0,
                       callback,
                       callback_data,
                       priority,
@@ -461,19 +639,20 @@ sl_status_t sl_sleeptimer_stop_timer(sl_sleeptimer_timer_handle_t *handle)
 #endif
 
   CORE_ENTER_CRITICAL();
-  update_delta_list();
+  update_timer_queue();
 
   // If first timer in list, update timer comparator.
-  if (timer_head == handle) {
+  if (get_first_timer() == handle) {
     set_comparator = true;
   }
 
-  error = delta_list_remove_timer(handle);
+  error = timer_queue_remove(handle);
   if (error != SL_STATUS_OK) {
     CORE_EXIT_CRITICAL();
 
     return error;
   }
+  set_timer_slack(handle, 0u);
 
   if (set_comparator) {
     error = set_comparator_for_next_timer();
@@ -493,21 +672,12 @@ sl_status_t sl_sleeptimer_is_timer_running(const sl_sleeptimer_timer_handle_t *h
                                            bool *running)
 {
   CORE_DECLARE_IRQ_STATE;
-  sl_sleeptimer_timer_handle_t *current;
 
   if (handle == NULL || running == NULL) {
     return SL_STATUS_NULL_POINTER;
   } else {
-    *running = false;
     CORE_ENTER_ATOMIC();
-    current = timer_head;
-    while (current != NULL && !*running) {
-      if (current == handle) {
-        *running = true;
-      } else {
-        current = current->next;
-      }
-    }
+    *running = is_timer_in_queue(handle);
     CORE_EXIT_ATOMIC();
   }
   return SL_STATUS_OK;
@@ -520,7 +690,6 @@ sl_status_t sl_sleeptimer_get_timer_time_remaining(const sl_sleeptimer_timer_han
                                                    uint32_t *time)
 {
   CORE_DECLARE_IRQ_STATE;
-  sl_sleeptimer_timer_handle_t *current;
 
   if (handle == NULL || time == NULL) {
     return SL_STATUS_NULL_POINTER;
@@ -528,17 +697,8 @@ sl_status_t sl_sleeptimer_get_timer_time_remaining(const sl_sleeptimer_timer_han
 
   CORE_ENTER_ATOMIC();
 
-  update_delta_list();
-  *time  = handle->delta;
-
-  // Retrieve timer in list and add the deltas.
-  current = timer_head;
-  while (current != handle && current != NULL) {
-    *time += current->delta;
-    current = current->next;
-  }
-
-  if (current != handle) {
+  update_timer_queue();
+  if (!get_queued_timer_delay(handle, time)) {
     CORE_EXIT_ATOMIC();
 
     return SL_STATUS_NOT_READY;
@@ -566,6 +726,10 @@ sl_status_t sl_sleeptimer_get_remaining_time_of_first_timer(uint16_t option_flag
   CORE_DECLARE_IRQ_STATE;
   sl_sleeptimer_timer_handle_t *current;
   uint32_t time = 0;
+  bool found = false;
+#if (SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP)
+  const timer_heap_entry_t *entry = NULL;
+#endif
 
   CORE_ENTER_ATOMIC();
   // parse list and retrieve first timer with option flags requirement.
@@ -576,24 +740,79 @@ sl_status_t sl_sleeptimer_get_remaining_time_of_first_timer(uint16_t option_flag
     // Check if the current timer has the flags requested
     if (current->option_flags == option_flags
         || option_flags == SL_SLEEPTIMER_ANY_FLAG) {
-      // Substract time since last compare match.
-      if (time > (sleeptimer_hal_get_counter() - last_delta_update_count)) {
-        time -= (sleeptimer_hal_get_counter() - last_delta_update_count);
-      } else {
-        time = 0;
+      found = true;
+      break;
+    }
+    current = current->next;
+  }
+
+#if (SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP)
+  // Retrieve the earliest timer of the heap with option flags requirement.
+  if (option_flags == SL_SLEEPTIMER_ANY_FLAG) {
+    entry = (timer_heap_count > 0u) ? &timer_heap[0] : NULL;
+  } else {
+    for (uint32_t index = 0u; index < timer_heap_count; index++) {
+      if ((timer_heap[index].handle->option_flags == option_flags)
+          && ((entry == NULL) || timer_heap_is_before(&timer_heap[index], entry))) {
+        entry = &timer_heap[index];
       }
-      *time_remaining = time;
-      CORE_EXIT_ATOMIC();
+    }
+  }
 
-      return SL_STATUS_OK;
+  if ((entry != NULL) && (!found || (get_timer_delay(entry) <= time))) {
+    time = get_timer_delay(entry);
+    found = true;
+  }
+#endif
+
+  if (found) {
+    // Substract time since last compare match.
+    if (time > (sleeptimer_hal_get_counter() - last_delta_update_count)) {
+      time -= (sleeptimer_hal_get_counter() - last_delta_update_count);
+    } else {
+      time = 0;
     }
-    current = current->next;
+    *time_remaining = time;
+    CORE_EXIT_ATOMIC();
+
+    return SL_STATUS_OK;
   }
   CORE_EXIT_ATOMIC();
 
   return SL_STATUS_EMPTY;
 }
 
+/**************************************************************************//**
+ * Gets the wakeup statistics.
+ *****************************************************************************/
+sl_status_t sl_sleeptimer_get_wakeup_statistics(sl_sleeptimer_wakeup_statistics_t *statistics)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if (statistics == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  CORE_ENTER_ATOMIC();
+  *statistics = wakeup_statistics;
+  CORE_EXIT_ATOMIC();
+
+  return SL_STATUS_OK;
+}
+
+/**************************************************************************//**
+ * Resets the wakeup statistics.
+ *****************************************************************************/
+void sl_sleeptimer_reset_wakeup_statistics(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  wakeup_statistics.wakeup_count = 0u;
+  wakeup_statistics.expired_timer_count = 0u;
+  CORE_EXIT_ATOMIC();
+}
+
 /**************************************************************************//**
  * Determines if next timer to expire has the option flag
  * "SL_SLEEPTIMER_POWER_MANAGER_EARLY_WAKEUP_TIMER_FLAG".
@@ -617,7 +836,7 @@ bool sli_sleeptimer_is_power_manager_timer_next_to_expire(void)
   // Make sure that the Power Manager Sleeptimer is actually expired in addition
   // to being the next timer.
   if (next_timer_is_power_manager
-      && ((sl_sleeptimer_get_tick_count() - timer_head->timeout_expected_tc) > MIN_DIFF_BETWEEN_COUNT_AND_EXPIRATION)) {
+      && ((sl_sleeptimer_get_tick_count() - get_first_timer()->timeout_expected_tc) > MIN_DIFF_BETWEEN_COUNT_AND_EXPIRATION)) {
     next_timer_is_power_manager = false;
   }
 
@@ -641,22 +860,36 @@ uint32_t sl_sleeptimer_get_tick_count(void)
 
 /***************************************************************************//**
 * Gets current 64 bits tick count.
+*
+* @note (1) The overflow counter and the timer counter are read without masking
+*           interrupts. The overflow interrupt updates the overflow sequence,
+*           so the reads are started over when it ran in between. Since the
+*           interrupt either runs entirely before or after each read, the
+*           values read with an unchanged sequence are consistent.
+*
+* @note (2) When the counter has wrapped around but the overflow interrupt is
+*           not handled yet, because interrupts are masked by the caller or
+*           the caller runs at a higher priority, the pending overflow is
+*           accounted for here.
 *******************************************************************************/
 uint64_t sl_sleeptimer_get_tick_count64(void)
 {
   uint32_t tick_cnt;
   uint32_t of_cnt;
-  CORE_DECLARE_IRQ_STATE;
-
-  CORE_ENTER_ATOMIC();
-  tick_cnt = sleeptimer_hal_get_counter();
-  of_cnt = overflow_counter;
+  uint32_t sequence;
 
-  if (sli_sleeptimer_hal_is_int_status_set(SLEEPTIMER_EVENT_OF)) {
+  // See Note #1.
+  do {
+    sequence = overflow_sequence;
+    of_cnt = overflow_counter;
     tick_cnt = sleeptimer_hal_get_counter();
-    of_cnt++;
-  }
-  CORE_EXIT_ATOMIC();
+
+    // See Note #2.
+    if (sli_sleeptimer_hal_is_int_status_set(SLEEPTIMER_EVENT_OF)) {
+      tick_cnt = sleeptimer_hal_get_counter();
+      of_cnt++;
+    }
+  } while (sequence != overflow_sequence);
 
   return (((uint64_t) of_cnt) << 32) | tick_cnt;
 }
@@ -688,24 +921,46 @@ sl_sleeptimer_timestamp_t sl_sleeptimer_get_time(void)
 
 /***************************************************************************//**
  * Retrieves current 64 bit time.
+ *
+ * @note (1) The wall clock is read without masking interrupts, the same way as
+ *           the tick count. See sl_sleeptimer_get_tick_count64() Note #1.
+ *
+ * @note (2) A pending overflow is accounted for the same way the overflow
+ *           interrupt does it.
  ******************************************************************************/
 sl_sleeptimer_timestamp_64_t sl_sleeptimer_get_time_64(void)
 {
   uint32_t cnt = 0u;
   uint32_t freq = 0u;
+  uint32_t tick_rest;
+  uint32_t sequence;
   sl_sleeptimer_timestamp_64_t time;
-  CORE_DECLARE_IRQ_STATE;
 
-  cnt = sleeptimer_hal_get_counter();
   freq = sl_sleeptimer_get_timer_frequency();
 
-  CORE_ENTER_ATOMIC();
-  time = second_count + cnt / freq;
+  // See Note #1.
+  do {
+    sequence = overflow_sequence;
+    time = second_count;
+    tick_rest = overflow_tick_rest;
+    cnt = sleeptimer_hal_get_counter();
+
+    // See Note #2.
+    if (sli_sleeptimer_hal_is_int_status_set(SLEEPTIMER_EVENT_OF)) {
+      cnt = sleeptimer_hal_get_counter();
+      tick_rest += calculated_tick_rest;
+      if (tick_rest >= freq) {
+        time++;
+        tick_rest -= freq;
+      }
+      time += calculated_sec_count;
+    }
+  } while (sequence != overflow_sequence);
 
-  if (cnt % freq + overflow_tick_rest >= freq) {
+  time += cnt / freq;
+  if (cnt % freq + tick_rest >= freq) {
     time++;
   }
-  CORE_EXIT_ATOMIC();
 
   return time;
 }
@@ -749,6 +1004,7 @@ sl_status_t sl_sleeptimer_set_time_64(sl_sleeptimer_timestamp_64_t time)
   uint32_t second_time_32 = (temp_time & 0xFFFFFFFF);
 
   overflow_tick_rest = 0;
+  overflow_sequence++;
   counter_sec = cnt / freq;
 
   if (second_time_32 >= counter_sec) {
@@ -841,9 +1097,7 @@ sl_status_t sl_sleeptimer_build_datetime(sl_sleeptimer_date_t *date,
   }
 
   date->day_of_year = compute_day_of_year(date->month, date->month_day, is_leap_year(date->year));
-  date->day_of_week = compute_day_of_week(((date->year - TIME_NTP_UNIX_EPOCH_DIFF)  * TIME_DAY_PER_YEAR)
-                                          + number_of_leap_days(TIME_UNIX_EPOCH, (date->year + TIME_NTP_EPOCH))
-                                          + date->day_of_year - 1);
+  date->day_of_week = compute_day_of_week_64(days_from_civil(date->year, date->month, date->month_day));
 
   return SL_STATUS_OK;
 }
@@ -884,9 +1138,7 @@ sl_status_t sl_sleeptimer_build_datetime_64(sl_sleeptimer_date_t *date,
   }
 
   date->day_of_year = compute_day_of_year(date->month, date->month_day, is_leap_year(date->year));
-  date->day_of_week = compute_day_of_week_64((date->year * TIME_DAY_PER_YEAR)
-                                             + number_of_leap_days(TIME_NTP_EPOCH, (date->year + TIME_NTP_EPOCH))
-                                             + date->day_of_year - 1);
+  date->day_of_week = compute_day_of_week_64(days_from_civil(date->year, date->month, date->month_day));
 
   return SL_STATUS_OK;
 }
@@ -911,49 +1163,23 @@ sl_status_t sl_sleeptimer_convert_time_to_date_64(sl_sleeptimer_timestamp_64_t t
                                                   sl_sleeptimer_time_zone_offset_t time_zone,
                                                   sl_sleeptimer_date_t *date)
 {
-  uint16_t full_year = 0;
-  uint16_t leap_day = 0;
-  uint8_t leap_year_flag = 0;
-  uint8_t current_month = 0;
+  uint32_t days;
+  uint32_t day_sec;
 
   if (!is_valid_time_64(time, TIME_FORMAT_UNIX_64_BIT, time_zone)) {
     return SL_STATUS_INVALID_PARAMETER;
   }
 
   time += time_zone;  // add UTC offset to convert to Standard Time
-  date->sec = time % 60;
-  time /= 60;
-  date->min = time % 60;
-  time /= 60;
-  date->hour = time % 24;
-  time /= 24; // time is now the number of days since 1900
-
-  date->day_of_week = (sl_sleeptimer_weekDay_t)compute_day_of_week_64(time);
-
-  full_year = time / TIME_DAY_PER_YEAR; // Approximates the number of full years
-  uint32_t base_year = 1900u;
-  uint32_t current_year = full_year + base_year;
-
-  if (full_year > 4) { // 1904 is the first leap year since 1900
-    leap_day = number_of_leap_days(base_year, current_year);  // Approximates the number of leap days.
-    full_year = (time - leap_day) / TIME_DAY_PER_YEAR; // Computes the number of year integrating the leap days.
-    current_year = full_year + base_year;
-    leap_day = number_of_leap_days(base_year, current_year); // Computes the actual number of leap days of the previous years.
-  }
-  date->year = full_year; // Year in date struct must be based on a 1900 epoch.
-  if (is_leap_year(date->year)) {
-    leap_year_flag = 1;
-  }
-
-  time = (time - leap_day) - (TIME_DAY_PER_YEAR * full_year);  // Subtracts days of previous year.
-  date->day_of_year = time + 1;
-
-  while (time >= days_in_month[leap_year_flag][current_month]) {
-    time -= days_in_month[leap_year_flag][current_month]; // Subtracts the number of days of the passed month.
-    current_month++;
-  }
-  date->month = (sl_sleeptimer_month_t)current_month;
-  date->month_day = time + 1;
+  days = (uint32_t)(time / TIME_SEC_PER_DAY); // Number of days since 1900
+  day_sec = (uint32_t)(time - ((uint64_t)days * TIME_SEC_PER_DAY));
+  date->sec = day_sec % 60u;
+  day_sec /= 60u;
+  date->min = day_sec % 60u;
+  date->hour = day_sec / 60u;
+
+  date->day_of_week = compute_day_of_week_64(days);
+  civil_from_days(days, date);
   date->time_zone = time_zone;
 
   return SL_STATUS_OK;
@@ -987,39 +1213,11 @@ sl_status_t sl_sleeptimer_convert_date_to_time(sl_sleeptimer_date_t *date,
 sl_status_t sl_sleeptimer_convert_date_to_time_64(sl_sleeptimer_date_t *date,
                                                   sl_sleeptimer_timestamp_64_t *time)
 {
-  uint16_t month_days = 0;
-  uint8_t  month;
-  uint16_t  full_year = 0;
-  uint8_t  leap_year_flag = 0;
-  uint16_t  leap_days = 0;
-
   if (!is_valid_date_64(date)) {
     return SL_STATUS_INVALID_PARAMETER;
   }
 
-  full_year = (date->year);                                  // base year for 64 bits its 1900 not 1970
-  month = date->month;                              // offset to get months value from 1 to 12.
-
-  uint32_t base_year = 1900u;
-  uint32_t current_year = full_year + base_year;
-
-  *time = (full_year * (uint64_t)TIME_SEC_PER_YEAR);
-
-  if (full_year > 4) {                                       // 1904 is the first leap year since 1900
-    leap_days = number_of_leap_days(base_year, current_year);
-    month_days = leap_days;
-  }
-
-  if (is_leap_year(date->year)) {
-    leap_year_flag = 1;
-  }
-
-  for (int i = 0; i < month; i++) {
-    month_days += days_in_month[leap_year_flag][i];         // Add the number of days of the month of the year.
-  }
-
-  month_days += (date->month_day - 1);                       // Add full days of the current month.
-  *time += month_days * TIME_SEC_PER_DAY;
+  *time = (uint64_t)days_from_civil(date->year, date->month, date->month_day) * TIME_SEC_PER_DAY;
   *time += (3600 * date->hour) + (60 * date->min) + date->sec;
   *time -= date->time_zone;
 
@@ -1165,7 +1363,9 @@ void sl_sleeptimer_delay_millisecond(uint16_t time_ms)
 {
   volatile bool wait = true;
   sl_status_t error_code;
-  sl_sleeptimer_timer_handle_t delay_timer;
+  // Initialized since the min-heap reads the delta field of a timer to know if
+  // it is running.
+  sl_sleeptimer_timer_handle_t delay_timer = { 0 };
   uint32_t delay = sl_sleeptimer_ms_to_tick(time_ms);
 
   error_code = sl_sleeptimer_start_timer(&delay_timer,
@@ -1271,8 +1471,9 @@ void process_timer_irq(uint8_t local_flag)
     second_count = second_count + calculated_sec_count;
 #endif
     overflow_counter++;
+    overflow_sequence++;
 
-    update_delta_list();
+    update_timer_queue();
 
     set_comparator_for_next_timer();
   }
@@ -1285,20 +1486,11 @@ void process_timer_irq(uint8_t local_flag)
 
     CORE_ENTER_ATOMIC();
     // Make sure the timers list is up to date with the time elapsed since the last update
-    update_delta_list();
+    update_timer_queue();
 
-    // Process all timers that have expired.
-    while (timer_head && (timer_head->delta == 0)) {
-      sl_sleeptimer_timer_handle_t *temp = timer_head;
-      current = timer_head;
-
-      // Process timers with higher priority first
-      while ((temp != NULL) && (temp->delta == 0)) {
-        if (current->priority > temp->priority) {
-          current = temp;
-        }
-        temp = temp->next;
-      }
+    // Process all timers that have expired, higher priority first.
+    current = get_expired_timer();
+    while (current != NULL) {
       CORE_EXIT_ATOMIC();
 
       process_expired_timer(current);
@@ -1310,7 +1502,8 @@ void process_timer_irq(uint8_t local_flag)
       CORE_ENTER_ATOMIC();
 
       // Re-update the list to account for delays during timer's callback.
-      update_delta_list();
+      update_timer_queue();
+      current = get_expired_timer();
     }
 
     // If the only timer expired is the internal Power Manager one,
@@ -1320,6 +1513,9 @@ void process_timer_irq(uint8_t local_flag)
       sleep_on_isr_exit = true;
     }
 
+    wakeup_statistics.wakeup_count++;
+    wakeup_statistics.expired_timer_count += nb_timer_expire;
+
     sl_status_t error = set_comparator_for_next_timer();
     if (error == SL_STATUS_NULL_POINTER) {
       sleeptimer_hal_disable_int(SLEEPTIMER_EVENT_COMP);
@@ -1345,13 +1541,15 @@ static void delay_callback(sl_sleeptimer_timer_handle_t *handle,
 }
 
 /*******************************************************************************
- * Inserts a timer in the delta list.
+ * Inserts a timer in the timer queue.
  *
  * @param handle Pointer to handle to timer.
  * @param timeout Timer timeout, in ticks.
+ *
+ * @return 0 if successful. Error code otherwise.
  ******************************************************************************/
-static void delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
-                                    sl_sleeptimer_tick_count_t timeout)
+static sl_status_t timer_queue_insert(sl_sleeptimer_timer_handle_t *handle,
+                                      sl_sleeptimer_tick_count_t timeout)
 {
   sl_sleeptimer_tick_count_t local_handle_delta = timeout;
 
@@ -1370,6 +1568,20 @@ static void delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
   }
 #endif
 
+#if (SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP)
+  // Timers with the same expiration time expire in insertion order, as with
+  // the delta list. When the heap is full, the timer goes in the delta list.
+  if (timer_heap_count < SL_SLEEPTIMER_TIMER_HEAP_SIZE) {
+    timer_heap[timer_heap_count].handle = handle;
+    timer_heap[timer_heap_count].deadline = timer_queue_time + local_handle_delta;
+    timer_heap[timer_heap_count].sequence = timer_sequence++;
+    timer_heap_count++;
+    timer_heap_sift_up(timer_heap_count - 1u);
+
+    return SL_STATUS_OK;
+  }
+#endif
+
   handle->delta = local_handle_delta;
 
   if (timer_head != NULL) {
@@ -1400,16 +1612,18 @@ static void delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
     timer_head = handle;
     handle->next = NULL;
   }
+
+  return SL_STATUS_OK;
 }
 
 /*******************************************************************************
- * Removes a timer from delta list.
+ * Removes a timer from the timer queue.
  *
  * @param handle Pointer to handle to timer.
  *
  * @return 0 if successful. Error code otherwise.
  ******************************************************************************/
-static sl_status_t delta_list_remove_timer(sl_sleeptimer_timer_handle_t *handle)
+static sl_status_t timer_queue_remove(sl_sleeptimer_timer_handle_t *handle)
 {
   sl_sleeptimer_timer_handle_t *prev = NULL;
   sl_sleeptimer_timer_handle_t *current = timer_head;
@@ -1418,6 +1632,23 @@ static sl_status_t delta_list_remove_timer(sl_sleeptimer_timer_handle_t *handle)
     return SL_STATUS_NULL_POINTER;
   }
 
+#if (SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP)
+  if (is_timer_in_heap(handle)) {
+    uint32_t index = handle->delta;
+
+    // Move the last timer of the heap in the hole and restore the heap order.
+    timer_heap_count--;
+    if (index != timer_heap_count) {
+      timer_heap[index] = timer_heap[timer_heap_count];
+      timer_heap[index].handle->delta = index;
+      timer_heap_sift_down(index);
+      timer_heap_sift_up(index);
+    }
+
+    return SL_STATUS_OK;
+  }
+#endif
+
   // Retrieve timer in delta list.
   while (current != NULL && current != handle) {
     prev = current;
@@ -1447,17 +1678,23 @@ static sl_status_t delta_list_remove_timer(sl_sleeptimer_timer_handle_t *handle)
  ******************************************************************************/
 static sl_status_t set_comparator_for_next_timer(void)
 {
-  if (timer_head) {
-    if (timer_head->delta > 0) {
+  sl_sleeptimer_timer_handle_t *first_timer = get_first_timer();
+
+  if (first_timer) {
+    sl_sleeptimer_tick_count_t delay = get_coalesced_delay();
+
+    if (delay > 0) {
       sl_sleeptimer_tick_count_t compare_value;
 
-      compare_value = last_delta_update_count + timer_head->delta;
+      compare_value = last_delta_update_count + delay;
+      next_compare_count = compare_value;
 
       sleeptimer_hal_enable_int(SLEEPTIMER_EVENT_COMP);
       sleeptimer_hal_set_compare(compare_value);
     } else {
       // In case timer has already expire, don't attempt to set comparator. Just
       // trigger compare match interrupt.
+      next_compare_count = last_delta_update_count;
       sleeptimer_hal_enable_int(SLEEPTIMER_EVENT_COMP);
       sleeptimer_hal_set_int(SLEEPTIMER_EVENT_COMP);
     }
@@ -1469,14 +1706,20 @@ static sl_status_t set_comparator_for_next_timer(void)
 }
 
 /*******************************************************************************
- * Updates timer list's deltas.
+ * Updates the timer queue with the time elapsed since the last update.
  ******************************************************************************/
-static void update_delta_list(void)
+static void update_timer_queue(void)
 {
   sl_sleeptimer_tick_count_t current_cnt = sleeptimer_hal_get_counter();
-  sl_sleeptimer_timer_handle_t *timer_handle = timer_head;
   sl_sleeptimer_tick_count_t time_diff = current_cnt - last_delta_update_count;
 
+#if (SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP)
+  // Deadlines are absolute, only the queue time moves. The queue is updated at
+  // least once per counter overflow, so no elapsed time is lost.
+  timer_queue_time += time_diff;
+#endif
+  sl_sleeptimer_timer_handle_t *timer_handle = timer_head;
+
   // Go through the delta timer list and update every necessary deltas
   // according to the time elapsed since the last update.
   while (timer_handle != NULL && time_diff > 0) {
@@ -1493,6 +1736,373 @@ static void update_delta_list(void)
   last_delta_update_count = current_cnt;
 }
 
+/*******************************************************************************
+ * Gets the first timer to expire.
+ *
+ * @return Pointer to handle to first timer. NULL if no timer is running.
+ ******************************************************************************/
+static sl_sleeptimer_timer_handle_t *get_first_timer(void)
+{
+#if (SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP)
+  if ((timer_heap_count > 0u)
+      && ((timer_head == NULL) || (get_timer_delay(&timer_heap[0]) <= timer_head->delta))) {
+    return timer_heap[0].handle;
+  }
+#endif
+
+  return timer_head;
+}
+
+/*******************************************************************************
+ * Gets the expired timer to process first.
+ *
+ * @return Pointer to handle to the expired timer with the highest priority.
+ *         The first one to expire among timers with the same priority. NULL if
+ *         no timer expired.
+ *
+ * @note The timer queue must have been updated beforehand.
+ ******************************************************************************/
+static sl_sleeptimer_timer_handle_t *get_expired_timer(void)
+{
+  sl_sleeptimer_timer_handle_t *current = NULL;
+
+  sl_sleeptimer_timer_handle_t *temp = timer_head;
+
+#if (SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP)
+  const timer_heap_entry_t *entry = NULL;
+  uint32_t last_expired_index = 0u;
+
+  // Expired timers are at the top of the heap. Only the children of expired
+  // timers are visited.
+  for (uint32_t index = 0u;
+       (index < timer_heap_count) && (index <= ((2u * last_expired_index) + 2u));
+       index++) {
+    if (timer_heap[index].deadline <= timer_queue_time) {
+      last_expired_index = index;
+      if ((entry == NULL)
+          || (entry->handle->priority > timer_heap[index].handle->priority)
+          || ((entry->handle->priority == timer_heap[index].handle->priority)
+              && timer_heap_is_before(&timer_heap[index], entry))) {
+        entry = &timer_heap[index];
+      }
+    }
+  }
+
+  if (entry != NULL) {
+    current = entry->handle;
+  }
+#endif
+
+  // Process timers with higher priority first
+  while ((temp != NULL) && (temp->delta == 0)) {
+    if ((current == NULL) || (current->priority > temp->priority)) {
+      current = temp;
+    }
+    temp = temp->next;
+  }
+
+  return current;
+}
+
+/*******************************************************************************
+ * Determines if a timer is in the timer queue.
+ *
+ * @param handle Pointer to handle to timer.
+ *
+ * @return True if the timer is running.
+ ******************************************************************************/
+static bool is_timer_in_queue(const sl_sleeptimer_timer_handle_t *handle)
+{
+  const sl_sleeptimer_timer_handle_t *current = timer_head;
+
+#if (SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP)
+  if (is_timer_in_heap(handle)) {
+    return true;
+  }
+#endif
+
+  while (current != NULL) {
+    if (current == handle) {
+      return true;
+    }
+    current = current->next;
+  }
+
+  return false;
+}
+
+/*******************************************************************************
+ * Gets the delay until a running timer expires.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param delay Delay in ticks, from the last update of the timer queue. 0 if
+ *        the timer expired.
+ *
+ * @return True if the timer is running.
+ ******************************************************************************/
+static bool get_queued_timer_delay(const sl_sleeptimer_timer_handle_t *handle,
+                                   sl_sleeptimer_tick_count_t *delay)
+{
+  const sl_sleeptimer_timer_handle_t *current = timer_head;
+
+#if (SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP)
+  if (is_timer_in_heap(handle)) {
+    *delay = get_timer_delay(&timer_heap[handle->delta]);
+    return true;
+  }
+#endif
+
+  *delay = handle->delta;
+
+  // Retrieve timer in list and add the deltas.
+  while (current != handle && current != NULL) {
+    *delay += current->delta;
+    current = current->next;
+  }
+
+  return current == handle;
+}
+
+/*******************************************************************************
+ * Gets the delay until the timer compare must trigger, so that timers expiring
+ * within each other's slack share a single interrupt.
+ *
+ * @return Delay in ticks, from the last update of the timer queue. 0 if the
+ *         first timer expired.
+ *
+ * @note (1) The compare triggers at the earliest latest expiration time among
+ *           the timers. Every timer whose timeout is reached by then expires
+ *           in the same interrupt, none of them later than its slack allows.
+ *           Only timers whose timeout comes before the current earliest latest
+ *           expiration time can lower it. With no slack, this is the delay of
+ *           the first timer.
+ *
+ * @note The timer queue must not be empty.
+ ******************************************************************************/
+static sl_sleeptimer_tick_count_t get_coalesced_delay(void)
+{
+  const sl_sleeptimer_timer_handle_t *current = timer_head;
+  uint64_t latest_delay = UINT64_MAX;
+  uint64_t delay = 0u;
+  sl_sleeptimer_tick_count_t first_delay;
+
+  // Without slack, the compare triggers for the first timer.
+  if (slack_timer_count == 0u) {
+    get_queued_timer_delay(get_first_timer(), &first_delay);
+    return first_delay;
+  }
+
+#if (SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP)
+  uint32_t last_visited_index = 0u;
+
+  if ((timer_heap_count > 0u) && (get_timer_delay(&timer_heap[0]) == 0u)) {
+    return 0u;
+  }
+
+  // See Note #1. Only the children of visited timers can expire early enough.
+  for (uint32_t index = 0u;
+       (index < timer_heap_count) && (index <= ((2u * last_visited_index) + 2u));
+       index++) {
+    uint64_t heap_delay = get_timer_delay(&timer_heap[index]);
+
+    if (heap_delay <= latest_delay) {
+      uint64_t heap_latest_delay = heap_delay + get_timer_slack(timer_heap[index].handle);
+
+      if (heap_latest_delay < latest_delay) {
+        latest_delay = heap_latest_delay;
+      }
+      last_visited_index = index;
+    }
+  }
+#endif
+
+  if ((current != NULL) && (current->delta == 0u)) {
+    return 0u;
+  }
+
+  // See Note #1.
+  while ((current != NULL) && ((delay + current->delta) <= latest_delay)) {
+    delay += current->delta;
+    if ((delay + get_timer_slack(current)) < latest_delay) {
+      latest_delay = delay + get_timer_slack(current);
+    }
+    current = current->next;
+  }
+
+  if (latest_delay > UINT32_MAX) {
+    latest_delay = UINT32_MAX;
+  }
+
+  return (sl_sleeptimer_tick_count_t)latest_delay;
+}
+
+/*******************************************************************************
+ * Sets the slack of a running timer.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param slack Maximum delay after each timeout at which the timer may
+ *        expire, in timer ticks. 0 removes the timer from the slack table.
+ *
+ * @return 0 if successful. Error code otherwise.
+ ******************************************************************************/
+static sl_status_t set_timer_slack(const sl_sleeptimer_timer_handle_t *handle,
+                                   sl_sleeptimer_tick_count_t slack)
+{
+  uint32_t index = 0u;
+
+  while ((index < slack_timer_count) && (slack_timers[index].handle != handle)) {
+    index++;
+  }
+
+  if (slack == 0u) {
+    // Move the last entry of the table in the hole.
+    if (index < slack_timer_count) {
+      slack_timer_count--;
+      slack_timers[index] = slack_timers[slack_timer_count];
+    }
+
+    return SL_STATUS_OK;
+  }
+
+  if (index == slack_timer_count) {
+    if (slack_timer_count >= SL_SLEEPTIMER_SLACK_TIMER_COUNT) {
+      return SL_STATUS_NO_MORE_RESOURCE;
+    }
+    slack_timers[index].handle = handle;
+    slack_timer_count++;
+  }
+  slack_timers[index].slack = slack;
+
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ * Gets the slack of a running timer.
+ *
+ * @param handle Pointer to handle to timer.
+ *
+ * @return Slack in ticks. 0 if the timer was started without slack.
+ ******************************************************************************/
+static sl_sleeptimer_tick_count_t get_timer_slack(const sl_sleeptimer_timer_handle_t *handle)
+{
+  for (uint32_t index = 0u; index < slack_timer_count; index++) {
+    if (slack_timers[index].handle == handle) {
+      return slack_timers[index].slack;
+    }
+  }
+
+  return 0u;
+}
+
+#if (SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP)
+/*******************************************************************************
+ * Determines if a timer is in the timer heap.
+ *
+ * @param handle Pointer to handle to timer.
+ *
+ * @return True if the timer is in the heap.
+ *
+ * @note The delta field of a timer that is not in the heap can be anything,
+ *       the heap entry tells if it is a valid heap position.
+ ******************************************************************************/
+static bool is_timer_in_heap(const sl_sleeptimer_timer_handle_t *handle)
+{
+  return (handle->delta < timer_heap_count)
+         && (timer_heap[handle->delta].handle == handle);
+}
+
+/*******************************************************************************
+ * Gets the delay until a timer of the heap expires, from the last update of
+ * the timer queue.
+ *
+ * @param entry Pointer to heap entry of timer.
+ *
+ * @return Delay in ticks. 0 if the timer expired.
+ ******************************************************************************/
+static sl_sleeptimer_tick_count_t get_timer_delay(const timer_heap_entry_t *entry)
+{
+  if (entry->deadline <= timer_queue_time) {
+    return 0u;
+  }
+
+  return (sl_sleeptimer_tick_count_t)(entry->deadline - timer_queue_time);
+}
+
+/*******************************************************************************
+ * Determines if a timer of the heap expires before another one.
+ *
+ * @param entry_a Pointer to heap entry of first timer.
+ * @param entry_b Pointer to heap entry of second timer.
+ *
+ * @return True if the first timer expires before the second one, or at the
+ *         same time but was inserted first.
+ ******************************************************************************/
+static bool timer_heap_is_before(const timer_heap_entry_t *entry_a,
+                                 const timer_heap_entry_t *entry_b)
+{
+  if (entry_a->deadline != entry_b->deadline) {
+    return entry_a->deadline < entry_b->deadline;
+  }
+
+  return (int32_t)(entry_a->sequence - entry_b->sequence) < 0;
+}
+
+/*******************************************************************************
+ * Moves a timer up the heap until its parent expires before it.
+ *
+ * @param index Position of the timer in the heap.
+ ******************************************************************************/
+static void timer_heap_sift_up(uint32_t index)
+{
+  timer_heap_entry_t entry = timer_heap[index];
+
+  while (index > 0u) {
+    uint32_t parent = (index - 1u) / 2u;
+
+    if (!timer_heap_is_before(&entry, &timer_heap[parent])) {
+      break;
+    }
+    timer_heap[index] = timer_heap[parent];
+    timer_heap[index].handle->delta = index;
+    index = parent;
+  }
+
+  timer_heap[index] = entry;
+  entry.handle->delta = index;
+}
+
+/*******************************************************************************
+ * Moves a timer down the heap until it expires before its children.
+ *
+ * @param index Position of the timer in the heap.
+ ******************************************************************************/
+static void timer_heap_sift_down(uint32_t index)
+{
+  timer_heap_entry_t entry = timer_heap[index];
+
+  while (true) {
+    uint32_t child = (2u * index) + 1u;
+
+    if (child >= timer_heap_count) {
+      break;
+    }
+    if (((child + 1u) < timer_heap_count)
+        && timer_heap_is_before(&timer_heap[child + 1u], &timer_heap[child])) {
+      child++;
+    }
+    if (!timer_heap_is_before(&timer_heap[child], &entry)) {
+      break;
+    }
+    timer_heap[index] = timer_heap[child];
+    timer_heap[index].handle->delta = index;
+    index = child;
+  }
+
+  timer_heap[index] = entry;
+  entry.handle->delta = index;
+}
+#endif
+
 /*******************************************************************************
  * Creates and start a 32 bits timer.
  *
@@ -1501,6 +2111,8 @@ static void update_delta_list(void)
  * @param timeout_periodic Periodic timeout, in timer ticks. This timeout
  *        applies once timeoutInitial expires. Can be set to 0 for a one
  *        shot timer.
+ * @param slack Maximum delay after each timeout at which the timer may
+ *        expire, in timer ticks.
  * @param callback Callback function that will be called when
  *        initial/periodic timeout expires.
  * @param callback_data Pointer to user data that will be passed to callback.
@@ -1512,12 +2124,14 @@ static void update_delta_list(void)
 static sl_status_t create_timer(sl_sleeptimer_timer_handle_t *handle,
                                 sl_sleeptimer_tick_count_t timeout_initial,
                                 sl_sleeptimer_tick_count_t timeout_periodic,
+                                sl_sleeptimer_tick_count_t slack,
                                 sl_sleeptimer_timer_callback_t callback,
                                 void *callback_data,
                                 uint8_t priority,
                                 uint16_t option_flags)
 {
   CORE_DECLARE_IRQ_STATE;
+  sl_status_t status;
 
   handle->priority = priority;
   handle->callback_data = callback_data;
@@ -1554,11 +2168,25 @@ static sl_status_t create_timer(sl_sleeptimer_timer_handle_t *handle,
 #endif
 
   CORE_ENTER_CRITICAL();
-  update_delta_list();
-  delta_list_insert_timer(handle, timeout_initial);
+  status = set_timer_slack(handle, slack);
+  if (status != SL_STATUS_OK) {
+    CORE_EXIT_CRITICAL();
 
-  // If first timer, update timer comparator.
-  if (timer_head == handle) {
+    return status;
+  }
+
+  update_timer_queue();
+  status = timer_queue_insert(handle, timeout_initial);
+  if (status != SL_STATUS_OK) {
+    CORE_EXIT_CRITICAL();
+
+    return status;
+  }
+
+  // If first timer, or if the timer must expire before the timer compare
+  // set for other timers with slack, update timer comparator.
+  if ((get_first_timer() == handle)
+      || (((uint64_t)timeout_initial + slack) < (sl_sleeptimer_tick_count_t)(next_compare_count - last_delta_update_count))) {
     set_comparator_for_next_timer();
   }
 
@@ -1592,16 +2220,8 @@ static void process_expired_timer(sl_sleeptimer_timer_handle_t *timer)
     }
   }
 
-  // Remove timer from list except if the timer is a periodic timer that was
-  // intentionally kept at the head of the timers list.
-  if (skip_remove != true) {
-    CORE_ENTER_ATOMIC();
-    delta_list_remove_timer(timer);
-    CORE_EXIT_ATOMIC();
-  }
-
-  // Re-insert periodic timer that was previsouly removed from the list
-  // and compensate for any deviation from the periodic timer frequency.
+  // Compensate a periodic timer that will be re-inserted for any deviation
+  // from the periodic timer frequency.
   if (timer->timeout_periodic != 0u && skip_remove != true) {
     timeout_temp -= periodic_correction;
     EFM_ASSERT(timeout_temp > 0);
@@ -1617,9 +2237,21 @@ static void process_expired_timer(sl_sleeptimer_timer_handle_t *timer)
         timer->timeout_expected_tc -= 1;
       }
     }
+  }
+
+  // Remove timer from list except if the timer is a periodic timer that was
+  // intentionally kept at the head of the timers list. A periodic timer is
+  // re-inserted in the same critical section, so that the room it leaves in
+  // the timer heap cannot be taken by another timer.
+  if (skip_remove != true) {
     CORE_ENTER_ATOMIC();
-    delta_list_insert_timer(timer, (sl_sleeptimer_tick_count_t)timeout_temp);
-    timer->timeout_expected_tc += timer->timeout_periodic;
+    timer_queue_remove(timer);
+    if (timer->timeout_periodic != 0u) {
+      timer_queue_insert(timer, (sl_sleeptimer_tick_count_t)timeout_temp);
+      timer->timeout_expected_tc += timer->timeout_periodic;
+    } else {
+      set_timer_slack(timer, 0u);
+    }
     CORE_EXIT_ATOMIC();
   }
 
@@ -1640,6 +2272,36 @@ static void update_next_timer_to_expire_is_power_manager(void)
 
   next_timer_to_expire_is_power_manager = false;
 
+#if (SL_SLEEPTIMER_TIMER_QUEUE == SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP)
+  if (timer_heap_count > 0u) {
+    uint64_t first_delay = get_timer_delay(&timer_heap[0]);
+    uint32_t last_visited_index = 0u;
+
+    if ((current != NULL) && (current->delta < first_delay)) {
+      first_delay = current->delta;
+    }
+
+    // Look for the power manager timer among timers that expire at most one
+    // tick after the first one. Only the children of such timers are visited.
+    for (uint32_t index = 0u;
+         (index < timer_heap_count) && (index <= ((2u * last_visited_index) + 2u));
+         index++) {
+      if (get_timer_delay(&timer_heap[index]) <= (first_delay + 1u)) {
+        if (timer_heap[index].handle->option_flags & SLI_SLEEPTIMER_POWER_MANAGER_EARLY_WAKEUP_TIMER_FLAG) {
+          next_timer_to_expire_is_power_manager = true;
+          return;
+        }
+        last_visited_index = index;
+      }
+    }
+
+    // The delta list is searched from the delay of the first timer.
+    if (current != NULL) {
+      delta_diff_with_first = (uint32_t)(current->delta - first_delay);
+    }
+  }
+#endif
+
   while ((delta_diff_with_first <= 1) && (current != NULL)) {
     if (current->option_flags & SLI_SLEEPTIMER_POWER_MANAGER_EARLY_WAKEUP_TIMER_FLAG) {
       next_timer_to_expire_is_power_manager = true;
@@ -1702,18 +2364,6 @@ __STATIC_INLINE bool is_power_of_2(uint32_t nbr)
 }
 
 #if SL_SLEEPTIMER_WALLCLOCK_CONFIG
-/*******************************************************************************
- * Compute the day of the week.
- *
- * @param day Days since January 1st of 1970.
- *
- * @return the day of the week.
- ******************************************************************************/
-static sl_sleeptimer_weekDay_t compute_day_of_week(uint32_t day)
-{
-  return (sl_sleeptimer_weekDay_t)((day + 4) % 7); // January 1st was a Thursday(4) in 1970
-}
-
 /*******************************************************************************
  * Compute the day of the week.
  *
@@ -1738,66 +2388,84 @@ static sl_sleeptimer_weekDay_t compute_day_of_week_64(uint64_t day)
  ******************************************************************************/
 static uint16_t compute_day_of_year(sl_sleeptimer_month_t month, uint8_t day, bool is_leap_year)
 {
-  uint8_t i;
-  uint16_t dayOfYear = 0;
+  uint16_t dayOfYear = days_before_month[month] + day;
 
-  for (i = 0; i < month; ++i) {
-    dayOfYear += days_in_month[is_leap_year][i];
+  if (is_leap_year && (month > MONTH_FEBRUARY)) {
+    dayOfYear++;
   }
-  dayOfYear += day;
 
   return dayOfYear;
 }
 
 /*******************************************************************************
- * Checks if the year is a leap year.
+ * Computes the number of days since January 1st of 1900 of a date. This
+ * function assumes that the inputs are properly sanitized.
  *
- * @param year Year to check.
+ * @param year Year, based on a 1900 epoch.
+ * @param month Number of months since January.
+ * @param month_day Day of the month.
  *
- * @return true if the year is a leap year. False otherwise.
+ * @return Number of days since January 1st of 1900.
+ *
+ * @note (1) Years are counted from March, so that the leap day is the last day
+ *           of the year and the month lengths follow a fixed 153-day pattern
+ *           over five months. The calendar repeats every era of 400 years.
  ******************************************************************************/
-static bool is_leap_year(uint16_t year)
+static uint32_t days_from_civil(uint16_t year, sl_sleeptimer_month_t month, uint8_t month_day)
 {
-  // 1900 is not a leap year but 0 % anything is 0.
-  if (year == 0) {
-    return false;
-  }
+  // See Note #1.
+  uint32_t march_year = (uint32_t)year + TIME_NTP_EPOCH - ((month < MONTH_MARCH) ? 1u : 0u);
+  uint32_t march_month = (month < MONTH_MARCH) ? (month + 10u) : (month - 2u);
+  uint32_t era = march_year / 400u;
+  uint32_t year_of_era = march_year - (era * 400u);
+  uint32_t day_of_year = (((153u * march_month) + 2u) / 5u) + month_day - 1u;
+  uint32_t day_of_era = (year_of_era * TIME_DAY_PER_YEAR) + (year_of_era / 4u) - (year_of_era / 100u) + day_of_year;
 
-  bool leap_year;
-
-  leap_year = (((year %   4u) == 0u)
-               && (((year % 100u) != 0u) || ((year % 400u) == 0u))) ? true : false;
+  return (era * TIME_DAY_PER_ERA) + day_of_era - TIME_DAY_COUNT_MARCH_0000_TO_NTP_EPOCH;
+}
 
-  return (leap_year);
+/*******************************************************************************
+ * Computes the year, month, day of the month and day of the year of a number
+ * of days since January 1st of 1900.
+ *
+ * @param days Number of days since January 1st of 1900.
+ * @param date Date structure whose year, month, month_day and day_of_year
+ *             fields are set.
+ *
+ * @note Inverse of days_from_civil(). See days_from_civil() Note #1.
+ ******************************************************************************/
+static void civil_from_days(uint32_t days, sl_sleeptimer_date_t *date)
+{
+  uint32_t day_count = days + TIME_DAY_COUNT_MARCH_0000_TO_NTP_EPOCH;
+  uint32_t era = day_count / TIME_DAY_PER_ERA;
+  uint32_t day_of_era = day_count - (era * TIME_DAY_PER_ERA);
+  uint32_t year_of_era = (day_of_era - (day_of_era / 1460u) + (day_of_era / 36524u) - (day_of_era / 146096u)) / TIME_DAY_PER_YEAR;
+  uint32_t day_of_year = day_of_era - ((year_of_era * TIME_DAY_PER_YEAR) + (year_of_era / 4u) - (year_of_era / 100u));
+  uint32_t march_month = ((5u * day_of_year) + 2u) / 153u;
+  uint32_t year = (era * 400u) + year_of_era + ((march_month >= 10u) ? 1u : 0u);
+
+  date->year = (uint16_t)(year - TIME_NTP_EPOCH);
+  date->month = (sl_sleeptimer_month_t)((march_month < 10u) ? (march_month + 2u) : (march_month - 10u));
+  date->month_day = (uint8_t)(day_of_year - (((153u * march_month) + 2u) / 5u) + 1u);
+  date->day_of_year = compute_day_of_year(date->month, date->month_day, is_leap_year(date->year));
 }
 
 /*******************************************************************************
- * Checks if the time stamp, format and time zone are
- *  within the supported range.
+ * Checks if the year is a leap year.
  *
- * @param base_year Year to start from to compute leap days.
- * @param current_year Year end at for computing leap days.
+ * @param year Year to check, based on a 1900 epoch.
  *
- * @return leap_days Days number of leap days between base_year and current_year.
+ * @return true if the year is a leap year. False otherwise.
  ******************************************************************************/
-static uint16_t number_of_leap_days(uint32_t base_year, uint32_t current_year)
+static bool is_leap_year(uint16_t year)
 {
-  // Regular leap years
-  uint16_t lo_reg = (base_year - 0) / 4;
-  uint16_t hi_reg = (current_year - 1) / 4;
-  uint16_t leap_days = hi_reg - lo_reg;
-
-  // Account for non leap years
-  uint16_t lo_century = (base_year - 0) / 100;
-  uint16_t hi_century = (current_year - 1) / 100;
-  leap_days -= hi_century - lo_century;
+  uint32_t full_year = (uint32_t)year + TIME_NTP_EPOCH;
+  bool leap_year;
 
-  // Account for quad century leap years
-  uint16_t lo_quad = (base_year - 0) / 400;
-  uint16_t hi_quad = (current_year - 1) / 400;
-  leap_days += hi_quad - lo_quad;
+  leap_year = (((full_year %   4u) == 0u)
+               && (((full_year % 100u) != 0u) || ((full_year % 400u) == 0u))) ? true : false;
 
-  return (leap_days);
+  return (leap_year);
 }
 
 /*******************************************************************************
@@ -111,6 +111,8 @@ int8_t bma400_i2c_init(mikroe_i2c_handle_t i2cspm,
   bma400->intf_ptr = &bma400_handle.intf_ref;
   bma400->delay_us = bma400_delay_us;
   bma400->read_write_len = READ_WRITE_LENGTH;
+  // The I2C write sends the whole buffer in one transaction
+  bma400->burst_write_en = BMA400_ENABLE;
 
 #ifdef  MIKROE_BMA400_INT1_PORT
   pin_name_t int_pin_1 = hal_gpio_pin_name(MIKROE_BMA400_INT1_PORT,
@@ -615,6 +615,34 @@ static int8_t negative_excited_accel(struct bma400_sensor_data *accel_neg, struc
  */
 static int8_t enable_self_test(struct bma400_dev *dev);
 
+/*
+ * @brief This API checks whether the registers from reg_addr to
+ * reg_addr + len - 1 can be written in a single burst transaction
+ *
+ * @param[in] reg_addr : Address of the first register to write
+ * @param[in] len      : No of registers to write
+ *
+ * @return Burst write allowance
+ * @retval 1 -> Burst write allowed
+ * @retval 0 -> Registers must be written one by one
+ */
+static uint8_t is_burst_write_allowed(uint8_t reg_addr, uint32_t len);
+
+/*
+ * @brief This API writes consecutive registers in a single transaction,
+ * with each data byte preceded by its register address
+ *
+ * @param[in] reg_addr : Address of the first register to write
+ * @param[in] reg_data : Pointer to data buffer which is to be written
+ * @param[in] len      : No of bytes of data to write, greater than 1
+ * @param[in] dev      : Structure instance of bma400_dev
+ *
+ * @return Result of API execution status
+ * @retval zero -> Success
+ * @retval -ve value -> Error
+ */
+static int8_t write_regs_burst(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, struct bma400_dev *dev);
+
 /************************************************************************************/
 /*********************** User function definitions **********************************/
 /************************************************************************************/
@@ -698,20 +726,29 @@ int8_t bma400_set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len,
             }
         }
 
-        /* Burst write is not allowed thus we split burst case write
-         * into single byte writes Thus user can write multiple bytes
-         * with ease
+        /* The sensor does not auto-increment the register address on
+         * writes. Interfaces that support it write the registers in one
+         * transaction of address/data pairs, otherwise the burst case
+         * write is split into single byte writes. Thus user can write
+         * multiple bytes with ease
          */
-        if (len > 1)
+        if ((len > 1) && (rslt == BMA400_OK))
         {
-            for (count = 0; (count < len) && (rslt == BMA400_OK); count++)
+            if ((dev->burst_write_en == BMA400_ENABLE) && is_burst_write_allowed(reg_addr, len))
+            {
+                rslt = write_regs_burst(reg_addr, reg_data, len, dev);
+            }
+            else
             {
-                dev->intf_rslt = dev->write(reg_addr, &reg_data[count], 1, dev->intf_ptr);
-                reg_addr++;
-                if (dev->intf_rslt != BMA400_INTF_RET_SUCCESS)
+                for (count = 0; (count < len) && (rslt == BMA400_OK); count++)
                 {
-                    /* Failure case */
-                    rslt = BMA400_E_COM_FAIL;
+                    dev->intf_rslt = dev->write(reg_addr, &reg_data[count], 1, dev->intf_ptr);
+                    reg_addr++;
+                    if (dev->intf_rslt != BMA400_INTF_RET_SUCCESS)
+                    {
+                        /* Failure case */
+                        rslt = BMA400_E_COM_FAIL;
+                    }
                 }
             }
         }
@@ -3550,3 +3587,44 @@ static int8_t enable_self_test(struct bma400_dev *dev)
 
     return rslt;
 }
+
+static uint8_t is_burst_write_allowed(uint8_t reg_addr, uint32_t len)
+{
+    uint8_t allowed = BMA400_DISABLE;
+
+    /* Commands need a transaction of their own, and a burst must not run
+     * past the last register
+     */
+    if (((uint32_t)reg_addr + len) <= BMA400_REG_COMMAND)
+    {
+        allowed = BMA400_ENABLE;
+    }
+
+    return allowed;
+}
+
+static int8_t write_regs_burst(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, struct bma400_dev *dev)
+{
+    int8_t rslt = BMA400_OK;
+    uint32_t count;
+    uint8_t temp_buff[(2 * len) - 1];
+
+    /* The first register address is sent by the interface, the following
+     * ones are interleaved with the data
+     */
+    temp_buff[0] = reg_data[0];
+    for (count = 1; count < len; count++)
+    {
+        temp_buff[(2 * count) - 1] = (uint8_t)(reg_addr + count);
+        temp_buff[2 * count] = reg_data[count];
+    }
+
+    dev->intf_rslt = dev->write(reg_addr, temp_buff, (2 * len) - 1, dev->intf_ptr);
+    if (dev->intf_rslt != BMA400_INTF_RET_SUCCESS)
+    {
+        /* Failure case */
+        rslt = BMA400_E_COM_FAIL;
+    }
+
+    return rslt;
+}
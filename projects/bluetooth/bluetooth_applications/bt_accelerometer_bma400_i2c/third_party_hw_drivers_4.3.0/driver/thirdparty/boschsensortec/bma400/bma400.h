@@ -475,6 +475,8 @@ int8_t bma400_enable_interrupt(const struct bma400_int_enable *int_select, uint8
  * int8_t bma400_set_regs(uint8_t reg_addr, uint8_t *reg_data, uint8_t len, const struct bma400_dev *dev);
  * \endcode
  * @details This API writes the given data to the register address of the sensor.
+ * If dev->burst_write_en is enabled, consecutive registers below the command
+ * register are written in one transaction, otherwise one register at a time.
  *
  * @param[in] reg_addr : Register address from where the data to be written.
  * @param[in] reg_data : Pointer to data buffer which is to be written
@@ -1415,6 +1415,11 @@ struct bma400_dev
     /* User set read/write length */
     uint16_t read_write_len;
 
+    /* Interface can write several registers in one transaction of
+     * address/data pairs (BMA400_ENABLE/BMA400_DISABLE)
+     */
+    uint8_t burst_write_en;
+
     /*! To store interface pointer error */
     BMA400_INTF_RET_TYPE intf_rslt;
 };
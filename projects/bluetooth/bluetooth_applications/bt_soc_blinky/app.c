@@ -33,15 +33,25 @@
 #include "gatt_db.h"
 #include "app.h"
 #include "sl_main_init.h"
+#include "sl_main_profiler.h"
 #include "sl_simple_button_instances.h"
 #include "sl_simple_led_instances.h"
 
+// ATT error of a read beyond the end of a value.
+#define ATT_ERROR_INVALID_OFFSET  0x07
+
 // The advertising set handle allocated from Bluetooth stack.
 static uint8_t advertising_set_handle = 0xff;
+// Profiler summary served on the Main Loop Profile characteristic, taken when
+// a read starts so that the rest of a long read returns the same summary.
+static uint8_t main_loop_profile[SL_MAIN_PROFILER_PROBE_COUNT * SL_MAIN_PROFILER_SUMMARY_SIZE];
+static size_t main_loop_profile_len = 0;
 // Updates the Report Button characteristic.
 static sl_status_t update_report_button_characteristic(void);
 // Sends notification of the Report Button characteristic.
 static sl_status_t send_report_button_notification(void);
+// Responds to a read of the Main Loop Profile characteristic.
+static sl_status_t send_main_loop_profile(uint8_t connection, uint16_t offset);
 
 /******************************************************************************
  * Application Init.
@@ -204,6 +214,17 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       }
       break;
 
+    // -------------------------------
+    // This event indicates that a remote GATT client reads a characteristic
+    // of the user type.
+    case sl_bt_evt_gatt_server_user_read_request_id:
+      if (gattdb_main_loop_profile == evt->data.evt_gatt_server_user_read_request.characteristic) {
+        sc = send_main_loop_profile(evt->data.evt_gatt_server_user_read_request.connection,
+                                    evt->data.evt_gatt_server_user_read_request.offset);
+        app_log_status_error(sc);
+      }
+      break;
+
     ///////////////////////////////////////////////////////////////////////////
     // Add additional event handlers here as your application requires!      //
     ///////////////////////////////////////////////////////////////////////////
@@ -294,3 +315,33 @@ static sl_status_t send_report_button_notification(void)
   }
   return sc;
 }
+
+/***************************************************************************//**
+ * Responds to a read of the Main Loop Profile characteristic.
+ *
+ * Sends the summary of sl_main_profiler_serialize(). The summary is taken on
+ * the read at offset 0, the read blob requests of a long read continue from it.
+ ******************************************************************************/
+static sl_status_t send_main_loop_profile(uint8_t connection, uint16_t offset)
+{
+  uint16_t sent_len;
+
+  if (offset == 0) {
+    main_loop_profile_len = sl_main_profiler_serialize(main_loop_profile,
+                                                       sizeof(main_loop_profile));
+  }
+  if (offset > main_loop_profile_len) {
+    return sl_bt_gatt_server_send_user_read_response(connection,
+                                                     gattdb_main_loop_profile,
+                                                     ATT_ERROR_INVALID_OFFSET,
+                                                     0,
+                                                     NULL,
+                                                     &sent_len);
+  }
+  return sl_bt_gatt_server_send_user_read_response(connection,
+                                                   gattdb_main_loop_profile,
+                                                   0,
+                                                   main_loop_profile_len - offset,
+                                                   &main_loop_profile[offset],
+                                                   &sent_len);
+}
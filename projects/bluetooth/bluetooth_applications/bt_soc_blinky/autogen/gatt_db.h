@@ -22,8 +22,9 @@ extern const sli_bt_gattdb_t gattdb;
 #define gattdb_system_id                      24
 #define gattdb_led_control                    27
 #define gattdb_report_button                  29
-#define gattdb_ota                            31
-#define gattdb_ota_control                    33
+#define gattdb_main_loop_profile              32
+#define gattdb_ota                            33
+#define gattdb_ota_control                    35
 
 #define gattdb_generic_attribute_len          2
 #define gattdb_service_changed_char_len       4
@@ -26,6 +26,7 @@
 #include "sl_iostream_init_instances.h"
 #include "sl_cos.h"
 #include "sl_iostream_handles.h"
+#include "sl_memory_manager.h"
 
 void sli_driver_permanent_allocation(void)
 {
@@ -68,6 +69,7 @@ void sl_driver_init(void)
 
 void sl_service_init(void)
 {
+  sl_memory_ram_retention_init();
   sl_board_configure_vcom();
   sl_iostream_stdlib_disable_buffering();
   sl_mbedtls_init();
@@ -2,6 +2,7 @@
 #include "sl_core.h"
 #include "sl_power_manager.h"
 #include "sl_sleeptimer.h"
+#include "sli_memory_manager.h"
 #include "app_timer_internal.h"
 #include "sl_bluetooth.h"
 #include "sl_iostream_init_eusart_instances.h"
@@ -58,6 +59,9 @@ __WEAK sl_power_manager_on_isr_exit_t app_sleep_on_isr_exit(void)
 bool sl_power_manager_is_ok_to_sleep(void)
 {
   bool ok_to_sleep = true;
+  if (sli_memory_manager_is_ok_to_sleep() == false) {
+    ok_to_sleep = false;
+  }
   if (sli_app_timer_is_ok_to_sleep() == false) {
     ok_to_sleep = false;
   }
@@ -3,6 +3,7 @@ set(COPIED_SDK_PATH "simplicity_sdk_2025.6.0")
 set(PKG_PATH "C:/Users/codo/.silabs/slt/installs")
 
 add_library(slc_bt_soc_blinky OBJECT
+    "../${COPIED_SDK_PATH}/app/bluetooth/common/event_trace/sl_bt_event_trace.c"
     "../${COPIED_SDK_PATH}/app/bluetooth/common/in_place_ota_dfu/sl_bt_in_place_ota_dfu.c"
     "../${COPIED_SDK_PATH}/app/common/util/app_log/app_log.c"
     "../${COPIED_SDK_PATH}/app/common/util/app_timer/bm/app_timer.c"
@@ -77,6 +78,7 @@ add_library(slc_bt_soc_blinky OBJECT
     "../${COPIED_SDK_PATH}/platform/security/sl_component/sl_psa_driver/src/sli_cryptoacc_transparent_driver_signature.c"
     "../${COPIED_SDK_PATH}/platform/security/sl_component/sl_psa_driver/src/sli_psa_driver_common.c"
     "../${COPIED_SDK_PATH}/platform/security/sl_component/sl_psa_driver/src/sli_psa_driver_init.c"
+    "../${COPIED_SDK_PATH}/platform/security/sl_component/sl_psa_driver/src/sli_psa_sha256_mb.c"
     "../${COPIED_SDK_PATH}/platform/security/sl_component/sl_psa_driver/src/sli_psa_trng.c"
     "../${COPIED_SDK_PATH}/platform/security/sl_component/sl_psa_driver/src/sli_se_version_dependencies.c"
     "../${COPIED_SDK_PATH}/platform/security/sl_component/sli_crypto/src/sl_crypto_s2.c"
@@ -98,9 +100,12 @@ add_library(slc_bt_soc_blinky OBJECT
     "../${COPIED_SDK_PATH}/platform/service/iostream/src/sl_iostream_uart.c"
     "../${COPIED_SDK_PATH}/platform/service/memory_manager/profiler/src/sli_memory_profiler_stubs.c"
     "../${COPIED_SDK_PATH}/platform/service/memory_manager/src/sl_memory_manager.c"
+    "../${COPIED_SDK_PATH}/platform/service/memory_manager/src/sl_memory_manager_arena.c"
     "../${COPIED_SDK_PATH}/platform/service/memory_manager/src/sl_memory_manager_dynamic_reservation.c"
+    "../${COPIED_SDK_PATH}/platform/service/memory_manager/src/sl_memory_manager_integrity.c"
     "../${COPIED_SDK_PATH}/platform/service/memory_manager/src/sl_memory_manager_pool.c"
     "../${COPIED_SDK_PATH}/platform/service/memory_manager/src/sl_memory_manager_pool_common.c"
+    "../${COPIED_SDK_PATH}/platform/service/memory_manager/src/sl_memory_manager_ram_retention.c"
     "../${COPIED_SDK_PATH}/platform/service/memory_manager/src/sl_memory_manager_region.c"
     "../${COPIED_SDK_PATH}/platform/service/memory_manager/src/sl_memory_manager_retarget.c"
     "../${COPIED_SDK_PATH}/platform/service/memory_manager/src/sli_memory_manager_common.c"
@@ -113,8 +118,10 @@ add_library(slc_bt_soc_blinky OBJECT
     "../${COPIED_SDK_PATH}/platform/service/sl_main/src/sl_main_init.c"
     "../${COPIED_SDK_PATH}/platform/service/sl_main/src/sl_main_init_memory.c"
     "../${COPIED_SDK_PATH}/platform/service/sl_main/src/sl_main_process_action.c"
+    "../${COPIED_SDK_PATH}/platform/service/sl_main/src/sl_main_profiler.c"
     "../${COPIED_SDK_PATH}/platform/service/sleeptimer/src/sl_sleeptimer.c"
     "../${COPIED_SDK_PATH}/platform/service/sleeptimer/src/sl_sleeptimer_hal_burtc.c"
+    "../${COPIED_SDK_PATH}/platform/service/sleeptimer/src/sl_sleeptimer_hal_host.c"
     "../${COPIED_SDK_PATH}/platform/service/sleeptimer/src/sl_sleeptimer_hal_prortc.c"
     "../${COPIED_SDK_PATH}/platform/service/sleeptimer/src/sl_sleeptimer_hal_rtcc.c"
     "../${COPIED_SDK_PATH}/platform/service/sleeptimer/src/sl_sleeptimer_hal_timer.c"
@@ -219,6 +226,7 @@ target_include_directories(slc_bt_soc_blinky PUBLIC
     "../${COPIED_SDK_PATH}/platform/emdrv/common/inc"
     "../${COPIED_SDK_PATH}/platform/emlib/inc"
     "../${COPIED_SDK_PATH}/platform/radio/rail_lib/plugin/fem_util"
+    "../${COPIED_SDK_PATH}/app/bluetooth/common/event_trace"
     "../${COPIED_SDK_PATH}/app/bluetooth/common/gatt_service_device_information_override"
     "../${COPIED_SDK_PATH}/platform/driver/gpio/inc"
     "../${COPIED_SDK_PATH}/platform/peripheral/inc"
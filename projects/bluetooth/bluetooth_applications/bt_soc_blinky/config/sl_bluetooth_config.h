@@ -90,6 +90,27 @@
 
 // </h> End Bluetooth Stack Configuration
 
+// <h> Event Processing
+
+// <o SL_BT_CONFIG_MAX_EVENTS_PER_STEP> Max number of events processed per sl_bt_step() call <1-255>
+// <i> Default: 1
+// <i> Define how many pending Bluetooth events sl_bt_step() processes before
+// <i> returning to the main loop. Draining several events per call lowers the
+// <i> event latency under burst load, e.g. GATT writes or notifications, at the
+// <i> cost of a longer sl_bt_step() call.
+#define SL_BT_CONFIG_MAX_EVENTS_PER_STEP     (1)
+
+// <o SL_BT_CONFIG_STEP_TIME_BUDGET_US> Time budget of a sl_bt_step() call in microseconds <0-1000000>
+// <i> Default: 0
+// <i> Once this time has elapsed, sl_bt_step() stops processing events even if
+// <i> SL_BT_CONFIG_MAX_EVENTS_PER_STEP was not reached, so that the other
+// <i> components are not starved. At least one event is processed per call.
+// <i> The budget is measured with the sleeptimer and rounded up to its tick.
+// <i> 0 disables the time budget.
+#define SL_BT_CONFIG_STEP_TIME_BUDGET_US     (0)
+
+// </h> End Event Processing
+
 // <h> TX Power Levels
 
 // <o SL_BT_CONFIG_MIN_TX_POWER> Minimum radiated TX power level in 0.1dBm unit
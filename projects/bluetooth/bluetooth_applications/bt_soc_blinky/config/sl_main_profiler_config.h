@@ -0,0 +1,55 @@
+/***************************************************************************//**
+ * @file
+ * @brief sl_main profiler Configuration
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_MAIN_PROFILER_CONFIG_H
+#define SL_MAIN_PROFILER_CONFIG_H
+
+// <<< Use Configuration Wizard in Context Menu >>>
+
+// <h> Main Loop Profiler Configuration
+
+// <q SL_MAIN_PROFILER_ENABLE> Enables measurement of the main loop stages and Bluetooth event handlers for debugging purposes.
+// <i> Default: 0
+#define SL_MAIN_PROFILER_ENABLE    0
+
+// <o SL_MAIN_PROFILER_BUCKET_COUNT> Number of histogram buckets per probe <2-24>
+// <i> Default: 16
+// <i> Bucket 0 counts the sections shorter than 2^SL_MAIN_PROFILER_FIRST_BUCKET_LOG2
+// <i> cycles. Each following bucket covers twice the cycles of the previous one,
+// <i> and the last bucket counts all longer sections.
+#define SL_MAIN_PROFILER_BUCKET_COUNT    16
+
+// <o SL_MAIN_PROFILER_FIRST_BUCKET_LOG2> Log2 of the upper bound of the first histogram bucket, in cycles <0-16>
+// <i> Default: 6
+#define SL_MAIN_PROFILER_FIRST_BUCKET_LOG2    6
+// </h>
+
+// <<< end of configuration section >>>
+#endif // SL_MAIN_PROFILER_CONFIG_H
@@ -28,6 +28,7 @@
  *
  ******************************************************************************/
 #include "sl_component_catalog.h"
+#include "sl_main_profiler.h"
 #include "sl_main_init.h"
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
 #include "sl_power_manager.h"
@@ -60,7 +61,7 @@ int main(void)
     sl_main_process_action();
 
     // User provided code. Application process.
-    app_process_action();
+    SL_MAIN_PROFILER_SECTION(SL_MAIN_PROFILER_PROBE_APP, app_process_action(); )
 
 #if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
     // Let the CPU go to sleep if the system allows it.
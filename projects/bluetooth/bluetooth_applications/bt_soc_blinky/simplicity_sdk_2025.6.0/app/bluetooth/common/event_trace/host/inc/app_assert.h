@@ -0,0 +1,51 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the application assert, for the event trace runner
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef APP_ASSERT_H
+#define APP_ASSERT_H
+
+#include "sl_status.h"
+
+// Reports a failed assertion and exits, see sl_bt_event_trace_host_stubs.c.
+void sl_bt_event_trace_host_assert_fail(const char *file, int line, const char *format, ...);
+
+#define app_assert(expr, ...)                                               \
+  do {                                                                      \
+    if (!(expr)) {                                                          \
+      sl_bt_event_trace_host_assert_fail(__FILE__, __LINE__, __VA_ARGS__);  \
+    }                                                                       \
+  } while (0)
+
+#define app_assert_status(sc) \
+  app_assert((sc) == SL_STATUS_OK, "[E: 0x%04x] Status\n", (int)(sc))
+
+#define app_assert_status_f(sc, ...)  app_assert((sc) == SL_STATUS_OK, __VA_ARGS__)
+
+#endif // APP_ASSERT_H
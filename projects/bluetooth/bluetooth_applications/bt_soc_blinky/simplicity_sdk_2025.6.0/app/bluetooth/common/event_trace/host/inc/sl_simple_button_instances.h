@@ -0,0 +1,57 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the simple button instances
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_SIMPLE_BUTTON_INSTANCES_H
+#define SL_SIMPLE_BUTTON_INSTANCES_H
+
+#include <stdint.h>
+
+#define SL_SIMPLE_BUTTON_DISABLED  2U
+#define SL_SIMPLE_BUTTON_PRESSED   1U
+#define SL_SIMPLE_BUTTON_RELEASED  0U
+
+typedef uint8_t sl_button_state_t;
+
+// Button simulated by sl_bt_event_trace_host_stubs.c. It stays released: the
+// runner replays Bluetooth events only.
+typedef struct {
+  uint8_t instance;
+} sl_button_t;
+
+extern const sl_button_t *sl_simple_button_array[];
+
+#define SL_SIMPLE_BUTTON_COUNT 1
+#define SL_SIMPLE_BUTTON_INSTANCE(n) (sl_simple_button_array[n])
+
+sl_button_state_t sl_button_get_state(const sl_button_t *handle);
+void sl_button_enable(const sl_button_t *handle);
+void sl_button_disable(const sl_button_t *handle);
+
+#endif // SL_SIMPLE_BUTTON_INSTANCES_H
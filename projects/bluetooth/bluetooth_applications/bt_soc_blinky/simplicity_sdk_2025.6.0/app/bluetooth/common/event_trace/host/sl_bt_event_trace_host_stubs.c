@@ -0,0 +1,446 @@
+/***************************************************************************//**
+ * @file
+ * @brief Stubbed Bluetooth commands and peripherals of the event trace runner
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sl_common.h"
+#include "sl_bt_api.h"
+#include "sl_bt_stack_init.h"
+#include "app_assert.h"
+#include "app_log.h"
+#include "gpiointerrupt.h"
+#include "sl_simple_button_instances.h"
+#include "sl_simple_led_instances.h"
+#include "sl_bt_event_trace_host.h"
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+// Attribute handles and value size of the local GATT database of the stubs
+#define HOST_ATTRIBUTE_COUNT      256u
+#define HOST_ATTRIBUTE_SIZE_MAX   255u
+
+/*******************************************************************************
+ ********************************   DATA TYPES   *******************************
+ ******************************************************************************/
+
+// Attribute value. An attribute never written reads as zeros.
+typedef struct {
+  uint8_t value[HOST_ATTRIBUTE_SIZE_MAX];
+  size_t len;
+  bool is_written;
+} host_attribute_t;
+
+/*******************************************************************************
+ ***************************  GLOBAL VARIABLES   *******************************
+ ******************************************************************************/
+
+const char *const host_cmd_names[HOST_CMD_COUNT] = {
+  "advertiser_create_set",
+  "advertiser_set_timing",
+  "legacy_advertiser_generate_data",
+  "legacy_advertiser_start",
+  "external_signal",
+  "connection_close",
+  "gap_get_identity_address",
+  "gatt_server_read_attribute_value",
+  "gatt_server_write_attribute_value",
+  "gatt_server_send_notification",
+  "gatt_server_notify_all",
+  "gatt_server_send_user_write_response",
+  "gatt_server_send_user_read_response",
+};
+
+host_cmd_stats_t host_cmd_stats[HOST_CMD_COUNT];
+uint32_t host_cmd_call_count;
+uint32_t host_notification_fail_period;
+bool host_log_enabled;
+uint32_t host_led_change_count;
+
+static const sl_led_t host_led0 = { .instance = 0 };
+const sl_led_t *sl_simple_led_array[] = { &host_led0 };
+
+static const sl_button_t host_btn0 = { .instance = 0 };
+const sl_button_t *sl_simple_button_array[] = { &host_btn0 };
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+static host_attribute_t host_attributes[HOST_ATTRIBUTE_COUNT];
+static uint8_t host_advertising_set_count;
+static uint32_t host_notification_count;
+static bool host_led_on;
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Records a command call.
+ ******************************************************************************/
+static sl_status_t host_cmd_record(host_cmd_t cmd, size_t byte_count, sl_status_t status)
+{
+  host_cmd_stats[cmd].call_count++;
+  host_cmd_stats[cmd].byte_count += byte_count;
+  if (status != SL_STATUS_OK) {
+    host_cmd_stats[cmd].failure_count++;
+  }
+  host_cmd_call_count++;
+
+  return status;
+}
+
+/***************************************************************************//**
+ * Tells if the next notification fails.
+ ******************************************************************************/
+static sl_status_t host_notification_status(void)
+{
+  host_notification_count++;
+  if ((host_notification_fail_period != 0u)
+      && ((host_notification_count % host_notification_fail_period) == 0u)) {
+    return SL_STATUS_NO_MORE_RESOURCE;
+  }
+
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Writes an attribute value in the local GATT database of the stubs.
+ ******************************************************************************/
+void host_attribute_write(uint16_t attribute, uint16_t offset, size_t len, const uint8_t *value)
+{
+  host_attribute_t *entry;
+
+  app_assert((attribute < HOST_ATTRIBUTE_COUNT) && ((offset + len) <= HOST_ATTRIBUTE_SIZE_MAX),
+             "attribute %u, offset %u, length %zu out of the stub database\n",
+             (unsigned int)attribute, (unsigned int)offset, len);
+  entry = &host_attributes[attribute];
+  memcpy(&entry->value[offset], value, len);
+  entry->len = offset + len;
+  entry->is_written = true;
+}
+
+/***************************************************************************//**
+ * Reports a failed application assertion and exits.
+ ******************************************************************************/
+void sl_bt_event_trace_host_assert_fail(const char *file, int line, const char *format, ...)
+{
+  va_list args;
+
+  fprintf(stderr, "FAIL: assertion at %s:%d: ", file, line);
+  va_start(args, format);
+  vfprintf(stderr, format, args);
+  va_end(args);
+  exit(EXIT_FAILURE);
+}
+
+/***************************************************************************//**
+ * Prints an application log when the runner is verbose.
+ ******************************************************************************/
+void sl_bt_event_trace_host_log(const char *format, ...)
+{
+  va_list args;
+
+  if (!host_log_enabled) {
+    return;
+  }
+  va_start(args, format);
+  vprintf(format, args);
+  va_end(args);
+}
+
+// -----------------------------------------------------------------------------
+// Bluetooth stack
+
+// The runner passes the events to sl_bt_process_event() itself, so the event
+// queue of the stack is always empty.
+sl_status_t sl_bt_stack_init(void)
+{
+  return SL_STATUS_OK;
+}
+
+void sl_bt_run(void)
+{
+}
+
+uint32_t sl_bt_event_pending_len(void)
+{
+  return 0u;
+}
+
+sl_status_t sl_bt_pop_event(sl_bt_msg_t *event)
+{
+  (void)event;
+  return SL_STATUS_EMPTY;
+}
+
+// The device would reboot into the OTA DFU mode, which ends the replay.
+void sl_apploader_util_reset_to_ota_dfu(void)
+{
+  printf("Reset to OTA DFU requested\n");
+  exit(EXIT_SUCCESS);
+}
+
+// -----------------------------------------------------------------------------
+// Bluetooth commands
+
+sl_status_t sl_bt_advertiser_create_set(uint8_t *handle)
+{
+  *handle = host_advertising_set_count++;
+  return host_cmd_record(HOST_CMD_ADVERTISER_CREATE_SET, 0u, SL_STATUS_OK);
+}
+
+sl_status_t sl_bt_advertiser_set_timing(uint8_t advertising_set,
+                                        uint32_t interval_min,
+                                        uint32_t interval_max,
+                                        uint16_t duration,
+                                        uint8_t maxevents)
+{
+  (void)interval_min;
+  (void)interval_max;
+  (void)duration;
+  (void)maxevents;
+  return host_cmd_record(HOST_CMD_ADVERTISER_SET_TIMING,
+                         0u,
+                         (advertising_set < host_advertising_set_count) ? SL_STATUS_OK : SL_STATUS_INVALID_HANDLE);
+}
+
+sl_status_t sl_bt_legacy_advertiser_generate_data(uint8_t advertising_set,
+                                                  uint8_t discover)
+{
+  (void)discover;
+  return host_cmd_record(HOST_CMD_LEGACY_ADVERTISER_GENERATE_DATA,
+                         0u,
+                         (advertising_set < host_advertising_set_count) ? SL_STATUS_OK : SL_STATUS_INVALID_HANDLE);
+}
+
+sl_status_t sl_bt_legacy_advertiser_start(uint8_t advertising_set,
+                                          uint8_t connect)
+{
+  (void)connect;
+  return host_cmd_record(HOST_CMD_LEGACY_ADVERTISER_START,
+                         0u,
+                         (advertising_set < host_advertising_set_count) ? SL_STATUS_OK : SL_STATUS_INVALID_HANDLE);
+}
+
+// The external signal events raised on the target are in the trace, so the
+// signals are only counted.
+sl_status_t sl_bt_external_signal(uint32_t signals)
+{
+  (void)signals;
+  return host_cmd_record(HOST_CMD_EXTERNAL_SIGNAL, 0u, SL_STATUS_OK);
+}
+
+sl_status_t sl_bt_connection_close(uint8_t connection)
+{
+  (void)connection;
+  return host_cmd_record(HOST_CMD_CONNECTION_CLOSE, 0u, SL_STATUS_OK);
+}
+
+sl_status_t sl_bt_gap_get_identity_address(bd_addr *address, uint8_t *type)
+{
+  static const bd_addr host_address = { { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 } };
+
+  *address = host_address;
+  *type = sl_bt_gap_public_address;
+  return host_cmd_record(HOST_CMD_GAP_GET_IDENTITY_ADDRESS, sizeof(*address), SL_STATUS_OK);
+}
+
+sl_status_t sl_bt_gatt_server_read_attribute_value(uint16_t attribute,
+                                                   uint16_t offset,
+                                                   size_t max_value_size,
+                                                   size_t *value_len,
+                                                   uint8_t *value)
+{
+  const host_attribute_t *entry;
+  size_t entry_len;
+  size_t len;
+
+  if (attribute >= HOST_ATTRIBUTE_COUNT) {
+    return host_cmd_record(HOST_CMD_GATT_SERVER_READ_ATTRIBUTE_VALUE, 0u, SL_STATUS_BT_ATT_INVALID_HANDLE);
+  }
+  entry = &host_attributes[attribute];
+  entry_len = entry->is_written ? entry->len : HOST_ATTRIBUTE_SIZE_MAX;
+  if (offset > entry_len) {
+    return host_cmd_record(HOST_CMD_GATT_SERVER_READ_ATTRIBUTE_VALUE, 0u, SL_STATUS_BT_ATT_INVALID_OFFSET);
+  }
+  len = SL_MIN(max_value_size, entry_len - offset);
+  memcpy(value, &entry->value[offset], len);
+  *value_len = len;
+
+  return host_cmd_record(HOST_CMD_GATT_SERVER_READ_ATTRIBUTE_VALUE, len, SL_STATUS_OK);
+}
+
+sl_status_t sl_bt_gatt_server_write_attribute_value(uint16_t attribute,
+                                                    uint16_t offset,
+                                                    size_t value_len,
+                                                    const uint8_t* value)
+{
+  if ((attribute >= HOST_ATTRIBUTE_COUNT) || ((offset + value_len) > HOST_ATTRIBUTE_SIZE_MAX)) {
+    return host_cmd_record(HOST_CMD_GATT_SERVER_WRITE_ATTRIBUTE_VALUE, 0u, SL_STATUS_BT_ATT_INVALID_HANDLE);
+  }
+  host_attribute_write(attribute, offset, value_len, value);
+
+  return host_cmd_record(HOST_CMD_GATT_SERVER_WRITE_ATTRIBUTE_VALUE, value_len, SL_STATUS_OK);
+}
+
+sl_status_t sl_bt_gatt_server_send_notification(uint8_t connection,
+                                                uint16_t characteristic,
+                                                size_t value_len,
+                                                const uint8_t* value)
+{
+  (void)connection;
+  (void)characteristic;
+  (void)value;
+  return host_cmd_record(HOST_CMD_GATT_SERVER_SEND_NOTIFICATION, value_len, host_notification_status());
+}
+
+sl_status_t sl_bt_gatt_server_notify_all(uint16_t characteristic,
+                                         size_t value_len,
+                                         const uint8_t* value)
+{
+  (void)characteristic;
+  (void)value;
+  return host_cmd_record(HOST_CMD_GATT_SERVER_NOTIFY_ALL, value_len, host_notification_status());
+}
+
+sl_status_t sl_bt_gatt_server_send_user_write_response(uint8_t connection,
+                                                       uint16_t characteristic,
+                                                       uint8_t att_errorcode)
+{
+  (void)connection;
+  (void)characteristic;
+  (void)att_errorcode;
+  return host_cmd_record(HOST_CMD_GATT_SERVER_SEND_USER_WRITE_RESPONSE, 0u, SL_STATUS_OK);
+}
+
+sl_status_t sl_bt_gatt_server_send_user_read_response(uint8_t connection,
+                                                      uint16_t characteristic,
+                                                      uint8_t att_errorcode,
+                                                      size_t value_len,
+                                                      const uint8_t* value,
+                                                      uint16_t *sent_len)
+{
+  (void)connection;
+  (void)characteristic;
+  (void)value;
+  *sent_len = (att_errorcode == 0u) ? (uint16_t)value_len : 0u;
+  return host_cmd_record(HOST_CMD_GATT_SERVER_SEND_USER_READ_RESPONSE, value_len, SL_STATUS_OK);
+}
+
+// -----------------------------------------------------------------------------
+// LED and button
+
+void sl_led_turn_on(const sl_led_t *led_handle)
+{
+  (void)led_handle;
+  if (!host_led_on) {
+    host_led_on = true;
+    host_led_change_count++;
+  }
+}
+
+void sl_led_turn_off(const sl_led_t *led_handle)
+{
+  (void)led_handle;
+  if (host_led_on) {
+    host_led_on = false;
+    host_led_change_count++;
+  }
+}
+
+void sl_led_toggle(const sl_led_t *led_handle)
+{
+  (void)led_handle;
+  host_led_on = !host_led_on;
+  host_led_change_count++;
+}
+
+sl_button_state_t sl_button_get_state(const sl_button_t *handle)
+{
+  (void)handle;
+  return SL_SIMPLE_BUTTON_RELEASED;
+}
+
+void sl_button_enable(const sl_button_t *handle)
+{
+  (void)handle;
+}
+
+void sl_button_disable(const sl_button_t *handle)
+{
+  (void)handle;
+}
+
+// -----------------------------------------------------------------------------
+// GPIO
+
+void GPIOINT_CallbackRegister(uint8_t intNo, GPIOINT_IrqCallbackPtr_t callbackPtr)
+{
+  (void)intNo;
+  (void)callbackPtr;
+}
+
+void GPIO_PinModeSet(sl_gpio_port_t port, unsigned int pin, GPIO_Mode_TypeDef mode, unsigned int out)
+{
+  (void)port;
+  (void)pin;
+  (void)mode;
+  (void)out;
+}
+
+void GPIO_ExtIntConfig(sl_gpio_port_t port,
+                       unsigned int pin,
+                       unsigned int intNo,
+                       bool risingEdge,
+                       bool fallingEdge,
+                       bool enable)
+{
+  (void)port;
+  (void)pin;
+  (void)intNo;
+  (void)risingEdge;
+  (void)fallingEdge;
+  (void)enable;
+}
+
+void GPIO_IntEnable(uint32_t flags)
+{
+  (void)flags;
+}
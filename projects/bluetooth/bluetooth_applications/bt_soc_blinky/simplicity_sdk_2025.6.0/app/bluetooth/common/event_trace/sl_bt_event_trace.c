@@ -0,0 +1,179 @@
+/***************************************************************************//**
+ * @file
+ * @brief Bluetooth event trace recorder implementation
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include <string.h>
+#include <stdbool.h>
+#include "sl_common.h"
+#include "sl_assert.h"
+#include "sl_sleeptimer.h"
+#include "sl_bt_event_trace.h"
+
+// Size of a record with its data, padded to 4 bytes
+#define RECORD_SIZE(HDR) \
+  ((sizeof(sl_bt_event_trace_record_t) + SL_BT_MSG_LEN(HDR) + 3u) & ~(size_t)3u)
+
+// Trace buffer, NULL when no trace was started
+static uint8_t *trace_buffer = NULL;
+static size_t trace_size = 0;
+static size_t trace_offset = 0;
+static bool is_recording = false;
+static uint32_t dropped_count = 0;
+
+/**************************************************************************//**
+ * Start recording.
+ *****************************************************************************/
+sl_status_t sl_bt_event_trace_start(uint8_t *buffer, size_t size)
+{
+  sl_bt_event_trace_header_t header = {
+    .magic = SL_BT_EVENT_TRACE_MAGIC,
+    .version = SL_BT_EVENT_TRACE_VERSION,
+    .reserved = 0,
+    .timer_frequency = sl_sleeptimer_get_timer_frequency(),
+  };
+
+  if ((buffer == NULL) || (size < sizeof(header))) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  EFM_ASSERT(((uintptr_t)buffer & 3u) == 0);
+
+  memcpy(buffer, &header, sizeof(header));
+  trace_buffer = buffer;
+  trace_size = size;
+  trace_offset = sizeof(header);
+  dropped_count = 0;
+  is_recording = true;
+
+  return SL_STATUS_OK;
+}
+
+/**************************************************************************//**
+ * Stop recording.
+ *****************************************************************************/
+size_t sl_bt_event_trace_stop(void)
+{
+  is_recording = false;
+  return (trace_buffer != NULL) ? trace_offset : 0;
+}
+
+/**************************************************************************//**
+ * Get the number of events that did not fit in the trace buffer.
+ *****************************************************************************/
+uint32_t sl_bt_event_trace_get_dropped_count(void)
+{
+  return dropped_count;
+}
+
+/**************************************************************************//**
+ * Bluetooth stack event handler.
+ *****************************************************************************/
+void sl_bt_event_trace_on_event(const sl_bt_msg_t *evt)
+{
+  sl_bt_event_trace_record_t record;
+  size_t record_size;
+
+  if (!is_recording) {
+    return;
+  }
+
+  record_size = RECORD_SIZE(evt->header);
+  if ((dropped_count > 0) || (record_size > (trace_size - trace_offset))) {
+    dropped_count++;
+    return;
+  }
+
+  record.timestamp = sl_sleeptimer_get_tick_count();
+  record.header = evt->header;
+  memcpy(&trace_buffer[trace_offset], &record, sizeof(record));
+  memcpy(&trace_buffer[trace_offset + sizeof(record)],
+         &evt->data,
+         SL_BT_MSG_LEN(evt->header));
+  trace_offset += record_size;
+}
+
+/**************************************************************************//**
+ * Initialize a reader on a recorded trace.
+ *****************************************************************************/
+sl_status_t sl_bt_event_trace_reader_init(sl_bt_event_trace_reader_t *reader,
+                                          const uint8_t *trace,
+                                          size_t size)
+{
+  sl_bt_event_trace_header_t header;
+
+  EFM_ASSERT(reader != NULL);
+  if ((trace == NULL) || (size < sizeof(header))) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  memcpy(&header, trace, sizeof(header));
+  if ((header.magic != SL_BT_EVENT_TRACE_MAGIC)
+      || (header.version != SL_BT_EVENT_TRACE_VERSION)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  reader->trace = trace;
+  reader->size = size;
+  reader->offset = sizeof(header);
+  reader->timer_frequency = header.timer_frequency;
+
+  return SL_STATUS_OK;
+}
+
+/**************************************************************************//**
+ * Read the next event of a trace.
+ *****************************************************************************/
+sl_status_t sl_bt_event_trace_read(sl_bt_event_trace_reader_t *reader,
+                                   uint32_t *timestamp,
+                                   sl_bt_msg_t *evt)
+{
+  sl_bt_event_trace_record_t record;
+  size_t left;
+
+  EFM_ASSERT((reader != NULL) && (timestamp != NULL) && (evt != NULL));
+  left = reader->size - reader->offset;
+  if (left == 0) {
+    return SL_STATUS_EMPTY;
+  }
+  if (left < sizeof(record)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  memcpy(&record, &reader->trace[reader->offset], sizeof(record));
+  if ((RECORD_SIZE(record.header) > left)
+      || (SL_BT_MSG_LEN(record.header) > sizeof(evt->data))) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  *timestamp = record.timestamp;
+  evt->header = record.header;
+  memcpy(&evt->data,
+         &reader->trace[reader->offset + sizeof(record)],
+         SL_BT_MSG_LEN(record.header));
+  reader->offset += RECORD_SIZE(record.header);
+
+  return SL_STATUS_OK;
+}
@@ -93,7 +93,7 @@ void sl_bt_in_place_ota_dfu_on_event(sl_bt_msg_t *evt)
         sc = app_timer_start(&connection_close_delay,
                              delay_additional_ms,
                              delay_timer_cb,
-                             (void *)((uint32_t) evt->data.evt_gatt_server_user_write_request.connection),
+                             (void *)((uintptr_t) evt->data.evt_gatt_server_user_write_request.connection),
                              false);
         app_assert_status(sc);
       }
@@ -125,7 +125,7 @@ void sl_bt_in_place_ota_dfu_on_event(sl_bt_msg_t *evt)
  *****************************************************************************/
 static void delay_timer_cb(app_timer_t *handle, void *data)
 {
-  uint32_t conn_handle = (uint32_t)data;
+  uint32_t conn_handle = (uint32_t)(uintptr_t)data;
   if (handle == &connection_close_delay && boot_to_dfu) {
     // Close connection before booting into DFU mode.
     (void)sl_bt_connection_close((uint8_t)conn_handle);
@@ -50,6 +50,17 @@ typedef enum {
  *****************************************************************************/
 void sl_bt_in_place_ota_dfu_on_event(sl_bt_msg_t *evt);
 
+/**************************************************************************//**
+ * Events taken by sl_bt_in_place_ota_dfu_on_event(), as ROUTE(event ID,
+ * handler) entries. sl_bt_process_event() only passes these events to the
+ * handler.
+ * @note Keep in sync with the events handled by the handler.
+ *****************************************************************************/
+#define SL_BT_IN_PLACE_OTA_DFU_EVENT_ROUTES(ROUTE)                                     \
+  ROUTE(sl_bt_evt_gatt_server_user_write_request_id, sl_bt_in_place_ota_dfu_on_event) \
+  ROUTE(sl_bt_evt_connection_parameters_id, sl_bt_in_place_ota_dfu_on_event)          \
+  ROUTE(sl_bt_evt_connection_closed_id, sl_bt_in_place_ota_dfu_on_event)
+
 /**************************************************************************//**
  * Callback function to check security requirements before starting the
  * in-place OTA DFU transfer.
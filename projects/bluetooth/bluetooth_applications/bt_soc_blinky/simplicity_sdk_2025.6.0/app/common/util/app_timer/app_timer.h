@@ -43,6 +43,14 @@
 #include "app_timer_types.h"
 #include "sl_status.h"
 
+/// Number of app timer priority levels.
+#ifndef APP_TIMER_PRIORITY_COUNT
+#define APP_TIMER_PRIORITY_COUNT    4
+#endif
+
+/// Priority used by app_timer_start(). 0 is the highest priority.
+#define APP_TIMER_PRIORITY_DEFAULT  0
+
 /***************************************************************************//**
  * Start timer or restart if it is running already.
  *
@@ -60,6 +68,28 @@ sl_status_t app_timer_start(app_timer_t *timer,
                             void *callback_data,
                             bool is_periodic);
 
+/***************************************************************************//**
+ * Start timer with a callback priority or restart if it is running already.
+ *
+ * @param[in] timer Pointer to the timer.
+ * @param[in] timeout_ms Timer timeout, in milliseconds.
+ * @param[in] callback Callback function that is called when timeout expires.
+ * @param[in] callback_data Pointer to user data that will be passed to callback.
+ * @param[in] is_periodic Reload timer when it expires if true.
+ * @param[in] priority Priority of the callback, from 0 (highest) to
+ *                     APP_TIMER_PRIORITY_COUNT - 1. When several timers
+ *                     expired, the callbacks of higher priority are called
+ *                     first, then in expiration order.
+ *
+ * @return Status of the operation.
+ ******************************************************************************/
+sl_status_t app_timer_start_with_priority(app_timer_t *timer,
+                                          uint32_t timeout_ms,
+                                          app_timer_callback_t callback,
+                                          void *callback_data,
+                                          bool is_periodic,
+                                          uint8_t priority);
+
 /***************************************************************************//**
  * Stop running timer.
  *
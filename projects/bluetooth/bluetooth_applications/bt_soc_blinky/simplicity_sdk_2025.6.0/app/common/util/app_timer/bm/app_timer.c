@@ -51,8 +51,11 @@
 /// Number of the triggered timers.
 static volatile uint32_t trigger_count = 0;
 
-/// Start of the linked list which contains the active timers.
-static app_timer_t *app_timer_head = NULL;
+/// Head of the queues of triggered timers, one per priority.
+static app_timer_t *ready_head[APP_TIMER_PRIORITY_COUNT];
+
+/// Tail of the queues of triggered timers, one per priority.
+static app_timer_t *ready_tail[APP_TIMER_PRIORITY_COUNT];
 
 // -----------------------------------------------------------------------------
 // Private function declarations
@@ -67,32 +70,35 @@ static void app_timer_callback(sl_sleeptimer_timer_handle_t *handle,
                                void *data);
 
 /*******************************************************************************
- * Append a timer to the end of the linked list.
+ * Append a triggered timer to the end of the ready queue of its priority.
  *
  * @param[in] timer Pointer to the timer handle.
  *
- * @pre Assumes that the timer is not present in the list.
+ * @pre Assumes that the timer is not present in the ready queues.
  ******************************************************************************/
 static void append_app_timer(app_timer_t *timer);
 
 /*******************************************************************************
- * Remove a timer from the linked list.
+ * Remove a timer from the ready queues.
  *
  * @param[in] timer Pointer to the timer handle.
  *
- * @return Presence of the timer in the linked list.
- * @retval true  Timer was in the list.
- * @retval false Timer was not found in the list.
+ * @return Presence of the timer in the ready queues.
+ * @retval true  Timer was in a ready queue.
+ * @retval false Timer was not found in the ready queues.
+ *
+ * @note Only the triggered timers are walked, the timer itself is not
+ * accessed, so it may not be initialized.
  ******************************************************************************/
 static bool remove_app_timer(app_timer_t *timer);
 
 /*******************************************************************************
- * Find and return the first triggered timer from the linked list.
+ * Take the first triggered timer of the highest priority from the ready
+ * queues.
  *
- * @return The first triggered timer from the linked list.
+ * @return The first triggered timer, NULL if there is none.
  *
- * @note The trigger state is also reset, and it is removed from the list if
- * the timer is non-periodic.
+ * @note The trigger state is also reset.
  ******************************************************************************/
 static app_timer_t *get_triggered_app_timer(void);
 
@@ -104,6 +110,21 @@ sl_status_t app_timer_start(app_timer_t *timer,
                             app_timer_callback_t callback,
                             void *callback_data,
                             bool is_periodic)
+{
+  return app_timer_start_with_priority(timer,
+                                       timeout_ms,
+                                       callback,
+                                       callback_data,
+                                       is_periodic,
+                                       APP_TIMER_PRIORITY_DEFAULT);
+}
+
+sl_status_t app_timer_start_with_priority(app_timer_t *timer,
+                                          uint32_t timeout_ms,
+                                          app_timer_callback_t callback,
+                                          void *callback_data,
+                                          bool is_periodic,
+                                          uint8_t priority)
 {
   sl_status_t sc;
   uint32_t timeout_initial_tick;
@@ -111,7 +132,8 @@ sl_status_t app_timer_start(app_timer_t *timer,
   uint64_t required_tick;
 
   // Check input parameters.
-  if ((timeout_ms == 0) && is_periodic) {
+  if (((timeout_ms == 0) && is_periodic)
+      || (priority >= APP_TIMER_PRIORITY_COUNT)) {
     return SL_STATUS_INVALID_PARAMETER;
   }
 
@@ -122,6 +144,7 @@ sl_status_t app_timer_start(app_timer_t *timer,
   }
 
   timer->triggered = false;
+  timer->priority = priority;
   timer->overflow_counter = 0;
   timer->overflow_max = 0;
 
@@ -142,7 +165,7 @@ sl_status_t app_timer_start(app_timer_t *timer,
                                             timeout_initial_tick,
                                             app_timer_callback,
                                             (void*)timer,
-                                            0,
+                                            priority,
                                             0);
   } else {
     // Start sleeptimer with the given timeout/period.
@@ -152,7 +175,7 @@ sl_status_t app_timer_start(app_timer_t *timer,
         timeout_ms,
         app_timer_callback,
         (void*)timer,
-        0,
+        priority,
         0);
     } else {
       sc = sl_sleeptimer_start_timer_ms(
@@ -160,7 +183,7 @@ sl_status_t app_timer_start(app_timer_t *timer,
         timeout_ms,
         app_timer_callback,
         (void*)timer,
-        0,
+        priority,
         0);
     }
   }
@@ -170,7 +193,6 @@ sl_status_t app_timer_start(app_timer_t *timer,
     timer->callback_data = callback_data;
     timer->periodic = is_periodic;
     timer->timeout_ms = timeout_ms;
-    append_app_timer(timer);
   }
   return sc;
 }
@@ -186,12 +208,10 @@ sl_status_t app_timer_stop(app_timer_t *timer)
   // Stop sleeptimer, ignore error code if was not running.
   (void)sl_sleeptimer_stop_timer(&timer->sleeptimer_handle);
 
+  // Drop the trigger if it has not been served yet.
   timer_present = remove_app_timer(timer);
-  if (timer_present && timer->triggered) {
-    // Timer has been triggered but not served yet.
-    if (trigger_count > 0) {
-      CORE_ATOMIC_SECTION(--trigger_count; )
-    }
+  if (timer_present) {
+    timer->triggered = false;
   }
   return SL_STATUS_OK;
 }
@@ -256,7 +276,7 @@ static void app_timer_callback(sl_sleeptimer_timer_handle_t *handle,
                                              UINT32_MAX,
                                              app_timer_callback,
                                              (void*)timer,
-                                             0,
+                                             timer->priority,
                                              0);
       }
       timer->overflow_counter++;
@@ -264,20 +284,19 @@ static void app_timer_callback(sl_sleeptimer_timer_handle_t *handle,
       if (LONG_TIMER_CHECK(timer)) {
         if (timer->periodic) {
           // Restart long timer
-          app_timer_start(timer,
-                          timer->timeout_ms,
-                          timer->callback,
-                          timer->callback_data,
-                          true);
+          app_timer_start_with_priority(timer,
+                                        timer->timeout_ms,
+                                        timer->callback,
+                                        timer->callback_data,
+                                        true,
+                                        timer->priority);
         } else {
           // Stop periodic timer
           sl_sleeptimer_stop_timer(&timer->sleeptimer_handle);
         }
       }
       timer->triggered = true;
-      if (trigger_count < UINT32_MAX) {
-        ++trigger_count;
-      }
+      append_app_timer(timer);
     }
   }
 }
@@ -287,17 +306,14 @@ static void append_app_timer(app_timer_t *timer)
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_ATOMIC();
 
-  if (app_timer_head != NULL) {
-    app_timer_t *current = app_timer_head;
-    // Find end of list.
-    while (current->next != NULL) {
-      current = current->next;
-    }
-    current->next = timer;
+  timer->next = NULL;
+  if (ready_tail[timer->priority] != NULL) {
+    ready_tail[timer->priority]->next = timer;
   } else {
-    app_timer_head = timer;
+    ready_head[timer->priority] = timer;
   }
-  timer->next = NULL;
+  ready_tail[timer->priority] = timer;
+  ++trigger_count;
 
   CORE_EXIT_ATOMIC();
 }
@@ -307,28 +323,35 @@ static bool remove_app_timer(app_timer_t *timer)
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_ATOMIC();
 
-  app_timer_t *prev = NULL;
-  app_timer_t *current = app_timer_head;
+  for (uint8_t priority = 0; priority < APP_TIMER_PRIORITY_COUNT; priority++) {
+    app_timer_t *prev = NULL;
+    app_timer_t *current = ready_head[priority];
 
-  // Find timer in list.
-  while (current != NULL && current != timer) {
-    prev = current;
-    current = current->next;
-  }
+    // Find timer in queue.
+    while (current != NULL && current != timer) {
+      prev = current;
+      current = current->next;
+    }
 
-  if (current != timer) {
-    // Not found.
-    CORE_EXIT_ATOMIC();
-    return false;
-  }
+    if (current == timer) {
+      if (prev != NULL) {
+        prev->next = timer->next;
+      } else {
+        ready_head[priority] = timer->next;
+      }
+      if (ready_tail[priority] == timer) {
+        ready_tail[priority] = prev;
+      }
+      --trigger_count;
 
-  if (prev != NULL) {
-    prev->next = timer->next;
-  } else {
-    app_timer_head = timer->next;
+      CORE_EXIT_ATOMIC();
+      return true;
+    }
   }
+
+  // Not found.
   CORE_EXIT_ATOMIC();
-  return true;
+  return false;
 }
 
 static app_timer_t *get_triggered_app_timer(void)
@@ -336,23 +359,21 @@ static app_timer_t *get_triggered_app_timer(void)
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_ATOMIC();
 
-  // Find the first triggered timer in list
-  app_timer_t *timer = app_timer_head;
-  while (timer != NULL) {
-    if (timer->triggered) {
-      // Timer found
-      timer->triggered = false;
-      if (trigger_count > 0) {
-        --trigger_count;
-      }
-      if (!timer->periodic) {
-        (void)remove_app_timer(timer);
+  // Take the first timer of the highest priority queue
+  for (uint8_t priority = 0; priority < APP_TIMER_PRIORITY_COUNT; priority++) {
+    app_timer_t *timer = ready_head[priority];
+
+    if (timer != NULL) {
+      ready_head[priority] = timer->next;
+      if (ready_head[priority] == NULL) {
+        ready_tail[priority] = NULL;
       }
+      timer->triggered = false;
+      --trigger_count;
 
       CORE_EXIT_ATOMIC();
       return timer;
     }
-    timer = timer->next;
   }
 
   CORE_EXIT_ATOMIC();
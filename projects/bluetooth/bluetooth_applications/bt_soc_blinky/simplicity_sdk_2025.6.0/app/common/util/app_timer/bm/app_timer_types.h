@@ -62,6 +62,7 @@ struct app_timer {
   app_timer_t *next;
   bool triggered;
   bool periodic;
+  uint8_t priority;
   uint32_t timeout_ms;
   uint16_t overflow_counter;
   uint16_t overflow_max;
@@ -0,0 +1,101 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the device header used by the SE Manager
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef EM_DEVICE_H
+#define EM_DEVICE_H
+
+#include <stdint.h>
+
+// Included by the device system header.
+#include "sl_code_classification.h"
+
+// An EFR32xG24 device, with an SE mailbox. The SEMAILBOX and CMU registers are
+// variables and the core register and NVIC accessors are functions, all
+// defined by the host test, which also plays the SE.
+
+#define _SILICON_LABS_32B_SERIES_2
+#define _SILICON_LABS_32B_SERIES           2
+#define _SILICON_LABS_32B_SERIES_2_CONFIG  4
+#define _SILICON_LABS_32B_SERIES_2_CONFIG_4
+
+#define _SILICON_LABS_SECURITY_FEATURE_SE     0
+#define _SILICON_LABS_SECURITY_FEATURE_VAULT  1
+#define _SILICON_LABS_SECURITY_FEATURE_ROT    2
+#define _SILICON_LABS_SECURITY_FEATURE        _SILICON_LABS_SECURITY_FEATURE_SE
+
+#define __INLINE         inline
+#define __STATIC_INLINE  static inline
+
+#define __DSB()          __sync_synchronize()
+
+#define __NVIC_PRIO_BITS  3U
+
+typedef enum {
+  SEMBRX_IRQn = 1,
+} IRQn_Type;
+
+void NVIC_SetPriority(IRQn_Type irqn, uint32_t priority);
+uint32_t NVIC_GetPriority(IRQn_Type irqn);
+void NVIC_EnableIRQ(IRQn_Type irqn);
+void NVIC_DisableIRQ(IRQn_Type irqn);
+void NVIC_ClearPendingIRQ(IRQn_Type irqn);
+
+uint32_t __get_PRIMASK(void);
+uint32_t __get_BASEPRI(void);
+uint32_t __get_IPSR(void);
+
+#define SEMAILBOX_PRESENT
+
+typedef struct {
+  volatile uint32_t RX_STATUS;
+  volatile uint32_t RX_HEADER;
+  volatile uint32_t FIFO;
+  volatile uint32_t CONFIGURATION;
+} SEMAILBOX_HOST_TypeDef;
+
+extern SEMAILBOX_HOST_TypeDef host_semailbox;
+
+#define SEMAILBOX_HOST                     (&host_semailbox)
+#define SEMAILBOX_RX_STATUS_RXINT          (0x1UL << 22)
+#define SEMAILBOX_CONFIGURATION_TXINTEN    (0x1UL << 0)
+#define SEMAILBOX_CONFIGURATION_RXINTEN    (0x1UL << 1)
+
+typedef struct {
+  volatile uint32_t CLKEN1;
+} CMU_TypeDef;
+
+extern CMU_TypeDef host_cmu;
+
+#define CMU                                (&host_cmu)
+#define _CMU_CLKEN1_SEMAILBOXHOST_SHIFT    10
+#define _CMU_CLKEN1_SEMAILBOXHOST_MASK     (0x1UL << _CMU_CLKEN1_SEMAILBOXHOST_SHIFT)
+
+#endif // EM_DEVICE_H
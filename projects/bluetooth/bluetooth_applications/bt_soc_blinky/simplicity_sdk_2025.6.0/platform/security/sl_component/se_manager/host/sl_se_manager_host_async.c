@@ -0,0 +1,524 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the SE Manager asynchronous command queue
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Checks the asynchronous SE mailbox command queue against a mock SE.
+ *
+ * The mock SE records the commands written to the mailbox and fails if one is
+ * written while another is executing or while the SEMAILBOX clock is off. The
+ * test completes the commands and runs the SEMBRX interrupt handler, which
+ * calls the completion callbacks. A synchronous command completes as soon as
+ * it is written. A critical section takes a lock that the interrupt handler
+ * waits for, and __get_PRIMASK() reports it.
+ *
+ * Usage: sl_se_manager_host_async
+ ******************************************************************************/
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "em_device.h"
+#include "sl_core.h"
+#include "sl_power_manager.h"
+#include "sl_se_manager.h"
+#include "sli_se_manager_internal.h"
+#include "sli_se_manager_mailbox.h"
+
+#if !defined(SL_SE_MANAGER_ASYNC_COMMANDS)
+#error "The asynchronous command test requires SL_SE_MANAGER_ASYNC_COMMANDS."
+#endif
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+// Command word flag of the commands the mock SE completes at once.
+#define HOST_COMMAND_SYNC     0x80000000UL
+
+#define HOST_CONTEXT_COUNT    4u
+#define HOST_LOG_LEN          16u
+
+// Time the SE takes to complete a command while the application waits.
+#define HOST_SE_DELAY_NS      10000000L
+
+#define HOST_CHECK(expr)                                              \
+  do {                                                                \
+    if (!(expr)) {                                                    \
+      fprintf(stderr, "FAIL %s:%d: %s\n", __FILE__, __LINE__, #expr); \
+      exit(EXIT_FAILURE);                                             \
+    }                                                                 \
+  } while (0)
+
+/*******************************************************************************
+ ********************************   DATA TYPES   *******************************
+ ******************************************************************************/
+
+// What a completion callback does besides recording the completion.
+typedef enum {
+  HOST_ON_DONE_NOTHING,
+  HOST_ON_DONE_QUEUE,          // Queue the command in host_on_done_ctx
+  HOST_ON_DONE_SYNC,           // Run a synchronous command
+} host_on_done_t;
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+static pthread_mutex_t host_core_lock;
+static __thread uint32_t host_core_depth;
+static __thread bool host_in_isr;
+
+static uint32_t host_nvic_priority;
+static bool host_nvic_enabled;
+
+static volatile int32_t host_em1_requirements;
+
+// Command executing on the mock SE, NULL when idle.
+static sli_se_mailbox_command_t *volatile host_se_command;
+
+// Command words written to the mailbox, in order.
+static uint32_t host_executed[HOST_LOG_LEN];
+static volatile uint32_t host_executed_count;
+
+// Completions, in order.
+static uint32_t host_done[HOST_LOG_LEN];
+static sl_status_t host_done_status[HOST_LOG_LEN];
+static uint32_t host_done_count;
+
+static sl_se_command_context_t host_ctx[HOST_CONTEXT_COUNT];
+static sl_se_command_context_t *host_on_done_ctx;
+static sl_status_t host_on_done_sync_status;
+
+/*******************************************************************************
+ *************************   GLOBAL FUNCTION PROTOTYPES   **********************
+ ******************************************************************************/
+
+// SE mailbox interrupt handler of sl_se_manager.c.
+void SEMBRX_IRQHandler(void);
+
+/*******************************************************************************
+ ***************************  GLOBAL VARIABLES   *******************************
+ ******************************************************************************/
+
+SEMAILBOX_HOST_TypeDef host_semailbox;
+
+CMU_TypeDef host_cmu;
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Checks whether the SEMAILBOX clock is on.
+ ******************************************************************************/
+static bool host_clock_is_on(void)
+{
+  return (host_cmu.CLKEN1 & _CMU_CLKEN1_SEMAILBOXHOST_MASK) != 0;
+}
+
+/***************************************************************************//**
+ * Completes the command executing on the mock SE and runs the SEMBRX
+ * interrupt handler if the interrupt is enabled. The handler waits for the
+ * critical sections of the other threads, as the interrupt would be masked.
+ ******************************************************************************/
+static void host_se_complete(uint32_t response)
+{
+  HOST_CHECK(host_se_command != NULL);
+  host_semailbox.RX_HEADER = response;
+  host_semailbox.RX_STATUS = SEMAILBOX_RX_STATUS_RXINT;
+  host_se_command = NULL;
+
+  if (host_nvic_enabled
+      && ((host_semailbox.CONFIGURATION & SEMAILBOX_CONFIGURATION_RXINTEN) != 0)) {
+    pthread_mutex_lock(&host_core_lock);
+    pthread_mutex_unlock(&host_core_lock);
+    host_in_isr = true;
+    SEMBRX_IRQHandler();
+    host_in_isr = false;
+  }
+}
+
+/***************************************************************************//**
+ * Completes the command executing on the mock SE after a delay, from a second
+ * thread.
+ ******************************************************************************/
+static void *host_se_thread(void *arg)
+{
+  struct timespec delay = { 0, HOST_SE_DELAY_NS };
+
+  (void)arg;
+  nanosleep(&delay, NULL);
+  host_se_complete(SLI_SE_RESPONSE_OK);
+  return NULL;
+}
+
+/***************************************************************************//**
+ * Completion callback. user_data holds a host_on_done_t.
+ *
+ * @note (1) The next queued command is only started after the callback
+ *           returns, see sli_se_execute_async().
+ ******************************************************************************/
+static void host_on_done(sl_se_command_context_t *cmd_ctx,
+                         sl_status_t status,
+                         void *user_data)
+{
+  sl_se_command_context_t sync_ctx;
+
+  HOST_CHECK(host_in_isr);
+  HOST_CHECK(host_done_count < HOST_LOG_LEN);
+  host_done[host_done_count] = cmd_ctx->command.command;
+  host_done_status[host_done_count] = status;
+  host_done_count++;
+
+  // See Note #1.
+  HOST_CHECK(host_se_command == NULL);
+  HOST_CHECK(host_em1_requirements == 1);
+
+  switch ((host_on_done_t)(uintptr_t)user_data) {
+    case HOST_ON_DONE_QUEUE:
+      HOST_CHECK(sli_se_execute_async(host_on_done_ctx, host_on_done, NULL) == SL_STATUS_OK);
+      HOST_CHECK(host_se_command == NULL);
+      break;
+
+    case HOST_ON_DONE_SYNC:
+      sl_se_init_command_context(&sync_ctx);
+      sync_ctx.command.command = HOST_COMMAND_SYNC | 5u;
+      host_on_done_sync_status = sli_se_execute_and_wait(&sync_ctx);
+      break;
+
+    default:
+      break;
+  }
+}
+
+/***************************************************************************//**
+ * Prepares a command context with the command word id.
+ ******************************************************************************/
+static sl_se_command_context_t *host_context(uint32_t index, uint32_t id)
+{
+  sl_se_command_context_t *cmd_ctx = &host_ctx[index];
+
+  HOST_CHECK(sl_se_init_command_context(cmd_ctx) == SL_STATUS_OK);
+  cmd_ctx->command.command = id;
+  return cmd_ctx;
+}
+
+/***************************************************************************//**
+ * Queues a command with a completion callback.
+ ******************************************************************************/
+static void host_queue(sl_se_command_context_t *cmd_ctx, host_on_done_t on_done)
+{
+  HOST_CHECK(sli_se_execute_async(cmd_ctx, host_on_done, (void *)(uintptr_t)on_done) == SL_STATUS_OK);
+}
+
+/***************************************************************************//**
+ * Checks the command words written to the mailbox since the previous call.
+ ******************************************************************************/
+static void host_check_executed(const uint32_t *expected, uint32_t count)
+{
+  HOST_CHECK(host_executed_count == count);
+  for (uint32_t i = 0; i < count; i++) {
+    HOST_CHECK(host_executed[i] == expected[i]);
+  }
+  host_executed_count = 0;
+}
+
+/***************************************************************************//**
+ * Checks that the queue is idle: no command executing, no clock and no EM1
+ * requirement held, and the mailbox interrupt disabled.
+ ******************************************************************************/
+static void host_check_idle(void)
+{
+  HOST_CHECK(host_se_command == NULL);
+  HOST_CHECK(host_em1_requirements == 0);
+  HOST_CHECK(!host_clock_is_on());
+  HOST_CHECK((host_semailbox.CONFIGURATION & SEMAILBOX_CONFIGURATION_RXINTEN) == 0);
+}
+
+/***************************************************************************//**
+ * Commands complete in order, each callback with its own status, and the
+ * queue holds the clock and one EM1 requirement while it is not empty.
+ ******************************************************************************/
+static void host_test_order(void)
+{
+  static const uint32_t first[] = { 1u };
+  static const uint32_t second[] = { 2u };
+  static const uint32_t third[] = { 3u };
+
+  host_queue(host_context(0, 1u), HOST_ON_DONE_NOTHING);
+  host_queue(host_context(1, 2u), HOST_ON_DONE_NOTHING);
+  host_queue(host_context(2, 3u), HOST_ON_DONE_NOTHING);
+  host_check_executed(first, 1);
+  HOST_CHECK(host_em1_requirements == 1);
+  HOST_CHECK(host_clock_is_on());
+  HOST_CHECK((host_semailbox.CONFIGURATION & SEMAILBOX_CONFIGURATION_RXINTEN) != 0);
+
+  host_se_complete(SLI_SE_RESPONSE_OK);
+  host_check_executed(second, 1);
+  host_se_complete(SLI_SE_RESPONSE_INVALID_PARAMETER);
+  host_check_executed(third, 1);
+  host_se_complete(SLI_SE_RESPONSE_OK);
+  host_check_executed(NULL, 0);
+
+  HOST_CHECK(host_done_count == 3);
+  HOST_CHECK((host_done[0] == 1u) && (host_done[1] == 2u) && (host_done[2] == 3u));
+  HOST_CHECK(host_done_status[0] == SL_STATUS_OK);
+  HOST_CHECK(host_done_status[1] == SL_STATUS_INVALID_PARAMETER);
+  HOST_CHECK(host_done_status[2] == SL_STATUS_OK);
+  host_check_idle();
+}
+
+/***************************************************************************//**
+ * A queued command cannot be queued again, a waiting command can be
+ * cancelled and the executing one cannot.
+ ******************************************************************************/
+static void host_test_cancel(void)
+{
+  static const uint32_t first[] = { 1u };
+  static const uint32_t last[] = { 3u };
+  sl_se_command_context_t *ctx1 = host_context(0, 1u);
+  sl_se_command_context_t *ctx2 = host_context(1, 2u);
+  sl_se_command_context_t *ctx3 = host_context(2, 3u);
+
+  host_queue(ctx1, HOST_ON_DONE_NOTHING);
+  host_queue(ctx2, HOST_ON_DONE_NOTHING);
+  host_queue(ctx3, HOST_ON_DONE_NOTHING);
+  HOST_CHECK(sli_se_execute_async(ctx2, host_on_done, NULL) == SL_STATUS_ALREADY_EXISTS);
+  HOST_CHECK(sli_se_execute_async(NULL, host_on_done, NULL) == SL_STATUS_INVALID_PARAMETER);
+  HOST_CHECK(sli_se_execute_async(host_context(3, 4u), NULL, NULL) == SL_STATUS_INVALID_PARAMETER);
+
+  HOST_CHECK(sli_se_cancel_async(ctx2) == SL_STATUS_OK);
+  HOST_CHECK(sli_se_cancel_async(ctx2) == SL_STATUS_NOT_FOUND);
+  HOST_CHECK(sli_se_cancel_async(ctx1) == SL_STATUS_BUSY);
+  HOST_CHECK(sli_se_cancel_async(ctx3) == SL_STATUS_OK);
+  HOST_CHECK(sli_se_execute_async(ctx3, host_on_done, NULL) == SL_STATUS_OK);
+  host_check_executed(first, 1);
+
+  host_done_count = 0;
+  host_se_complete(SLI_SE_RESPONSE_OK);
+  host_check_executed(last, 1);
+  host_se_complete(SLI_SE_RESPONSE_OK);
+  HOST_CHECK(host_done_count == 2);
+  HOST_CHECK((host_done[0] == 1u) && (host_done[1] == 3u));
+  host_check_idle();
+}
+
+/***************************************************************************//**
+ * A command queued from a completion callback runs after the commands already
+ * queued, and a synchronous command run from a callback runs before them.
+ ******************************************************************************/
+static void host_test_callback(void)
+{
+  static const uint32_t queue_order[] = { 1u, 2u, 4u };
+  static const uint32_t sync_order[] = { 1u, HOST_COMMAND_SYNC | 5u, 2u };
+
+  host_on_done_ctx = host_context(3, 4u);
+  host_queue(host_context(0, 1u), HOST_ON_DONE_QUEUE);
+  host_queue(host_context(1, 2u), HOST_ON_DONE_NOTHING);
+  host_se_complete(SLI_SE_RESPONSE_OK);
+  host_se_complete(SLI_SE_RESPONSE_OK);
+  host_se_complete(SLI_SE_RESPONSE_OK);
+  host_check_executed(queue_order, 3);
+  host_check_idle();
+
+  host_on_done_sync_status = SL_STATUS_FAIL;
+  host_queue(host_context(0, 1u), HOST_ON_DONE_SYNC);
+  host_queue(host_context(1, 2u), HOST_ON_DONE_NOTHING);
+  host_se_complete(SLI_SE_RESPONSE_OK);
+  HOST_CHECK(host_on_done_sync_status == SL_STATUS_OK);
+  host_se_complete(SLI_SE_RESPONSE_OK);
+  host_check_executed(sync_order, 3);
+  host_check_idle();
+}
+
+/***************************************************************************//**
+ * A synchronous command waits for the executing asynchronous command, and
+ * runs before the queued ones. It is refused from a critical section, where
+ * the wait would never end.
+ ******************************************************************************/
+static void host_test_sync(void)
+{
+  static const uint32_t idle_order[] = { HOST_COMMAND_SYNC | 6u };
+  static const uint32_t wait_order[] = { 1u, HOST_COMMAND_SYNC | 6u, 2u };
+  static const uint32_t busy_order[] = { 1u };
+  sl_se_command_context_t sync_ctx;
+  pthread_t thread;
+
+  sl_se_init_command_context(&sync_ctx);
+  sync_ctx.command.command = HOST_COMMAND_SYNC | 6u;
+  HOST_CHECK(sli_se_execute_and_wait(&sync_ctx) == SL_STATUS_OK);
+  host_check_executed(idle_order, 1);
+  host_check_idle();
+
+  host_queue(host_context(0, 1u), HOST_ON_DONE_NOTHING);
+  host_queue(host_context(1, 2u), HOST_ON_DONE_NOTHING);
+  HOST_CHECK(pthread_create(&thread, NULL, host_se_thread, NULL) == 0);
+  HOST_CHECK(sli_se_execute_and_wait(&sync_ctx) == SL_STATUS_OK);
+  HOST_CHECK(pthread_join(thread, NULL) == 0);
+  host_se_complete(SLI_SE_RESPONSE_OK);
+  host_check_executed(wait_order, 3);
+  host_check_idle();
+
+  host_queue(host_context(0, 1u), HOST_ON_DONE_NOTHING);
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_CRITICAL();
+  HOST_CHECK(sli_se_execute_and_wait(&sync_ctx) == SL_STATUS_BUSY);
+  CORE_EXIT_CRITICAL();
+  host_se_complete(SLI_SE_RESPONSE_OK);
+  host_check_executed(busy_order, 1);
+  host_check_idle();
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Mock SE: starts a command. A synchronous command completes at once.
+ ******************************************************************************/
+void sli_se_mailbox_execute_command(sli_se_mailbox_command_t *command)
+{
+  HOST_CHECK(host_se_command == NULL);
+  HOST_CHECK(host_clock_is_on());
+  HOST_CHECK(host_executed_count < HOST_LOG_LEN);
+  host_executed[host_executed_count++] = command->command;
+  host_semailbox.RX_STATUS = 0;
+  host_se_command = command;
+  if ((command->command & HOST_COMMAND_SYNC) != 0) {
+    host_semailbox.RX_HEADER = SLI_SE_RESPONSE_OK;
+    host_semailbox.RX_STATUS = SEMAILBOX_RX_STATUS_RXINT;
+    host_se_command = NULL;
+  }
+}
+
+void host_core_enter(void)
+{
+  pthread_mutex_lock(&host_core_lock);
+  host_core_depth++;
+}
+
+void host_core_exit(void)
+{
+  host_core_depth--;
+  pthread_mutex_unlock(&host_core_lock);
+}
+
+uint32_t __get_PRIMASK(void)
+{
+  return (host_core_depth > 0) ? 1U : 0U;
+}
+
+uint32_t __get_BASEPRI(void)
+{
+  return 0;
+}
+
+uint32_t __get_IPSR(void)
+{
+  return host_in_isr ? (16U + (uint32_t)SEMBRX_IRQn) : 0U;
+}
+
+void NVIC_SetPriority(IRQn_Type irqn, uint32_t priority)
+{
+  HOST_CHECK(irqn == SEMBRX_IRQn);
+  host_nvic_priority = priority;
+}
+
+uint32_t NVIC_GetPriority(IRQn_Type irqn)
+{
+  HOST_CHECK(irqn == SEMBRX_IRQn);
+  return host_nvic_priority;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irqn)
+{
+  HOST_CHECK(irqn == SEMBRX_IRQn);
+  host_nvic_enabled = true;
+}
+
+void NVIC_DisableIRQ(IRQn_Type irqn)
+{
+  HOST_CHECK(irqn == SEMBRX_IRQn);
+  host_nvic_enabled = false;
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type irqn)
+{
+  HOST_CHECK(irqn == SEMBRX_IRQn);
+}
+
+void sl_power_manager_add_em_requirement(sl_power_manager_em_t em)
+{
+  HOST_CHECK(em == SL_POWER_MANAGER_EM1);
+  host_em1_requirements++;
+}
+
+void sl_power_manager_remove_em_requirement(sl_power_manager_em_t em)
+{
+  HOST_CHECK(em == SL_POWER_MANAGER_EM1);
+  HOST_CHECK(host_em1_requirements > 0);
+  host_em1_requirements--;
+}
+
+/***************************************************************************//**
+ * Runs the asynchronous command test.
+ ******************************************************************************/
+int main(void)
+{
+  pthread_mutexattr_t attr;
+
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&host_core_lock, &attr);
+
+  HOST_CHECK(sl_se_init() == SL_STATUS_OK);
+  HOST_CHECK(host_nvic_enabled);
+  HOST_CHECK(host_nvic_priority == CORE_ATOMIC_BASE_PRIORITY_LEVEL);
+  host_check_idle();
+
+  host_test_order();
+  host_test_cancel();
+  host_test_callback();
+  host_test_sync();
+
+  host_queue(host_context(0, 1u), HOST_ON_DONE_NOTHING);
+  HOST_CHECK(sl_se_deinit() == SL_STATUS_BUSY);
+  host_se_complete(SLI_SE_RESPONSE_OK);
+  HOST_CHECK(sl_se_deinit() == SL_STATUS_OK);
+  HOST_CHECK(!host_nvic_enabled);
+
+  printf("SE asynchronous command queue ok\n");
+  return EXIT_SUCCESS;
+}
@@ -51,6 +51,28 @@
 extern "C" {
 #endif
 
+#if defined(RADIOAES_PRESENT)
+
+/// Number of AES-CTR keystream blocks a precompute context can hold.
+#ifndef SLI_AES_CTR_KEYSTREAM_BLOCKS
+#define SLI_AES_CTR_KEYSTREAM_BLOCKS 4
+#endif
+
+/// AES-CTR keystream precompute context. Keystream blocks are generated ahead
+/// of time by sli_aes_ctr_keystream_fill() and consumed in counter order by
+/// sli_aes_crypt_ctr_keystream(). Members are private.
+typedef struct {
+  unsigned char key[32];                                        ///< AES key
+  unsigned int  keybits;                                        ///< Key size in bits
+  unsigned char counter[16];                                    ///< Next counter block to generate
+  unsigned char keystream[SLI_AES_CTR_KEYSTREAM_BLOCKS][16];    ///< Keystream ring
+  uint8_t       head;                                           ///< Ring index of the next block to consume
+  uint8_t       count;                                          ///< Number of precomputed blocks in the ring
+  uint32_t      epoch;                                          ///< Bumped whenever a counter is taken outside the ring
+} sli_aes_ctr_keystream_t;
+
+#endif // RADIOAES_PRESENT
+
 /***************************************************************************//**
  * @brief          Initialise Silabs internal protocol crypto library
  *
@@ -115,6 +137,65 @@ sl_status_t sli_aes_cmac_radio(const unsigned char    *key,
                                unsigned int           length,
                                volatile unsigned char output[16]);
 
+/***************************************************************************//**
+ * @brief          Set up an AES-CTR keystream precompute context
+ *
+ * @details        Any keystream held by the context is erased, so this is
+ *                 also the rekey operation. No keystream is generated until
+ *                 sli_aes_ctr_keystream_fill() is called.
+ *
+ * @param ctx      Context to set up
+ * @param key      AES key, copied into the context
+ * @param keybits  must be 128 or 256
+ * @param iv       16-byte initial counter block
+ *
+ * @return         SL_STATUS_OK if successful, relevant status code on error
+ ******************************************************************************/
+sl_status_t sli_aes_ctr_keystream_init(sli_aes_ctr_keystream_t *ctx,
+                                       const unsigned char     *key,
+                                       unsigned int            keybits,
+                                       const unsigned char     iv[16]);
+
+/***************************************************************************//**
+ * @brief          Top up the keystream ring of a precompute context
+ *
+ * @details        Intended to be called from idle time. Must run at a lower
+ *                 priority than sli_aes_crypt_ctr_keystream() on the same
+ *                 context, which may preempt it; a block whose counter was
+ *                 consumed meanwhile is discarded.
+ *
+ * @param ctx      Context set up with sli_aes_ctr_keystream_init()
+ *
+ * @return         SL_STATUS_OK if successful, relevant status code on error
+ ******************************************************************************/
+sl_status_t sli_aes_ctr_keystream_fill(sli_aes_ctr_keystream_t *ctx);
+
+/***************************************************************************//**
+ * @brief          AES-CTR block encryption/decryption using precomputed
+ *                 keystream
+ *
+ * @details        XORs the input with the next precomputed keystream block
+ *                 and erases that block. If the ring is empty, the keystream
+ *                 is computed inline as with sli_aes_crypt_ctr_radio().
+ *
+ * @param ctx      Context set up with sli_aes_ctr_keystream_init()
+ * @param input    16-byte input block
+ * @param output   16-byte output block
+ *
+ * @return         SL_STATUS_OK if successful, relevant status code on error
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLI_PROTOCOL_CRYPTO, SL_CODE_CLASS_TIME_CRITICAL)
+sl_status_t sli_aes_crypt_ctr_keystream(sli_aes_ctr_keystream_t *ctx,
+                                        const unsigned char     input[16],
+                                        unsigned char           output[16]);
+
+/***************************************************************************//**
+ * @brief          Erase the key and all keystream held by a precompute context
+ *
+ * @param ctx      Context to erase
+ ******************************************************************************/
+void sli_aes_ctr_keystream_free(sli_aes_ctr_keystream_t *ctx);
+
 /***************************************************************************//**
  * @brief         Seeds the AES mask. It is recommended to call this function
                   during initialization in order to avoid taking the potential
@@ -0,0 +1,531 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test and benchmark of the PSA driver wrapper hash dispatch
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Checks which driver the hash entry points of psa_crypto_driver_wrappers.h
+ * call, and times the dispatch.
+ *
+ * The wrappers are built for a CRYPTOACC device, see inc/, which accelerates
+ * SHA-1, SHA-224 and SHA-256, and leaves SHA-384 and SHA-512 to the builtin
+ * implementation. Both drivers are stubs that count their calls. This file is
+ * built once with SLI_PSA_DRIVER_WRAPPERS_STATIC_DISPATCH and once without,
+ * so that compute and setup either call the driver of the algorithm, or the
+ * accelerator and then the builtin implementation when the accelerator does
+ * not support the algorithm.
+ *
+ * The benchmark calls each entry point through the wrappers and directly, for
+ * an accelerated and a builtin algorithm, and prints the difference as the
+ * cost of the dispatch.
+ *
+ * Usage: sli_psa_driver_wrappers_host [options]
+ *   -n <count>   Calls per entry point and algorithm. Default: 10000000.
+ ******************************************************************************/
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "psa/crypto.h"
+#include "psa_crypto_hash.h"
+#include "sli_psa_driver_features.h"
+#include "sli_cryptoacc_transparent_functions.h"
+#include "sli_psa_driver_wrappers_host.h"
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+#define HOST_CALLS_DEFAULT  10000000u
+
+#if defined(SLI_PSA_DRIVER_FEATURE_STATIC_HASH_DISPATCH)
+  #define HOST_DISPATCH     "static"
+#else
+  #define HOST_DISPATCH     "probing"
+#endif
+
+/*******************************************************************************
+ ********************************   DATA TYPES   *******************************
+ ******************************************************************************/
+
+typedef enum {
+  HOST_DRIVER_ACCEL,
+  HOST_DRIVER_BUILTIN,
+  HOST_DRIVER_COUNT
+} host_driver_t;
+
+typedef enum {
+  HOST_ENTRY_COMPUTE,
+  HOST_ENTRY_SETUP,
+  HOST_ENTRY_CLONE,
+  HOST_ENTRY_UPDATE,
+  HOST_ENTRY_FINISH,
+  HOST_ENTRY_ABORT,
+  HOST_ENTRY_COUNT
+} host_entry_t;
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+static const char *const host_entry_names[HOST_ENTRY_COUNT] = {
+  "compute",
+  "setup",
+  "clone",
+  "update",
+  "finish",
+  "abort",
+};
+
+// Calls of each driver entry point.
+static uint32_t host_calls[HOST_DRIVER_COUNT][HOST_ENTRY_COUNT];
+
+static uint64_t host_check_count;
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Fails the test unless a condition holds.
+ ******************************************************************************/
+static void host_expect(bool condition, const char *what)
+{
+  host_check_count++;
+  if (!condition) {
+    fprintf(stderr, "FAIL: %s\n", what);
+    exit(EXIT_FAILURE);
+  }
+}
+
+/***************************************************************************//**
+ * Returns a monotonic timestamp in nanoseconds.
+ ******************************************************************************/
+static uint64_t host_time_ns(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+static bool host_is_accelerated(psa_algorithm_t alg)
+{
+  return (alg == PSA_ALG_SHA_1) || (alg == PSA_ALG_SHA_224) || (alg == PSA_ALG_SHA_256);
+}
+
+static bool host_is_builtin(psa_algorithm_t alg)
+{
+  return (alg == PSA_ALG_SHA_384) || (alg == PSA_ALG_SHA_512);
+}
+
+/***************************************************************************//**
+ * Checks that every entry point was called the expected number of times.
+ ******************************************************************************/
+static void host_expect_calls(const uint32_t expected[HOST_DRIVER_COUNT][HOST_ENTRY_COUNT], const char *what)
+{
+  for (int driver = 0; driver < HOST_DRIVER_COUNT; driver++) {
+    for (int entry = 0; entry < HOST_ENTRY_COUNT; entry++) {
+      if (host_calls[driver][entry] != expected[driver][entry]) {
+        fprintf(stderr, "%s: %s %s called %" PRIu32 " times, expected %" PRIu32 "\n",
+                what,
+                (driver == HOST_DRIVER_ACCEL) ? "accelerator" : "builtin",
+                host_entry_names[entry],
+                host_calls[driver][entry],
+                expected[driver][entry]);
+      }
+      host_expect(host_calls[driver][entry] == expected[driver][entry], what);
+    }
+  }
+  memset(host_calls, 0, sizeof(host_calls));
+}
+
+/***************************************************************************//**
+ * Checks the driver calls of the hash entry points for one algorithm.
+ ******************************************************************************/
+static void host_check_algorithm(psa_algorithm_t alg, const char *name)
+{
+  uint32_t expected[HOST_DRIVER_COUNT][HOST_ENTRY_COUNT];
+  psa_hash_operation_t operation = PSA_HASH_OPERATION_INIT;
+  psa_hash_operation_t clone = PSA_HASH_OPERATION_INIT;
+  uint8_t hash[PSA_HASH_MAX_SIZE];
+  size_t hash_length;
+  host_driver_t driver;
+  bool supported = host_is_accelerated(alg) || host_is_builtin(alg);
+  psa_status_t status;
+
+  driver = host_is_accelerated(alg) ? HOST_DRIVER_ACCEL : HOST_DRIVER_BUILTIN;
+  printf("%-8s", name);
+
+  // Compute and setup try the accelerator first unless the dispatch is
+  // static, then the builtin implementation.
+  memset(expected, 0, sizeof(expected));
+#if defined(SLI_PSA_DRIVER_FEATURE_STATIC_HASH_DISPATCH)
+  expected[driver][HOST_ENTRY_COMPUTE] = 1u;
+#else
+  expected[HOST_DRIVER_ACCEL][HOST_ENTRY_COMPUTE] = 1u;
+  expected[HOST_DRIVER_BUILTIN][HOST_ENTRY_COMPUTE] = (driver == HOST_DRIVER_BUILTIN) ? 1u : 0u;
+#endif
+  status = host_wrapper_hash_compute(alg, (const uint8_t *)"abc", 3u, hash, sizeof(hash), &hash_length);
+  host_expect(status == (supported ? PSA_SUCCESS : PSA_ERROR_NOT_SUPPORTED), "compute status");
+  host_expect_calls((const uint32_t (*)[HOST_ENTRY_COUNT])expected, "compute");
+
+  memset(expected, 0, sizeof(expected));
+#if defined(SLI_PSA_DRIVER_FEATURE_STATIC_HASH_DISPATCH)
+  expected[driver][HOST_ENTRY_SETUP] = 1u;
+#else
+  expected[HOST_DRIVER_ACCEL][HOST_ENTRY_SETUP] = 1u;
+  expected[HOST_DRIVER_BUILTIN][HOST_ENTRY_SETUP] = (driver == HOST_DRIVER_BUILTIN) ? 1u : 0u;
+#endif
+  status = host_wrapper_hash_setup(&operation, alg);
+  host_expect(status == (supported ? PSA_SUCCESS : PSA_ERROR_NOT_SUPPORTED), "setup status");
+  host_expect_calls((const uint32_t (*)[HOST_ENTRY_COUNT])expected, "setup");
+
+  if (!supported) {
+    // The operation was not set up, so no driver owns it.
+    host_expect(host_wrapper_hash_update(&operation, (const uint8_t *)"abc", 3u) == PSA_ERROR_BAD_STATE,
+                "update of an operation that is not set up");
+    host_expect(host_wrapper_hash_abort(&operation) == PSA_ERROR_BAD_STATE, "abort of an operation that is not set up");
+    memset(expected, 0, sizeof(expected));
+    host_expect_calls((const uint32_t (*)[HOST_ENTRY_COUNT])expected, "operation that is not set up");
+    printf(" not supported\n");
+    return;
+  }
+
+  // The other entry points go to the driver that set the operation up.
+  memset(expected, 0, sizeof(expected));
+  expected[driver][HOST_ENTRY_UPDATE] = 1u;
+  expected[driver][HOST_ENTRY_CLONE] = 1u;
+  expected[driver][HOST_ENTRY_FINISH] = 2u;
+  expected[driver][HOST_ENTRY_ABORT] = 2u;
+  host_expect(host_wrapper_hash_update(&operation, (const uint8_t *)"abc", 3u) == PSA_SUCCESS, "update status");
+  host_expect(host_wrapper_hash_clone(&operation, &clone) == PSA_SUCCESS, "clone status");
+  host_expect(host_wrapper_hash_finish(&operation, hash, sizeof(hash), &hash_length) == PSA_SUCCESS, "finish status");
+  host_expect(host_wrapper_hash_finish(&clone, hash, sizeof(hash), &hash_length) == PSA_SUCCESS, "finish status of the clone");
+  host_expect(host_wrapper_hash_abort(&operation) == PSA_SUCCESS, "abort status");
+  host_expect(host_wrapper_hash_abort(&clone) == PSA_SUCCESS, "abort status of the clone");
+  host_expect_calls((const uint32_t (*)[HOST_ENTRY_COUNT])expected, "multipart");
+
+  printf(" %s\n", (driver == HOST_DRIVER_ACCEL) ? "accelerator" : "builtin");
+}
+
+/***************************************************************************//**
+ * Times one entry point through the wrappers and directly.
+ ******************************************************************************/
+static void host_benchmark_print(const char *name, host_entry_t entry, uint64_t wrapper_ns, uint64_t direct_ns, uint32_t count)
+{
+  printf("%-8s %-8s %10.2f %10.2f %10.2f\n",
+         name,
+         host_entry_names[entry],
+         (double)wrapper_ns / count,
+         (double)direct_ns / count,
+         ((double)wrapper_ns - (double)direct_ns) / count);
+}
+
+/***************************************************************************//**
+ * Times the hash entry points of one algorithm.
+ ******************************************************************************/
+static void host_benchmark(psa_algorithm_t alg, const char *name, uint32_t count)
+{
+  psa_hash_operation_t operation = PSA_HASH_OPERATION_INIT;
+  sli_cryptoacc_transparent_hash_operation_t accel_operation;
+  mbedtls_psa_hash_operation_t builtin_operation;
+  bool accelerated = host_is_accelerated(alg);
+  uint8_t input[64] = { 0 };
+  uint8_t hash[PSA_HASH_MAX_SIZE];
+  size_t hash_length;
+  uint64_t start_ns;
+  uint64_t wrapper_ns;
+  uint64_t direct_ns;
+
+  memset(&accel_operation, 0, sizeof(accel_operation));
+  memset(&builtin_operation, 0, sizeof(builtin_operation));
+
+  start_ns = host_time_ns();
+  for (uint32_t i = 0; i < count; i++) {
+    (void)host_wrapper_hash_compute(alg, input, sizeof(input), hash, sizeof(hash), &hash_length);
+  }
+  wrapper_ns = host_time_ns() - start_ns;
+  start_ns = host_time_ns();
+  for (uint32_t i = 0; i < count; i++) {
+    if (accelerated) {
+      (void)sli_cryptoacc_transparent_hash_compute(alg, input, sizeof(input), hash, sizeof(hash), &hash_length);
+    } else {
+      (void)mbedtls_psa_hash_compute(alg, input, sizeof(input), hash, sizeof(hash), &hash_length);
+    }
+  }
+  direct_ns = host_time_ns() - start_ns;
+  host_benchmark_print(name, HOST_ENTRY_COMPUTE, wrapper_ns, direct_ns, count);
+
+  start_ns = host_time_ns();
+  for (uint32_t i = 0; i < count; i++) {
+    (void)host_wrapper_hash_setup(&operation, alg);
+  }
+  wrapper_ns = host_time_ns() - start_ns;
+  start_ns = host_time_ns();
+  for (uint32_t i = 0; i < count; i++) {
+    if (accelerated) {
+      (void)sli_cryptoacc_transparent_hash_setup(&accel_operation, alg);
+    } else {
+      (void)mbedtls_psa_hash_setup(&builtin_operation, alg);
+    }
+  }
+  direct_ns = host_time_ns() - start_ns;
+  host_benchmark_print(name, HOST_ENTRY_SETUP, wrapper_ns, direct_ns, count);
+
+  start_ns = host_time_ns();
+  for (uint32_t i = 0; i < count; i++) {
+    (void)host_wrapper_hash_update(&operation, input, sizeof(input));
+  }
+  wrapper_ns = host_time_ns() - start_ns;
+  start_ns = host_time_ns();
+  for (uint32_t i = 0; i < count; i++) {
+    if (accelerated) {
+      (void)sli_cryptoacc_transparent_hash_update(&accel_operation, input, sizeof(input));
+    } else {
+      (void)mbedtls_psa_hash_update(&builtin_operation, input, sizeof(input));
+    }
+  }
+  direct_ns = host_time_ns() - start_ns;
+  host_benchmark_print(name, HOST_ENTRY_UPDATE, wrapper_ns, direct_ns, count);
+
+  start_ns = host_time_ns();
+  for (uint32_t i = 0; i < count; i++) {
+    (void)host_wrapper_hash_finish(&operation, hash, sizeof(hash), &hash_length);
+  }
+  wrapper_ns = host_time_ns() - start_ns;
+  start_ns = host_time_ns();
+  for (uint32_t i = 0; i < count; i++) {
+    if (accelerated) {
+      (void)sli_cryptoacc_transparent_hash_finish(&accel_operation, hash, sizeof(hash), &hash_length);
+    } else {
+      (void)mbedtls_psa_hash_finish(&builtin_operation, hash, sizeof(hash), &hash_length);
+    }
+  }
+  direct_ns = host_time_ns() - start_ns;
+  host_benchmark_print(name, HOST_ENTRY_FINISH, wrapper_ns, direct_ns, count);
+
+  (void)host_wrapper_hash_abort(&operation);
+  memset(host_calls, 0, sizeof(host_calls));
+}
+
+/*******************************************************************************
+ *******************************   DRIVER STUBS   ******************************
+ ******************************************************************************/
+
+__attribute__((noinline))
+psa_status_t sli_cryptoacc_transparent_hash_compute(psa_algorithm_t alg,
+                                                    const uint8_t *input,
+                                                    size_t input_length,
+                                                    uint8_t *hash,
+                                                    size_t hash_size,
+                                                    size_t *hash_length)
+{
+  (void)input;
+  (void)input_length;
+  (void)hash;
+  host_calls[HOST_DRIVER_ACCEL][HOST_ENTRY_COMPUTE]++;
+  if (!host_is_accelerated(alg)) {
+    return PSA_ERROR_NOT_SUPPORTED;
+  }
+  *hash_length = (PSA_HASH_LENGTH(alg) <= hash_size) ? PSA_HASH_LENGTH(alg) : 0u;
+  return PSA_SUCCESS;
+}
+
+__attribute__((noinline))
+psa_status_t sli_cryptoacc_transparent_hash_setup(sli_cryptoacc_transparent_hash_operation_t *operation,
+                                                  psa_algorithm_t alg)
+{
+  (void)operation;
+  host_calls[HOST_DRIVER_ACCEL][HOST_ENTRY_SETUP]++;
+  return host_is_accelerated(alg) ? PSA_SUCCESS : PSA_ERROR_NOT_SUPPORTED;
+}
+
+__attribute__((noinline))
+psa_status_t sli_cryptoacc_transparent_hash_clone(const sli_cryptoacc_transparent_hash_operation_t *source_operation,
+                                                  sli_cryptoacc_transparent_hash_operation_t *target_operation)
+{
+  (void)source_operation;
+  (void)target_operation;
+  host_calls[HOST_DRIVER_ACCEL][HOST_ENTRY_CLONE]++;
+  return PSA_SUCCESS;
+}
+
+__attribute__((noinline))
+psa_status_t sli_cryptoacc_transparent_hash_update(sli_cryptoacc_transparent_hash_operation_t *operation,
+                                                   const uint8_t *input,
+                                                   size_t input_length)
+{
+  (void)operation;
+  (void)input;
+  (void)input_length;
+  host_calls[HOST_DRIVER_ACCEL][HOST_ENTRY_UPDATE]++;
+  return PSA_SUCCESS;
+}
+
+__attribute__((noinline))
+psa_status_t sli_cryptoacc_transparent_hash_finish(sli_cryptoacc_transparent_hash_operation_t *operation,
+                                                   uint8_t *hash,
+                                                   size_t hash_size,
+                                                   size_t *hash_length)
+{
+  (void)operation;
+  (void)hash;
+  (void)hash_size;
+  *hash_length = 0u;
+  host_calls[HOST_DRIVER_ACCEL][HOST_ENTRY_FINISH]++;
+  return PSA_SUCCESS;
+}
+
+__attribute__((noinline))
+psa_status_t sli_cryptoacc_transparent_hash_abort(sli_cryptoacc_transparent_hash_operation_t *operation)
+{
+  (void)operation;
+  host_calls[HOST_DRIVER_ACCEL][HOST_ENTRY_ABORT]++;
+  return PSA_SUCCESS;
+}
+
+__attribute__((noinline))
+psa_status_t mbedtls_psa_hash_compute(psa_algorithm_t alg,
+                                      const uint8_t *input,
+                                      size_t input_length,
+                                      uint8_t *hash,
+                                      size_t hash_size,
+                                      size_t *hash_length)
+{
+  (void)input;
+  (void)input_length;
+  (void)hash;
+  host_calls[HOST_DRIVER_BUILTIN][HOST_ENTRY_COMPUTE]++;
+  if (!host_is_builtin(alg)) {
+    return PSA_ERROR_NOT_SUPPORTED;
+  }
+  *hash_length = (PSA_HASH_LENGTH(alg) <= hash_size) ? PSA_HASH_LENGTH(alg) : 0u;
+  return PSA_SUCCESS;
+}
+
+__attribute__((noinline))
+psa_status_t mbedtls_psa_hash_setup(mbedtls_psa_hash_operation_t *operation,
+                                    psa_algorithm_t alg)
+{
+  (void)operation;
+  host_calls[HOST_DRIVER_BUILTIN][HOST_ENTRY_SETUP]++;
+  return host_is_builtin(alg) ? PSA_SUCCESS : PSA_ERROR_NOT_SUPPORTED;
+}
+
+__attribute__((noinline))
+psa_status_t mbedtls_psa_hash_clone(const mbedtls_psa_hash_operation_t *source_operation,
+                                    mbedtls_psa_hash_operation_t *target_operation)
+{
+  (void)source_operation;
+  (void)target_operation;
+  host_calls[HOST_DRIVER_BUILTIN][HOST_ENTRY_CLONE]++;
+  return PSA_SUCCESS;
+}
+
+__attribute__((noinline))
+psa_status_t mbedtls_psa_hash_update(mbedtls_psa_hash_operation_t *operation,
+                                     const uint8_t *input,
+                                     size_t input_length)
+{
+  (void)operation;
+  (void)input;
+  (void)input_length;
+  host_calls[HOST_DRIVER_BUILTIN][HOST_ENTRY_UPDATE]++;
+  return PSA_SUCCESS;
+}
+
+__attribute__((noinline))
+psa_status_t mbedtls_psa_hash_finish(mbedtls_psa_hash_operation_t *operation,
+                                     uint8_t *hash,
+                                     size_t hash_size,
+                                     size_t *hash_length)
+{
+  (void)operation;
+  (void)hash;
+  (void)hash_size;
+  *hash_length = 0u;
+  host_calls[HOST_DRIVER_BUILTIN][HOST_ENTRY_FINISH]++;
+  return PSA_SUCCESS;
+}
+
+__attribute__((noinline))
+psa_status_t mbedtls_psa_hash_abort(mbedtls_psa_hash_operation_t *operation)
+{
+  (void)operation;
+  host_calls[HOST_DRIVER_BUILTIN][HOST_ENTRY_ABORT]++;
+  return PSA_SUCCESS;
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Runs the driver wrapper test and benchmark.
+ ******************************************************************************/
+int main(int argc, char *argv[])
+{
+  uint32_t count = HOST_CALLS_DEFAULT;
+  int option;
+
+  while ((option = getopt(argc, argv, "n:")) != -1) {
+    switch (option) {
+      case 'n':
+        count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      default:
+        fprintf(stderr, "usage: %s [-n calls]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+  }
+
+  printf("%s hash dispatch\n", HOST_DISPATCH);
+  host_check_algorithm(PSA_ALG_SHA_1, "SHA-1");
+  host_check_algorithm(PSA_ALG_SHA_224, "SHA-224");
+  host_check_algorithm(PSA_ALG_SHA_256, "SHA-256");
+  host_check_algorithm(PSA_ALG_SHA_384, "SHA-384");
+  host_check_algorithm(PSA_ALG_SHA_512, "SHA-512");
+  host_check_algorithm(PSA_ALG_MD5, "MD5");
+  printf("%" PRIu64 " dispatch checks ok\n", host_check_count);
+
+  if (count > 0) {
+    printf("\nns per call\n%-8s %-8s %10s %10s %10s\n", "hash", "entry", "wrapper", "direct", "dispatch");
+    host_benchmark(PSA_ALG_SHA_256, "SHA-256", count);
+    host_benchmark(PSA_ALG_SHA_512, "SHA-512", count);
+  }
+
+  return EXIT_SUCCESS;
+}
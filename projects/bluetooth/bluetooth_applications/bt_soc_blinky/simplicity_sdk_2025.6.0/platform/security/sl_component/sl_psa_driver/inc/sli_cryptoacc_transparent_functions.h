@@ -72,6 +72,17 @@ psa_status_t sli_cryptoacc_transparent_hash_update(sli_cryptoacc_transparent_has
                                                    const uint8_t *input,
                                                    size_t input_length);
 
+// Batched variant of sli_cryptoacc_transparent_hash_update(). Feeds
+// inputs[n] into operations[n] for every n, acquiring the accelerator once.
+// With SLI_PSA_SUPPORT_SHA256_MULTI_BUFFER, SHA-224/SHA-256 operations are
+// compressed in software lockstep instead. Each operation may appear only
+// once in a batch. On failure, the operations whose input was not fully
+// hashed keep their previous length.
+psa_status_t sli_cryptoacc_transparent_hash_update_multi(sli_cryptoacc_transparent_hash_operation_t *const operations[],
+                                                         const uint8_t *const inputs[],
+                                                         const size_t input_lengths[],
+                                                         size_t count);
+
 psa_status_t sli_cryptoacc_transparent_hash_finish(sli_cryptoacc_transparent_hash_operation_t *operation,
                                                    uint8_t *hash,
                                                    size_t hash_size,
@@ -40,10 +40,20 @@
   || defined(PSA_WANT_ALG_SHA_256)
 
 #include "cryptoacc_management.h"
+#include "sli_psa_driver_features.h"
 #include "sx_hash.h"
 #include "sx_errors.h"
+#include <stdbool.h>
 #include <string.h>
 
+#if defined(SLI_PSA_DRIVER_FEATURE_SHA256_MULTI_BUFFER)
+#include "sli_psa_sha256_mb.h"
+#endif
+
+// Number of operations handled per pass of a batched update. Bounds the
+// stack used for deferred tails and software lane jobs.
+#define SLI_CRYPTOACC_HASH_BATCH_SIZE 8u
+
 // Define all init vectors.
 #if defined(PSA_WANT_ALG_SHA_1)
 static const uint8_t init_state_sha1[32] = {
@@ -82,6 +92,24 @@ static const uint8_t init_state_sha256[32] = {
 };
 #endif // PSA_WANT_ALG_SHA_256
 
+static bool sli_cryptoacc_hash_is_active(sx_hash_fct_t hash_type)
+{
+  switch (hash_type) {
+#if defined(PSA_WANT_ALG_SHA_1)
+    case e_SHA1:
+#endif // PSA_WANT_ALG_SHA_1
+#if defined(PSA_WANT_ALG_SHA_224)
+    case e_SHA224:
+#endif // PSA_WANT_ALG_SHA_224
+#if defined(PSA_WANT_ALG_SHA_256)
+    case e_SHA256:
+#endif // PSA_WANT_ALG_SHA_256
+      return true;
+    default:
+      return false;
+  }
+}
+
 #endif // PSA_WANT_ALG_SHA_*
 
 psa_status_t sli_cryptoacc_transparent_hash_setup(sli_cryptoacc_transparent_hash_operation_t *operation,
@@ -245,6 +273,168 @@ psa_status_t sli_cryptoacc_transparent_hash_update(sli_cryptoacc_transparent_has
 #endif // PSA_WANT_ALG_SHA_*
 }
 
+psa_status_t sli_cryptoacc_transparent_hash_update_multi(sli_cryptoacc_transparent_hash_operation_t *const operations[],
+                                                         const uint8_t *const inputs[],
+                                                         const size_t input_lengths[],
+                                                         size_t count)
+{
+#if defined(PSA_WANT_ALG_SHA_1)    \
+  || defined(PSA_WANT_ALG_SHA_224) \
+  || defined(PSA_WANT_ALG_SHA_256)
+
+  sli_cryptoacc_transparent_hash_operation_t *operation;
+  const uint8_t *input;
+  const uint8_t *head;
+  size_t first, batch, n, i, done;
+  size_t left, fill, length, blocks;
+  size_t tail[SLI_CRYPTOACC_HASH_BATCH_SIZE];
+  block_t state;
+  block_t data_in;
+  uint32_t sx_ret = CRYPTOLIB_SUCCESS;
+  psa_status_t status;
+#if defined(SLI_PSA_DRIVER_FEATURE_SHA256_MULTI_BUFFER)
+  sli_sha256_mb_job_t jobs[SLI_CRYPTOACC_HASH_BATCH_SIZE];
+  size_t job_count;
+#endif
+
+  if (count > 0
+      && (operations == NULL || inputs == NULL || input_lengths == NULL)) {
+    return PSA_ERROR_INVALID_ARGUMENT;
+  }
+
+  // Validate the whole batch up front so that a bad entry leaves every
+  // operation untouched.
+  for (n = 0; n < count; n++) {
+    if (operations[n] == NULL
+        || (inputs[n] == NULL && input_lengths[n] > 0)) {
+      return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    if (!sli_cryptoacc_hash_is_active(operations[n]->hash_type)) {
+      // State must have not been initialized by the setup function.
+      return PSA_ERROR_BAD_STATE;
+    }
+    // The tail of an operation is only stored once its batch is hashed, so
+    // a second input for the same operation would hash from a stale buffer.
+    for (i = 0; i < n; i++) {
+      if (operations[i] == operations[n]) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+      }
+    }
+  }
+
+  if (count == 0) {
+    return PSA_SUCCESS;
+  }
+
+  // The accelerator is acquired once for the whole batch rather than once
+  // per operation and block run.
+  status = cryptoacc_management_acquire();
+  if (status != PSA_SUCCESS) {
+    return status;
+  }
+
+  for (first = 0; first < count && sx_ret == CRYPTOLIB_SUCCESS; first += batch) {
+    batch = count - first;
+    if (batch > SLI_CRYPTOACC_HASH_BATCH_SIZE) {
+      batch = SLI_CRYPTOACC_HASH_BATCH_SIZE;
+    }
+#if defined(SLI_PSA_DRIVER_FEATURE_SHA256_MULTI_BUFFER)
+    job_count = 0;
+#endif
+
+    for (n = 0; n < batch && sx_ret == CRYPTOLIB_SUCCESS; n++) {
+      operation = operations[first + n];
+      input = inputs[first + n];
+      length = input_lengths[first + n];
+      tail[n] = 0;
+
+      // Same blocksize for all of SHA-256, SHA-224, and SHA-256.
+      left = (operation->total & (SHA256_BLOCKSIZE - 1));
+      fill = SHA256_BLOCKSIZE - left;
+
+      if (length < fill) {
+        if (length > 0) {
+          memcpy((void *)(operation->buffer + left), input, length);
+        }
+        continue;
+      }
+
+      head = NULL;
+      if (left > 0) {
+        memcpy((void *)(operation->buffer + left), input, fill);
+        head = operation->buffer;
+        input += fill;
+        length -= fill;
+      }
+
+      blocks = length / SHA256_BLOCKSIZE;
+
+      // The buffer may still be referenced as the head block, so the tail is
+      // only copied in once the whole pass has been hashed.
+      tail[n] = length - (SHA256_BLOCKSIZE * blocks);
+
+#if defined(SLI_PSA_DRIVER_FEATURE_SHA256_MULTI_BUFFER)
+      if (operation->hash_type != e_SHA1) {
+        jobs[job_count].state = operation->state;
+        jobs[job_count].head = head;
+        jobs[job_count].data = input;
+        jobs[job_count].blocks = blocks;
+        job_count++;
+        continue;
+      }
+#endif // SLI_PSA_DRIVER_FEATURE_SHA256_MULTI_BUFFER
+
+      state = block_t_convert((uint8_t*)operation->state,
+                              sx_hash_get_state_size(operation->hash_type));
+
+      if (head != NULL) {
+        data_in = block_t_convert(head, SHA256_BLOCKSIZE);
+        sx_ret = sx_hash_update_blk(operation->hash_type, state, data_in);
+      }
+
+      if (blocks > 0 && sx_ret == CRYPTOLIB_SUCCESS) {
+        data_in = block_t_convert((uint8_t*)input, SHA256_BLOCKSIZE * blocks);
+        sx_ret = sx_hash_update_blk(operation->hash_type, state, data_in);
+      }
+    }
+
+#if defined(SLI_PSA_DRIVER_FEATURE_SHA256_MULTI_BUFFER)
+    sli_sha256_mb_process(jobs, job_count);
+#endif
+
+    // The length of an operation only advances once its input is hashed,
+    // so the operation that failed keeps its previous length.
+    done = (sx_ret == CRYPTOLIB_SUCCESS) ? n : n - 1;
+    for (i = 0; i < done; i++) {
+      operations[first + i]->total += input_lengths[first + i];
+      if (tail[i] > 0) {
+        memcpy((void *)operations[first + i]->buffer,
+               inputs[first + i] + (input_lengths[first + i] - tail[i]),
+               tail[i]);
+      }
+    }
+  }
+
+  status = cryptoacc_management_release();
+  if (sx_ret != CRYPTOLIB_SUCCESS
+      || status != PSA_SUCCESS) {
+    return PSA_ERROR_HARDWARE_FAILURE;
+  }
+
+  return PSA_SUCCESS;
+
+#else // PSA_WANT_ALG_SHA_*
+
+  (void)operations;
+  (void)inputs;
+  (void)input_lengths;
+  (void)count;
+
+  return PSA_ERROR_NOT_SUPPORTED;
+
+#endif // PSA_WANT_ALG_SHA_*
+}
+
 psa_status_t sli_cryptoacc_transparent_hash_finish(sli_cryptoacc_transparent_hash_operation_t *operation,
                                                    uint8_t *hash,
                                                    size_t hash_size,
@@ -0,0 +1,220 @@
+/***************************************************************************//**
+ * @file
+ * @brief Multi-buffer software SHA-256 block engine.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sli_psa_sha256_mb.h"
+
+#include <string.h>
+
+// -----------------------------------------------------------------------------
+// Local macros
+
+// Each SHA-256 working variable holds the same word for every lane. With GCC
+// vector extensions the compiler lowers the arithmetic to SSE/AVX2 on x86 and
+// NEON on Arm application cores; other targets get one scalar lane.
+#if (SLI_SHA256_MB_LANES > 1u)
+typedef uint32_t sha256_mb_vec_t __attribute__((vector_size(SLI_SHA256_MB_LANES * sizeof(uint32_t))));
+  #define SHA256_MB_LANE(v, lane)  ((v)[(lane)])
+#else
+typedef uint32_t sha256_mb_vec_t;
+  #define SHA256_MB_LANE(v, lane)  (v)
+#endif
+
+#define SHA256_MB_ROTR(x, n)  (((x) >> (n)) | ((x) << (32u - (n))))
+
+#define SHA256_MB_CH(x, y, z)   ((z) ^ ((x) & ((y) ^ (z))))
+#define SHA256_MB_MAJ(x, y, z)  (((x) & (y)) | ((z) & ((x) | (y))))
+
+#define SHA256_MB_S0(x)  (SHA256_MB_ROTR(x, 2u) ^ SHA256_MB_ROTR(x, 13u) ^ SHA256_MB_ROTR(x, 22u))
+#define SHA256_MB_S1(x)  (SHA256_MB_ROTR(x, 6u) ^ SHA256_MB_ROTR(x, 11u) ^ SHA256_MB_ROTR(x, 25u))
+#define SHA256_MB_s0(x)  (SHA256_MB_ROTR(x, 7u) ^ SHA256_MB_ROTR(x, 18u) ^ ((x) >> 3u))
+#define SHA256_MB_s1(x)  (SHA256_MB_ROTR(x, 17u) ^ SHA256_MB_ROTR(x, 19u) ^ ((x) >> 10u))
+
+// -----------------------------------------------------------------------------
+// Local variables
+
+static const uint32_t sha256_mb_k[64] = {
+  0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5,
+  0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+  0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
+  0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+  0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC,
+  0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+  0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7,
+  0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+  0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
+  0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+  0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3,
+  0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+  0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5,
+  0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+  0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
+  0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+// Fed to idle lanes so that every lane always reads a valid block.
+static const uint8_t sha256_mb_idle_block[SLI_SHA256_MB_BLOCK_SIZE] = { 0 };
+
+// -----------------------------------------------------------------------------
+// Static functions
+
+static inline uint32_t sha256_mb_load_be32(const uint8_t *p)
+{
+  return ((uint32_t)p[0] << 24)
+         | ((uint32_t)p[1] << 16)
+         | ((uint32_t)p[2] << 8)
+         | (uint32_t)p[3];
+}
+
+static inline void sha256_mb_store_be32(uint8_t *p, uint32_t v)
+{
+  p[0] = (uint8_t)(v >> 24);
+  p[1] = (uint8_t)(v >> 16);
+  p[2] = (uint8_t)(v >> 8);
+  p[3] = (uint8_t)v;
+}
+
+// Compress one block per lane into the lane-interleaved state.
+static void sha256_mb_compress(sha256_mb_vec_t state[8],
+                               const uint8_t *const block[SLI_SHA256_MB_LANES])
+{
+  sha256_mb_vec_t w[16];
+  sha256_mb_vec_t a = state[0];
+  sha256_mb_vec_t b = state[1];
+  sha256_mb_vec_t c = state[2];
+  sha256_mb_vec_t d = state[3];
+  sha256_mb_vec_t e = state[4];
+  sha256_mb_vec_t f = state[5];
+  sha256_mb_vec_t g = state[6];
+  sha256_mb_vec_t h = state[7];
+  sha256_mb_vec_t t1, t2;
+  size_t i, lane;
+
+  for (i = 0; i < 64u; i++) {
+    if (i < 16u) {
+      for (lane = 0; lane < SLI_SHA256_MB_LANES; lane++) {
+        SHA256_MB_LANE(w[i], lane) = sha256_mb_load_be32(block[lane] + (4u * i));
+      }
+    } else {
+      w[i & 15u] += SHA256_MB_s1(w[(i - 2u) & 15u])
+                    + w[(i - 7u) & 15u]
+                    + SHA256_MB_s0(w[(i - 15u) & 15u]);
+    }
+
+    t1 = h + SHA256_MB_S1(e) + SHA256_MB_CH(e, f, g) + sha256_mb_k[i] + w[i & 15u];
+    t2 = SHA256_MB_S0(a) + SHA256_MB_MAJ(a, b, c);
+    h = g;
+    g = f;
+    f = e;
+    e = d + t1;
+    d = c;
+    c = b;
+    b = a;
+    a = t1 + t2;
+  }
+
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+  state[4] += e;
+  state[5] += f;
+  state[6] += g;
+  state[7] += h;
+}
+
+// -----------------------------------------------------------------------------
+// Global functions
+
+void sli_sha256_mb_process(sli_sha256_mb_job_t *jobs, size_t job_count)
+{
+  sha256_mb_vec_t state[8];
+  sli_sha256_mb_job_t *lane_job[SLI_SHA256_MB_LANES];
+  const uint8_t *lane_head[SLI_SHA256_MB_LANES];
+  const uint8_t *lane_data[SLI_SHA256_MB_LANES];
+  size_t lane_blocks[SLI_SHA256_MB_LANES];
+  const uint8_t *block[SLI_SHA256_MB_LANES];
+  size_t next_job = 0;
+  size_t active;
+  size_t lane, i;
+
+  memset(state, 0, sizeof(state));
+  memset(lane_job, 0, sizeof(lane_job));
+
+  for (;;) {
+    active = 0;
+
+    for (lane = 0; lane < SLI_SHA256_MB_LANES; lane++) {
+      // Retire exhausted streams and pull in pending ones.
+      while (lane_job[lane] == NULL
+             || (lane_head[lane] == NULL && lane_blocks[lane] == 0)) {
+        if (lane_job[lane] != NULL) {
+          for (i = 0; i < 8u; i++) {
+            sha256_mb_store_be32(lane_job[lane]->state + (4u * i),
+                                 SHA256_MB_LANE(state[i], lane));
+          }
+          lane_job[lane] = NULL;
+        }
+
+        if (next_job >= job_count) {
+          break;
+        }
+
+        lane_job[lane] = &jobs[next_job++];
+        lane_head[lane] = lane_job[lane]->head;
+        lane_data[lane] = lane_job[lane]->data;
+        lane_blocks[lane] = (lane_data[lane] != NULL) ? lane_job[lane]->blocks : 0;
+        for (i = 0; i < 8u; i++) {
+          SHA256_MB_LANE(state[i], lane) = sha256_mb_load_be32(lane_job[lane]->state + (4u * i));
+        }
+      }
+
+      if (lane_job[lane] == NULL) {
+        block[lane] = sha256_mb_idle_block;
+        continue;
+      }
+
+      if (lane_head[lane] != NULL) {
+        block[lane] = lane_head[lane];
+        lane_head[lane] = NULL;
+      } else {
+        block[lane] = lane_data[lane];
+        lane_data[lane] += SLI_SHA256_MB_BLOCK_SIZE;
+        lane_blocks[lane]--;
+      }
+      active++;
+    }
+
+    if (active == 0) {
+      break;
+    }
+
+    sha256_mb_compress(state, block);
+  }
+}
@@ -0,0 +1,43 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the CORE critical section API
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_CORE_H
+#define SL_CORE_H
+
+// The host tools have no interrupts, so atomic and critical sections do
+// nothing. Only the pool stress test runs several threads, on the lock-free
+// pool paths, which do not use them.
+#define CORE_DECLARE_IRQ_STATE  int irqState __attribute__((unused)) = 0
+#define CORE_ENTER_ATOMIC()     (void)irqState
+#define CORE_EXIT_ATOMIC()      (void)irqState
+#define CORE_ENTER_CRITICAL()   (void)irqState
+#define CORE_EXIT_CRITICAL()    (void)irqState
+
+#endif // SL_CORE_H
@@ -0,0 +1,388 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the Memory Manager incremental heap integrity check
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Checks the incremental heap integrity check with the memory profiler hooks.
+ *
+ * The memory profiler is replaced by a mock that records the ownership taken
+ * on each block and the log events. Blocks are allocated through the different
+ * allocation functions, then the metadata of each block is corrupted in turn.
+ * The log event of the corrupted block must report the return address that
+ * the memory profiler attributes the block to, not the one of the checker.
+ * The restart of a check handle when the heap changes or when another handle
+ * ran a step is also checked.
+ *
+ * Usage: sl_memory_manager_host_integrity
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sl_memory_manager.h"
+#include "sl_memory_manager_region.h"
+#include "sli_memory_manager.h"
+#include "sli_memory_profiler.h"
+
+#if !defined(SLI_MEMORY_MANAGER_HEAP_CHECK_OWNERS)
+#error "The integrity test requires the memory profiler hooks and SL_MEMORY_MANAGER_HEAP_CHECK_OWNER_COUNT."
+#endif
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+#define HOST_HEAP_SIZE         16384u
+#define HOST_OWNER_COUNT       64u
+#define HOST_BLOCK_COUNT       6u
+
+/*******************************************************************************
+ ********************************   DATA TYPES   *******************************
+ ******************************************************************************/
+
+// Last ownership taken on a block, as seen by the memory profiler.
+typedef struct {
+  const void *block;
+  void *pc;
+} host_owner_t;
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+static uint8_t *host_heap;
+static host_owner_t host_owners[HOST_OWNER_COUNT];
+static size_t host_check_count;
+
+// Last log event.
+static uint32_t host_log_count;
+static uint32_t host_log_id;
+static uint32_t host_log_block;
+static void *host_log_pc;
+
+/*******************************************************************************
+ ***************************  GLOBAL VARIABLES   *******************************
+ ******************************************************************************/
+
+// Physical RAM tracked by the memory profiler, see em_device.h.
+uintptr_t host_sram_base;
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Reports an error and exits.
+ ******************************************************************************/
+static void host_fail(const char *what)
+{
+  fprintf(stderr, "FAIL: %s\n", what);
+  exit(EXIT_FAILURE);
+}
+
+/***************************************************************************//**
+ * Checks a condition.
+ ******************************************************************************/
+static void host_expect(bool condition, const char *what)
+{
+  if (!condition) {
+    host_fail(what);
+  }
+  host_check_count++;
+}
+
+/***************************************************************************//**
+ * Gets the last ownership taken on a block.
+ ******************************************************************************/
+static void *host_owner_get(const void *block)
+{
+  for (uint32_t index = 0; index < HOST_OWNER_COUNT; index++) {
+    if (host_owners[index].block == block) {
+      return host_owners[index].pc;
+    }
+  }
+  return NULL;
+}
+
+/***************************************************************************//**
+ * Allocates the blocks through each allocation function.
+ ******************************************************************************/
+static void host_allocate(void *blocks[HOST_BLOCK_COUNT])
+{
+  void *moved;
+  void *guard;
+
+  blocks[0] = sl_malloc(40u);
+  host_expect(sl_memory_alloc(72u, BLOCK_TYPE_LONG_TERM, &blocks[1]) == SL_STATUS_OK, "sl_memory_alloc");
+  host_expect(sl_memory_alloc(24u, BLOCK_TYPE_SHORT_TERM, &blocks[2]) == SL_STATUS_OK, "short-term sl_memory_alloc");
+  blocks[3] = sl_calloc(4u, 12u);
+  host_expect(sl_memory_alloc_advanced(48u, SL_MEMORY_BLOCK_ALIGN_64_BYTES, BLOCK_TYPE_LONG_TERM, &blocks[4]) == SL_STATUS_OK,
+              "sl_memory_alloc_advanced");
+
+  // A long-term neighbour prevents growing the block in place, so that it moves.
+  moved = sl_malloc(16u);
+  guard = sl_malloc(8u);
+  blocks[5] = sl_realloc(moved, 512u);
+  host_expect((blocks[5] != moved) && (guard != NULL), "block moved");
+
+  for (uint32_t index = 0; index < HOST_BLOCK_COUNT; index++) {
+    host_expect(blocks[index] != NULL, "allocation");
+    host_expect(host_owner_get(blocks[index]) != NULL, "ownership tracked");
+  }
+}
+
+/***************************************************************************//**
+ * Corrupts the metadata of each block in turn and checks the log event.
+ ******************************************************************************/
+static void host_check_corruption(void *blocks[HOST_BLOCK_COUNT])
+{
+  for (uint32_t index = 0; index < HOST_BLOCK_COUNT; index++) {
+    sli_block_metadata_t *metadata = (sli_block_metadata_t *)((uint8_t *)blocks[index] - SLI_BLOCK_METADATA_SIZE_BYTE);
+    sli_block_metadata_t saved = *metadata;
+    sl_memory_heap_check_t check_handle = { 0 };
+    uint32_t log_count = host_log_count;
+    void *corrupted = NULL;
+
+    metadata->length = 0;
+    metadata->length_msb = 0;
+    host_expect(sl_memory_heap_check_integrity_step(&sli_general_purpose_heap, &check_handle, SIZE_MAX, &corrupted) == SL_STATUS_FAIL,
+                "corruption found");
+    *metadata = saved;
+
+    host_expect(corrupted == blocks[index], "corrupted block");
+    host_expect(host_log_count == (log_count + 1u), "one log event");
+    host_expect(host_log_id == SLI_MEMORY_MANAGER_LOG_ID_HEAP_CORRUPTED, "log identifier");
+    host_expect(host_log_block == (uint32_t)(uintptr_t)blocks[index], "logged block");
+    host_expect(host_log_pc == host_owner_get(blocks[index]), "logged owner");
+  }
+}
+
+/***************************************************************************//**
+ * Checks the restart of the check handles.
+ ******************************************************************************/
+static void host_check_restart(void)
+{
+  sli_block_metadata_t *first = sli_memory_get_first_block(&sli_general_purpose_heap);
+  sli_block_metadata_t *second = (sli_block_metadata_t *)((uint64_t *)first + sli_block_offset_next_dword_decode(first));
+  sl_memory_heap_check_t check_a = { 0 };
+  sl_memory_heap_check_t check_b = { 0 };
+  void *block;
+
+  host_expect(sl_memory_heap_check_integrity_step(&sli_general_purpose_heap, &check_a, 1u, NULL) == SL_STATUS_OK, "step");
+  host_expect(check_a.cursor == second, "cursor after one block");
+  host_expect(sl_memory_heap_check_integrity_step(&sli_general_purpose_heap, &check_a, 1u, NULL) == SL_STATUS_OK, "step");
+  host_expect(check_a.cursor != second, "cursor resumed");
+
+  // Another handle ran a step.
+  host_expect(sl_memory_heap_check_integrity_step(&sli_general_purpose_heap, &check_b, 1u, NULL) == SL_STATUS_OK, "step");
+  host_expect(sl_memory_heap_check_integrity_step(&sli_general_purpose_heap, &check_a, 1u, NULL) == SL_STATUS_OK, "step");
+  host_expect(check_a.cursor == second, "restart after another handle");
+
+  // The heap changed.
+  block = sl_malloc(8u);
+  host_expect(sl_memory_heap_check_integrity_step(&sli_general_purpose_heap, &check_a, 1u, NULL) == SL_STATUS_OK, "step");
+  host_expect(check_a.cursor == second, "restart after an allocation");
+  sl_free(block);
+
+  // Complete passes.
+  host_expect(sl_memory_heap_check_integrity_step(&sli_general_purpose_heap, &check_a, SIZE_MAX, NULL) == SL_STATUS_OK, "pass");
+  host_expect((check_a.pass_count == 1u) && (check_a.cursor == NULL), "pass count");
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Gets size and location of the heap.
+ ******************************************************************************/
+sl_memory_region_t sl_memory_get_heap_region(void)
+{
+  sl_memory_region_t region;
+
+  region.addr = host_heap;
+  region.size = HOST_HEAP_SIZE;
+  return region;
+}
+
+/***************************************************************************//**
+ * Gets size and location of the stack, only tracked by the memory profiler.
+ ******************************************************************************/
+sl_memory_region_t sl_memory_get_stack_region(void)
+{
+  sl_memory_region_t region;
+
+  region.addr = NULL;
+  region.size = 0;
+  return region;
+}
+
+/***************************************************************************//**
+ * Memory profiler mock: trackers are not checked.
+ ******************************************************************************/
+sl_status_t sli_memory_profiler_create_tracker(sli_memory_tracker_handle_t tracker_handle,
+                                               const char *description)
+{
+  (void)tracker_handle;
+  (void)description;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sli_memory_profiler_create_pool_tracker(sli_memory_tracker_handle_t tracker_handle,
+                                                    const char *description,
+                                                    void *ptr,
+                                                    size_t size)
+{
+  (void)tracker_handle;
+  (void)description;
+  (void)ptr;
+  (void)size;
+  return SL_STATUS_OK;
+}
+
+void sli_memory_profiler_delete_tracker(sli_memory_tracker_handle_t tracker_handle)
+{
+  (void)tracker_handle;
+}
+
+void sli_memory_profiler_track_alloc(sli_memory_tracker_handle_t tracker_handle,
+                                     void *ptr,
+                                     size_t size)
+{
+  (void)tracker_handle;
+  (void)ptr;
+  (void)size;
+}
+
+void sli_memory_profiler_track_realloc(sli_memory_tracker_handle_t tracker_handle,
+                                       void *ptr,
+                                       void *realloced_ptr,
+                                       size_t size)
+{
+  (void)tracker_handle;
+  (void)ptr;
+  (void)realloced_ptr;
+  (void)size;
+}
+
+void sli_memory_profiler_track_free(sli_memory_tracker_handle_t tracker_handle,
+                                    void *ptr)
+{
+  (void)tracker_handle;
+  (void)ptr;
+}
+
+void sli_memory_profiler_take_snapshot(const char *name)
+{
+  (void)name;
+}
+
+/***************************************************************************//**
+ * Memory profiler mock: the allocation is the first ownership of a block.
+ ******************************************************************************/
+void sli_memory_profiler_track_alloc_with_ownership(sli_memory_tracker_handle_t tracker_handle,
+                                                    void *ptr,
+                                                    size_t size,
+                                                    void *pc)
+{
+  (void)tracker_handle;
+  (void)size;
+  sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, ptr, pc);
+}
+
+/***************************************************************************//**
+ * Memory profiler mock: records the last ownership taken on a block.
+ ******************************************************************************/
+void sli_memory_profiler_track_ownership(sli_memory_tracker_handle_t tracker_handle,
+                                         void *ptr,
+                                         void *pc)
+{
+  host_owner_t *free_owner = NULL;
+
+  (void)tracker_handle;
+  if (ptr == NULL) {
+    return;
+  }
+  for (uint32_t index = 0; index < HOST_OWNER_COUNT; index++) {
+    if (host_owners[index].block == ptr) {
+      host_owners[index].pc = pc;
+      return;
+    }
+    if ((free_owner == NULL) && (host_owners[index].block == NULL)) {
+      free_owner = &host_owners[index];
+    }
+  }
+  if (free_owner == NULL) {
+    host_fail("out of owner slots");
+  }
+  free_owner->block = ptr;
+  free_owner->pc = pc;
+}
+
+/***************************************************************************//**
+ * Memory profiler mock: records the log event.
+ ******************************************************************************/
+void sli_memory_profiler_log(uint32_t log_id,
+                             uint32_t arg1,
+                             uint32_t arg2,
+                             uint32_t arg3,
+                             void *pc)
+{
+  (void)arg2;
+  (void)arg3;
+  host_log_count++;
+  host_log_id = log_id;
+  host_log_block = arg1;
+  host_log_pc = pc;
+}
+
+/***************************************************************************//**
+ * Runs the integrity test.
+ ******************************************************************************/
+int main(void)
+{
+  void *blocks[HOST_BLOCK_COUNT];
+
+  host_heap = aligned_alloc(SLI_WORD_SIZE_64, HOST_HEAP_SIZE);
+  if (host_heap == NULL) {
+    fprintf(stderr, "cannot allocate the heap\n");
+    return EXIT_FAILURE;
+  }
+
+  sl_memory_init();
+  host_allocate(blocks);
+  host_check_corruption(blocks);
+  host_check_restart();
+
+  printf("%zu integrity checks ok\n", host_check_count);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,335 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stress test of the Memory Manager lock-free memory pools
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Runs several threads that allocate and free blocks of one lock-free memory
+ * pool concurrently, as interrupts of different priorities would on the
+ * device. Each thread first takes as many blocks as it may hold and waits for
+ * the other threads, so that the pool runs empty even when the threads do not
+ * overlap, e.g. on a single CPU. It then holds a random number of blocks, and
+ * fills each block it owns with its own pattern, free list link included. The test checks that a block is never owned by two threads at a
+ * time, that the content of an owned block is not changed by another thread,
+ * and that all the blocks are back in the pool at the end.
+ *
+ * Only the lock-free paths run concurrently: the pool is created before the
+ * threads start and its free block count is read after they end.
+ *
+ * Usage: sl_memory_manager_host_pool [-t threads] [-n iterations] [-c blocks]
+ ******************************************************************************/
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sl_memory_manager.h"
+#include "sl_memory_manager_region.h"
+
+#if !defined(SL_MEMORY_MANAGER_LOCK_FREE_POOLS_ENABLE) || (SL_MEMORY_MANAGER_LOCK_FREE_POOLS_ENABLE != 1)
+#error "The pool stress test requires SL_MEMORY_MANAGER_LOCK_FREE_POOLS_ENABLE."
+#endif
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+#define HOST_HEAP_SIZE                  65536u
+#define HOST_BLOCK_SIZE                 24u
+#define HOST_THREAD_COUNT_MAX           16u
+#define HOST_THREAD_COUNT_DEFAULT       4u
+#define HOST_ITERATION_COUNT_DEFAULT    200000u
+#define HOST_BLOCK_COUNT_DEFAULT        32u
+#define HOST_HELD_COUNT_MAX             16u
+
+/*******************************************************************************
+ ********************************   DATA TYPES   *******************************
+ ******************************************************************************/
+
+typedef struct {
+  pthread_t thread;
+  uint32_t id;
+  uint32_t seed;
+  uint64_t alloc_count;
+  uint64_t empty_count;
+} host_thread_t;
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+static uint8_t *host_heap;
+static sl_memory_pool_t host_pool;
+static uint32_t host_iteration_count = HOST_ITERATION_COUNT_DEFAULT;
+static uint32_t host_thread_count = HOST_THREAD_COUNT_DEFAULT;
+static host_thread_t host_threads[HOST_THREAD_COUNT_MAX];
+
+// Owner of each block, 0 when the block is in the pool.
+static _Atomic uint32_t *host_owners;
+
+static atomic_bool host_start;
+
+// Number of threads done with their first allocations.
+static atomic_uint host_filled_count;
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Reports an error and exits.
+ ******************************************************************************/
+static void host_fail(const host_thread_t *thread, const char *what, const void *block)
+{
+  fprintf(stderr, "FAIL in thread %u: %s, block %p\n",
+          (unsigned)thread->id, what, block);
+  exit(EXIT_FAILURE);
+}
+
+/***************************************************************************//**
+ * Returns a monotonic timestamp in nanoseconds.
+ ******************************************************************************/
+static uint64_t host_time_ns(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/***************************************************************************//**
+ * Gets the index of a pool block.
+ ******************************************************************************/
+static size_t host_block_index(const void *block)
+{
+  return (size_t)((const uint8_t *)block - (const uint8_t *)host_pool.block_address) / host_pool.block_size;
+}
+
+/***************************************************************************//**
+ * Allocates a block and takes its ownership.
+ ******************************************************************************/
+static void *host_alloc(host_thread_t *thread)
+{
+  void *block;
+  uint32_t expected = 0;
+  sl_status_t status = sl_memory_pool_alloc(&host_pool, &block);
+
+  if (status == SL_STATUS_EMPTY) {
+    thread->empty_count++;
+    return NULL;
+  }
+  if ((status != SL_STATUS_OK) || (block == NULL)) {
+    host_fail(thread, "allocation", block);
+  }
+  if ((((uint8_t *)block - (uint8_t *)host_pool.block_address) % host_pool.block_size) != 0) {
+    host_fail(thread, "block not aligned on a pool block", block);
+  }
+  if (!atomic_compare_exchange_strong(&host_owners[host_block_index(block)], &expected, thread->id)) {
+    host_fail(thread, "block already owned", block);
+  }
+
+  memset(block, (int)thread->id, host_pool.block_size);
+  thread->alloc_count++;
+  return block;
+}
+
+/***************************************************************************//**
+ * Checks the content of a block, gives up its ownership and frees it.
+ ******************************************************************************/
+static void host_free(host_thread_t *thread, void *block)
+{
+  const uint8_t *byte = (const uint8_t *)block;
+
+  for (size_t offset = 0; offset < host_pool.block_size; offset++) {
+    if (byte[offset] != (uint8_t)thread->id) {
+      host_fail(thread, "block content changed", block);
+    }
+  }
+  atomic_store(&host_owners[host_block_index(block)], 0u);
+  if (sl_memory_pool_free(&host_pool, block) != SL_STATUS_OK) {
+    host_fail(thread, "free", block);
+  }
+}
+
+/***************************************************************************//**
+ * Runs the workload of a thread.
+ ******************************************************************************/
+static void *host_thread_run(void *arg)
+{
+  host_thread_t *thread = (host_thread_t *)arg;
+  void *held[HOST_HELD_COUNT_MAX];
+  uint32_t held_count = 0;
+
+  while (!atomic_load(&host_start)) {
+  }
+
+  while (held_count < HOST_HELD_COUNT_MAX) {
+    void *block = host_alloc(thread);
+
+    if (block == NULL) {
+      break;
+    }
+    held[held_count++] = block;
+  }
+  atomic_fetch_add(&host_filled_count, 1u);
+  while (atomic_load(&host_filled_count) < host_thread_count) {
+    sched_yield();
+  }
+
+  for (uint32_t iteration = 0; iteration < host_iteration_count; iteration++) {
+    uint32_t random = (uint32_t)rand_r(&thread->seed);
+
+    if ((held_count < HOST_HELD_COUNT_MAX) && ((held_count == 0) || ((random & 1u) != 0))) {
+      void *block = host_alloc(thread);
+
+      if (block != NULL) {
+        held[held_count++] = block;
+      }
+    } else {
+      uint32_t index = (random >> 1) % held_count;
+
+      host_free(thread, held[index]);
+      held[index] = held[--held_count];
+    }
+  }
+
+  while (held_count > 0) {
+    host_free(thread, held[--held_count]);
+  }
+
+  return NULL;
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Gets size and location of the heap.
+ ******************************************************************************/
+sl_memory_region_t sl_memory_get_heap_region(void)
+{
+  sl_memory_region_t region;
+
+  region.addr = host_heap;
+  region.size = HOST_HEAP_SIZE;
+  return region;
+}
+
+/***************************************************************************//**
+ * Runs the pool stress test.
+ ******************************************************************************/
+int main(int argc, char *argv[])
+{
+  uint32_t block_count = HOST_BLOCK_COUNT_DEFAULT;
+  uint64_t alloc_count = 0;
+  uint64_t empty_count = 0;
+  uint64_t start_ns;
+  uint64_t elapsed_ns;
+  int option;
+
+  while ((option = getopt(argc, argv, "t:n:c:")) != -1) {
+    switch (option) {
+      case 't':
+        host_thread_count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'n':
+        host_iteration_count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'c':
+        block_count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      default:
+        fprintf(stderr, "usage: %s [-t threads] [-n iterations] [-c blocks]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+  }
+  if ((host_thread_count == 0) || (host_thread_count > HOST_THREAD_COUNT_MAX) || (block_count == 0)) {
+    fprintf(stderr, "invalid thread or block count\n");
+    return EXIT_FAILURE;
+  }
+
+  host_heap = aligned_alloc(8u, HOST_HEAP_SIZE);
+  host_owners = calloc(block_count, sizeof(*host_owners));
+  if ((host_heap == NULL) || (host_owners == NULL)) {
+    fprintf(stderr, "cannot allocate the heap\n");
+    return EXIT_FAILURE;
+  }
+
+  sl_memory_init();
+  if (sl_memory_create_pool(HOST_BLOCK_SIZE, block_count, &host_pool) != SL_STATUS_OK) {
+    fprintf(stderr, "cannot create the pool\n");
+    return EXIT_FAILURE;
+  }
+
+  for (uint32_t index = 0; index < host_thread_count; index++) {
+    host_threads[index].id = index + 1u;
+    host_threads[index].seed = index + 1u;
+    if (pthread_create(&host_threads[index].thread, NULL, host_thread_run, &host_threads[index]) != 0) {
+      fprintf(stderr, "cannot create thread %u\n", (unsigned)index);
+      return EXIT_FAILURE;
+    }
+  }
+
+  start_ns = host_time_ns();
+  atomic_store(&host_start, true);
+  for (uint32_t index = 0; index < host_thread_count; index++) {
+    pthread_join(host_threads[index].thread, NULL);
+    alloc_count += host_threads[index].alloc_count;
+    empty_count += host_threads[index].empty_count;
+  }
+  elapsed_ns = host_time_ns() - start_ns;
+
+  if (sl_memory_pool_get_free_block_count(&host_pool) != block_count) {
+    fprintf(stderr, "FAIL: %u free blocks at the end, expected %u\n",
+            (unsigned)sl_memory_pool_get_free_block_count(&host_pool), (unsigned)block_count);
+    return EXIT_FAILURE;
+  }
+  if (empty_count == 0) {
+    fprintf(stderr, "FAIL: the pool never ran empty\n");
+    return EXIT_FAILURE;
+  }
+
+  printf("%u threads, %llu allocations, %llu empty pool, %.1f ns per allocation and free\n",
+         (unsigned)host_thread_count,
+         (unsigned long long)alloc_count,
+         (unsigned long long)empty_count,
+         (alloc_count != 0) ? ((double)elapsed_ns / (double)alloc_count) : 0.0);
+  printf("lock-free pool ok\n");
+  return EXIT_SUCCESS;
+}
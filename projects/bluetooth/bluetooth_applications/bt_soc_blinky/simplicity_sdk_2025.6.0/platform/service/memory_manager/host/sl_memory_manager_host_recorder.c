@@ -0,0 +1,476 @@
+/***************************************************************************//**
+ * @file
+ * @brief Allocation trace recorder stream reader of the Memory Manager host tool
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Converts the binary stream of the allocation trace recorder, see
+ * sli_memory_profiler_trace.h, to the operations replayed by the host tool.
+ *
+ * The heap-level records give the block lifetimes. An allocation record is
+ * followed by the record of the LT or ST tracker that carries the size
+ * requested by the caller. An allocation record that is not followed by one
+ * is a reservation. A reallocation that moves the block is recorded as an
+ * allocation, the reallocation and the free of the original block, all in
+ * the same atomic section. A pool is a long-term block followed by a pool
+ * tracker record, and the pool block size is the size of its first block
+ * allocation.
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sl_memory_manager_host.h"
+#include "sli_memory_manager.h"
+#include "sli_memory_profiler_trace.h"
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+#define RECORDER_ID_NONE  UINT32_MAX
+
+#define RECORD_OP(record)    ((record)->op_size >> SLI_MEMORY_PROFILER_TRACE_OP_SHIFT)
+#define RECORD_SIZE(record)  ((size_t)((record)->op_size & SLI_MEMORY_PROFILER_TRACE_SIZE_MASK))
+
+/*******************************************************************************
+ ********************************   DATA TYPES   *******************************
+ ******************************************************************************/
+
+typedef enum {
+  RECORDER_SLOT_EMPTY,
+  RECORDER_SLOT_BLOCK,
+  RECORDER_SLOT_RESERVED,
+  RECORDER_SLOT_POOL,                 // Block holding a pool
+  RECORDER_SLOT_POOL_BLOCK
+} recorder_slot_kind_t;
+
+// Block of the device heap, identified by the address returned to the caller
+// on the device.
+typedef struct {
+  recorder_slot_kind_t kind;
+  uint32_t address;
+  uint32_t pool;
+  size_t op_index;                    // Operation that allocated the block
+} recorder_slot_t;
+
+typedef struct {
+  uint32_t tracker;                   // Pool handle on the device
+  bool tracked;                       // Tracker not deleted yet
+} recorder_pool_t;
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+static recorder_slot_t recorder_slots[HOST_SLOT_COUNT];
+static recorder_pool_t recorder_pools[HOST_POOL_COUNT];
+static uint32_t recorder_next_id;
+
+static host_op_t *recorder_ops;
+static size_t recorder_op_count;
+static size_t recorder_op_capacity;
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Appends an operation.
+ ******************************************************************************/
+static host_op_t *recorder_emit(host_op_type_t type, uint32_t id)
+{
+  host_op_t *op;
+
+  if (recorder_op_count == recorder_op_capacity) {
+    recorder_op_capacity = (recorder_op_capacity == 0) ? 1024u : (recorder_op_capacity * 2u);
+    recorder_ops = realloc(recorder_ops, recorder_op_capacity * sizeof(host_op_t));
+    if (recorder_ops == NULL) {
+      fprintf(stderr, "out of host memory\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  op = &recorder_ops[recorder_op_count++];
+  op->type = type;
+  op->id = id;
+  op->pool = 0;
+  op->size = 0;
+  op->align = SL_MEMORY_BLOCK_ALIGN_DEFAULT;
+  op->count = 0;
+  op->block_type = BLOCK_TYPE_LONG_TERM;
+  return op;
+}
+
+/***************************************************************************//**
+ * Finds a live block of a kind at a device address. A pool and its first
+ * block have the same address.
+ ******************************************************************************/
+static uint32_t recorder_find(uint32_t address, recorder_slot_kind_t kind)
+{
+  for (uint32_t id = 0; id < HOST_SLOT_COUNT; id++) {
+    if ((recorder_slots[id].kind == kind)
+        && (recorder_slots[id].address == address)) {
+      return id;
+    }
+  }
+  return RECORDER_ID_NONE;
+}
+
+/***************************************************************************//**
+ * Emits the operation that frees a block.
+ ******************************************************************************/
+static void recorder_free(uint32_t id)
+{
+  recorder_slot_t *slot = &recorder_slots[id];
+
+  switch (slot->kind) {
+    case RECORDER_SLOT_BLOCK:
+      recorder_emit(HOST_OP_FREE, id);
+      break;
+
+    case RECORDER_SLOT_RESERVED:
+      recorder_emit(HOST_OP_RELEASE, id);
+      break;
+
+    case RECORDER_SLOT_POOL:
+      recorder_emit(HOST_OP_POOL_DELETE, id)->pool = slot->pool;
+      recorder_pools[slot->pool].tracker = 0;
+      recorder_pools[slot->pool].tracked = false;
+      break;
+
+    case RECORDER_SLOT_POOL_BLOCK:
+      recorder_emit(HOST_OP_POOL_FREE, id);
+      break;
+
+    default:
+      break;
+  }
+  slot->kind = RECORDER_SLOT_EMPTY;
+}
+
+/***************************************************************************//**
+ * Gets a block identifier for a new device block.
+ ******************************************************************************/
+static uint32_t recorder_new(recorder_slot_kind_t kind,
+                             uint32_t address,
+                             host_recorder_stats_t *stats)
+{
+  uint32_t id = recorder_find(address, kind);
+
+  // The free of the previous block at this address was lost.
+  if (id != RECORDER_ID_NONE) {
+    stats->unmatched_count++;
+    recorder_free(id);
+  }
+
+  for (uint32_t i = 0; i < HOST_SLOT_COUNT; i++) {
+    id = (recorder_next_id + i) % HOST_SLOT_COUNT;
+    if (recorder_slots[id].kind == RECORDER_SLOT_EMPTY) {
+      recorder_next_id = (id + 1u) % HOST_SLOT_COUNT;
+      recorder_slots[id].kind = kind;
+      recorder_slots[id].address = address;
+      recorder_slots[id].op_index = recorder_op_count;
+      return id;
+    }
+  }
+
+  fprintf(stderr, "more than %u live blocks in the trace\n", HOST_SLOT_COUNT);
+  exit(EXIT_FAILURE);
+}
+
+/***************************************************************************//**
+ * Finds the pool of a tracker handle.
+ ******************************************************************************/
+static uint32_t recorder_find_pool(uint32_t tracker)
+{
+  for (uint32_t pool = 0; pool < HOST_POOL_COUNT; pool++) {
+    if (recorder_pools[pool].tracked && (recorder_pools[pool].tracker == tracker)) {
+      return pool;
+    }
+  }
+  return RECORDER_ID_NONE;
+}
+
+/***************************************************************************//**
+ * Gets the index of the next record that changes the heap, skipping the
+ * ownership and log records.
+ ******************************************************************************/
+static size_t recorder_next(const sli_memory_profiler_trace_record_t *records,
+                            size_t record_count,
+                            size_t index)
+{
+  for (index++; index < record_count; index++) {
+    if ((RECORD_OP(&records[index]) != SLI_MEMORY_PROFILER_TRACE_OP_OWNERSHIP)
+        && (RECORD_OP(&records[index]) != SLI_MEMORY_PROFILER_TRACE_OP_LOG)) {
+      break;
+    }
+  }
+  return index;
+}
+
+/***************************************************************************//**
+ * Turns the block holding a pool into the creation of the pool.
+ ******************************************************************************/
+static void recorder_create_pool(const sli_memory_profiler_trace_record_t *records,
+                                 size_t record_count,
+                                 size_t index,
+                                 host_recorder_stats_t *stats)
+{
+  const sli_memory_profiler_trace_record_t *record = &records[index];
+  uint32_t id = recorder_find(record->address, RECORDER_SLOT_BLOCK);
+  size_t pool_size = RECORD_SIZE(record);
+  size_t block_size = 0;
+  uint32_t pool;
+
+  // Arenas and the top-level trackers also have pool trackers, but not on a
+  // heap block.
+  if (id == RECORDER_ID_NONE) {
+    stats->ignored_count++;
+    return;
+  }
+
+  for (size_t i = index + 1u; i < record_count; i++) {
+    if ((records[i].tracker == record->tracker)
+        && (RECORD_OP(&records[i]) == SLI_MEMORY_PROFILER_TRACE_OP_ALLOC)) {
+      block_size = RECORD_SIZE(&records[i]);
+      break;
+    }
+  }
+  // A pool that is never used is replayed as a plain block.
+  if ((block_size == 0) || (block_size > pool_size)) {
+    return;
+  }
+
+  for (pool = 0; pool < HOST_POOL_COUNT; pool++) {
+    if ((recorder_pools[pool].tracker == 0) && !recorder_pools[pool].tracked) {
+      break;
+    }
+  }
+  if (pool == HOST_POOL_COUNT) {
+    fprintf(stderr, "more than %u pools in the trace\n", HOST_POOL_COUNT);
+    exit(EXIT_FAILURE);
+  }
+
+  recorder_pools[pool].tracker = record->tracker;
+  recorder_pools[pool].tracked = true;
+  recorder_slots[id].kind = RECORDER_SLOT_POOL;
+  recorder_slots[id].pool = pool;
+
+  recorder_ops[recorder_slots[id].op_index].type = HOST_OP_POOL_CREATE;
+  recorder_ops[recorder_slots[id].op_index].pool = pool;
+  recorder_ops[recorder_slots[id].op_index].size = block_size;
+  recorder_ops[recorder_slots[id].op_index].count = pool_size / block_size;
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Converts a stream of the allocation trace recorder to workload operations.
+ ******************************************************************************/
+size_t host_recorder_read(const char *path,
+                          const host_recorder_trackers_t *trackers,
+                          host_op_t **ops,
+                          host_recorder_stats_t *stats)
+{
+  sli_memory_profiler_trace_record_t *records = NULL;
+  size_t record_count = 0;
+  size_t record_capacity = 0;
+  uint32_t pending_free = 0;
+  FILE *file = fopen(path, "rb");
+
+  if (file == NULL) {
+    perror(path);
+    exit(EXIT_FAILURE);
+  }
+
+  for (;; ) {
+    if (record_count == record_capacity) {
+      record_capacity = (record_capacity == 0) ? 4096u : (record_capacity * 2u);
+      records = realloc(records, record_capacity * sizeof(*records));
+      if (records == NULL) {
+        fprintf(stderr, "out of host memory\n");
+        exit(EXIT_FAILURE);
+      }
+    }
+    if (fread(&records[record_count], sizeof(*records), 1, file) != 1) {
+      break;
+    }
+    record_count++;
+  }
+  fclose(file);
+
+  *stats = (host_recorder_stats_t){ .record_count = record_count };
+
+  for (size_t i = 0; i < record_count; i++) {
+    const sli_memory_profiler_trace_record_t *record = &records[i];
+    uint32_t op = RECORD_OP(record);
+    size_t size = RECORD_SIZE(record);
+    uint32_t pool = recorder_find_pool(record->tracker);
+    uint32_t id;
+    host_op_t *host_op;
+
+    switch (op) {
+      case SLI_MEMORY_PROFILER_TRACE_OP_ALLOC:
+        if (record->tracker == trackers->heap) {
+          const sli_memory_profiler_trace_record_t *typed = NULL;
+          const sli_memory_profiler_trace_record_t *moved = NULL;
+          size_t typed_index = recorder_next(records, record_count, i);
+          size_t moved_index = recorder_next(records, record_count, typed_index);
+
+          if ((typed_index < record_count)
+              && ((records[typed_index].tracker == trackers->malloc_lt) || (records[typed_index].tracker == trackers->malloc_st))
+              && (records[typed_index].address == record->address + SLI_BLOCK_METADATA_SIZE_BYTE)) {
+            typed = &records[typed_index];
+          }
+          if ((typed != NULL)
+              && (moved_index < record_count)
+              && (records[moved_index].tracker == trackers->heap)
+              && (RECORD_OP(&records[moved_index]) == SLI_MEMORY_PROFILER_TRACE_OP_REALLOC)
+              && (records[moved_index].address == record->address)
+              && (records[moved_index].pc != record->address)) {
+            moved = &records[moved_index];
+          }
+
+          if (record->address == 0) {
+            // Check whether the allocation succeeds in this configuration.
+            stats->failed_count++;
+            id = recorder_new(RECORDER_SLOT_BLOCK, 0, stats);
+            recorder_emit(HOST_OP_ALLOC, id)->size = size;
+            recorder_free(id);
+          } else if (moved != NULL) {
+            // Block moved by a reallocation. The free of the original block follows.
+            i = moved_index;
+            pending_free = moved->pc;
+            id = recorder_find(moved->pc + SLI_BLOCK_METADATA_SIZE_BYTE, RECORDER_SLOT_BLOCK);
+            if (id != RECORDER_ID_NONE) {
+              recorder_emit(HOST_OP_REALLOC, id)->size = RECORD_SIZE(typed);
+              recorder_slots[id].address = typed->address;
+            } else {
+              stats->unmatched_count++;
+              id = recorder_new(RECORDER_SLOT_BLOCK, typed->address, stats);
+              recorder_emit(HOST_OP_ALLOC, id)->size = RECORD_SIZE(typed);
+            }
+          } else if (typed != NULL) {
+            i = typed_index;
+            id = recorder_new(RECORDER_SLOT_BLOCK, typed->address, stats);
+            host_op = recorder_emit(HOST_OP_ALLOC, id);
+            host_op->size = RECORD_SIZE(typed);
+            host_op->block_type = (typed->tracker == trackers->malloc_st) ? BLOCK_TYPE_SHORT_TERM : BLOCK_TYPE_LONG_TERM;
+          } else {
+            id = recorder_new(RECORDER_SLOT_RESERVED, record->address, stats);
+            recorder_emit(HOST_OP_RESERVE, id)->size = size;
+          }
+        } else if (pool != RECORDER_ID_NONE) {
+          if (record->address == 0) {
+            stats->failed_count++;
+          } else {
+            id = recorder_new(RECORDER_SLOT_POOL_BLOCK, record->address, stats);
+            recorder_slots[id].pool = pool;
+            recorder_emit(HOST_OP_POOL_ALLOC, id)->pool = pool;
+          }
+        } else {
+          stats->ignored_count++;
+        }
+        break;
+
+      case SLI_MEMORY_PROFILER_TRACE_OP_REALLOC:
+        if (record->tracker != trackers->heap) {
+          stats->ignored_count++;
+          break;
+        }
+        id = recorder_find(record->pc + SLI_BLOCK_METADATA_SIZE_BYTE, RECORDER_SLOT_BLOCK);
+        if (id == RECORDER_ID_NONE) {
+          stats->unmatched_count++;
+          break;
+        }
+        // The recorded size includes the block metadata.
+        recorder_emit(HOST_OP_REALLOC, id)->size = (size > SLI_BLOCK_METADATA_SIZE_BYTE) ? (size - SLI_BLOCK_METADATA_SIZE_BYTE) : 1u;
+        recorder_slots[id].address = record->address + SLI_BLOCK_METADATA_SIZE_BYTE;
+        if (record->address != record->pc) {
+          pending_free = record->pc;
+        }
+        break;
+
+      case SLI_MEMORY_PROFILER_TRACE_OP_FREE:
+        if (record->tracker == trackers->heap) {
+          if ((pending_free != 0) && (record->address == pending_free)) {
+            pending_free = 0;
+            break;
+          }
+          // Blocks are known by their payload address, reservations by their
+          // start address.
+          id = recorder_find(record->address + SLI_BLOCK_METADATA_SIZE_BYTE, RECORDER_SLOT_BLOCK);
+          if (id == RECORDER_ID_NONE) {
+            id = recorder_find(record->address + SLI_BLOCK_METADATA_SIZE_BYTE, RECORDER_SLOT_POOL);
+          }
+          if (id == RECORDER_ID_NONE) {
+            id = recorder_find(record->address, RECORDER_SLOT_RESERVED);
+          }
+        } else if (pool != RECORDER_ID_NONE) {
+          id = recorder_find(record->address, RECORDER_SLOT_POOL_BLOCK);
+        } else {
+          stats->ignored_count++;
+          break;
+        }
+
+        if (id == RECORDER_ID_NONE) {
+          stats->unmatched_count++;
+        } else {
+          recorder_free(id);
+        }
+        break;
+
+      case SLI_MEMORY_PROFILER_TRACE_OP_POOL_TRACKER:
+        recorder_create_pool(records, record_count, i, stats);
+        break;
+
+      case SLI_MEMORY_PROFILER_TRACE_OP_DELETE_TRACKER:
+        // The pool is deleted with the free of its block.
+        if (pool != RECORDER_ID_NONE) {
+          recorder_pools[pool].tracked = false;
+        }
+        break;
+
+      case SLI_MEMORY_PROFILER_TRACE_OP_DROPPED:
+        stats->dropped_count += size;
+        break;
+
+      default:
+        // Ownership and log records do not change the heap.
+        break;
+    }
+  }
+
+  free(records);
+  *ops = recorder_ops;
+  return recorder_op_count;
+}
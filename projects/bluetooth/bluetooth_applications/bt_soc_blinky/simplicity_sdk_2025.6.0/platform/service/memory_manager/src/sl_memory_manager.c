@@ -49,7 +49,7 @@
 #include "sli_memory_manager_retention_control.h"
 #endif
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
 #include "em_device.h" // For SRAM_BASE and SRAM_SIZE
 #include "sli_memory_profiler.h"
 
@@ -82,6 +82,8 @@ extern char __HeapLimit[];
  ******************************************************************************/
 
 sl_memory_heap_t sli_general_purpose_heap;
+// Size of the end of the heap taken by the blocks reserved without retention.
+uint32_t reserve_no_retention_size = 0;
 #if defined(DEBUG_EFM) || defined(DEBUG_EFM_USER)
 bool reserve_no_retention_first = true;
 #endif
@@ -92,7 +94,8 @@ bool reserve_no_retention_first = true;
 
 static sli_block_metadata_t *memory_manage_data_alignment(sl_memory_heap_t *heap,
                                                           sli_block_metadata_t *current_block_metadata,
-                                                          size_t block_align);
+                                                          size_t block_align,
+                                                          bool *padding_free);
 
 /*******************************************************************************
  **************************   GLOBAL FUNCTIONS   *******************************
@@ -125,7 +128,7 @@ sl_status_t sl_memory_init(void)
   }
 #endif
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   // Create the pool tracker for the physical RAM
   sli_memory_profiler_create_pool_tracker(sli_mm_ram_name,
                                           sli_mm_ram_name,
@@ -229,11 +232,15 @@ sl_status_t sl_memory_reserve_no_retention(size_t size,
 
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_ATOMIC();
+  sli_memory_increment_heap_generation();
 
   block_len_dw = sli_block_len_dword_decode(free_st_list_head);
   block_size_remaining = SLI_BLOCK_LEN_DWORD_TO_BYTE(block_len_dw);
-  // Verify there is enough space in heap.
-  if (block_size_remaining >= size_real) {
+  // Verify there is enough space in heap. With segregated free lists, the short-term head
+  // pointer is only a hint and may reference an allocated block.
+  if ((free_st_list_head->block_in_use == 0) && (block_size_remaining >= size_real)) {
+    FREE_BINS_REMOVE(&sli_general_purpose_heap, free_st_list_head);
+
     // Get aligned block: get address from end of available heap minus the requested size. Round down this address.
     *block = (void *)(((uint64_t *)free_st_list_head + (block_len_dw + SLI_BLOCK_METADATA_SIZE_DWORD)) - SLI_BLOCK_LEN_BYTE_TO_DWORD(size_real));
     *block = (void *)SLI_ALIGN_ROUND_DOWN(((uintptr_t)*block), block_align);
@@ -242,6 +249,8 @@ sl_status_t sl_memory_reserve_no_retention(size_t size,
     data_payload_start = (void *)((uint8_t *)free_st_list_head + SLI_BLOCK_METADATA_SIZE_BYTE);
     sli_block_len_dword_encode(free_st_list_head, ((uint64_t *)*block - (uint64_t *)data_payload_start));
 
+    FREE_BINS_INSERT(&sli_general_purpose_heap, free_st_list_head);
+
     // Ensure there is still enough space after alignment. See Note #1.
     block_len_dw = sli_block_len_dword_decode(free_st_list_head);
     if (block_size_remaining < SLI_BLOCK_LEN_DWORD_TO_BYTE(block_len_dw)) {
@@ -249,6 +258,10 @@ sl_status_t sl_memory_reserve_no_retention(size_t size,
       return SL_STATUS_ALLOCATION_FAILED;
     }
 
+    // The reserved blocks are contiguous up to the heap end.
+    reserve_no_retention_size = (uint32_t)(((uintptr_t)sli_general_purpose_heap.base_addr + sli_general_purpose_heap.size)
+                                           - (uintptr_t)*block);
+
     status = SL_STATUS_OK;
   } else {
     status = SL_STATUS_ALLOCATION_FAILED;
@@ -273,15 +286,24 @@ sl_status_t sl_memory_reserve_no_retention(size_t size,
  ******************************************************************************/
 void *sl_malloc(size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   void *block_avail = NULL;
 
+#if defined(SLI_MEMORY_MANAGER_SIZE_CLASS_POOLS)
+  // Small requests are served from the size-class pools first.
+  block_avail = sli_memory_size_class_alloc(size);
+  if (block_avail == NULL) {
+    (void)sl_memory_alloc_advanced(size, SL_MEMORY_BLOCK_ALIGN_DEFAULT, BLOCK_TYPE_LONG_TERM, &block_avail);
+  }
+#else
   (void)sl_memory_alloc_advanced(size, SL_MEMORY_BLOCK_ALIGN_DEFAULT, BLOCK_TYPE_LONG_TERM, &block_avail);
+#endif
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, block_avail, return_address);
+  HEAP_CHECK_UPDATE_OWNER(block_avail, return_address);
 #endif
 
   return block_avail;
@@ -294,15 +316,16 @@ sl_status_t sl_memory_alloc(size_t size,
                             sl_memory_block_type_t type,
                             void **block)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   sl_status_t status;
 
   status = sl_memory_heap_alloc(&sli_general_purpose_heap, size, type, block);
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, *block, return_address);
+  HEAP_CHECK_UPDATE_OWNER(*block, return_address);
 #endif
 
   return status;
@@ -317,15 +340,16 @@ sl_status_t sl_memory_alloc_advanced(size_t size,
                                      sl_memory_block_type_t type,
                                      void **block)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   sl_status_t status;
 
   status = sl_memory_heap_alloc_advanced(&sli_general_purpose_heap, size, align, type, block);
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, *block, return_address);
+  HEAP_CHECK_UPDATE_OWNER(*block, return_address);
 #endif
 
   return status;
@@ -370,15 +394,29 @@ sl_status_t sl_memory_free(void *block)
 void *sl_calloc(size_t item_count,
                 size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   void *block_avail = NULL;
 
+#if defined(SLI_MEMORY_MANAGER_SIZE_CLASS_POOLS)
+  // Small requests are served from the size-class pools first.
+  if ((size != 0) && (item_count <= (SLI_SIZE_CLASS_MAX_SIZE_BYTE / size))) {
+    block_avail = sli_memory_size_class_alloc(item_count * size);
+    if (block_avail != NULL) {
+      memset(block_avail, 0, item_count * size);
+    }
+  }
+  if (block_avail == NULL) {
+    (void)sl_memory_calloc(item_count, size, BLOCK_TYPE_LONG_TERM, &block_avail);
+  }
+#else
   (void)sl_memory_calloc(item_count, size, BLOCK_TYPE_LONG_TERM, &block_avail);
+#endif
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, block_avail, return_address);
+  HEAP_CHECK_UPDATE_OWNER(block_avail, return_address);
 #endif
 
   return block_avail;
@@ -393,15 +431,16 @@ sl_status_t sl_memory_calloc(size_t item_count,
                              sl_memory_block_type_t type,
                              void **block)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   sl_status_t status;
 
   status = sl_memory_heap_calloc(&sli_general_purpose_heap, item_count, size, type, block);
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, *block, return_address);
+  HEAP_CHECK_UPDATE_OWNER(*block, return_address);
 #endif
 
   return status;
@@ -413,18 +452,19 @@ sl_status_t sl_memory_calloc(size_t item_count,
 void *sl_realloc(void *ptr,
                  size_t size)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   void *block_avail = NULL;
 
   (void)sl_memory_realloc(ptr, size, &block_avail);
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   // Realloc to 0 bytes is equivalent to free, so only track ownership when size
   // is other than 0
   if (size != 0) {
     sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, block_avail, return_address);
+    HEAP_CHECK_UPDATE_OWNER(block_avail, return_address);
   }
 #endif
 
@@ -449,7 +489,7 @@ sl_status_t sl_memory_realloc(void *ptr,
                               size_t size,
                               void **block)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   sl_status_t status;
@@ -460,11 +500,12 @@ sl_status_t sl_memory_realloc(void *ptr,
 
   status = sl_memory_heap_realloc(heap, ptr, size, block);
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   // Realloc to 0 bytes is equivalent to free, so only track ownership when size
   // is other than 0
   if (size != 0) {
     sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, *block, return_address);
+    HEAP_CHECK_UPDATE_OWNER(*block, return_address);
   }
 #endif
 
@@ -479,7 +520,7 @@ sl_status_t sl_memory_get_heap_info(sl_memory_heap_info_t *heap_info)
 {
 #if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
   sl_memory_region_t heap_region = sl_memory_get_heap_region();
-  sli_block_metadata_t *block_metadata = (sli_block_metadata_t *)heap_region.addr;
+  sli_block_metadata_t *block_metadata;
   bool compute = true;
   size_t block_len_dw = 0u;
   size_t remaining_size = 0u;
@@ -497,6 +538,7 @@ sl_status_t sl_memory_get_heap_info(sl_memory_heap_info_t *heap_info)
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_ATOMIC();
 
+  block_metadata = sli_memory_get_first_block(&sli_general_purpose_heap);
   do {
     block_len_dw = sli_block_len_dword_decode(block_metadata);
     // Calculate the smallest and largest used size and the remaining heap sizes.
@@ -636,15 +678,16 @@ sl_status_t sl_memory_heap_alloc(sl_memory_heap_t *heap,
                                  sl_memory_block_type_t type,
                                  void **block)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   sl_status_t status;
 
   status = sl_memory_heap_alloc_advanced(heap, size, SL_MEMORY_BLOCK_ALIGN_DEFAULT, type, block);
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, *block, return_address);
+  HEAP_CHECK_UPDATE_OWNER(*block, return_address);
 #endif
 
   return status;
@@ -666,7 +709,7 @@ sl_status_t sl_memory_heap_alloc_advanced(sl_memory_heap_t *heap,
                                           sl_memory_block_type_t type,
                                           void **block)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
 
@@ -689,6 +732,7 @@ sl_status_t sl_memory_heap_alloc_advanced(sl_memory_heap_t *heap,
   size_t block_align = (align == SL_MEMORY_BLOCK_ALIGN_DEFAULT) ? SLI_BLOCK_ALLOC_MIN_ALIGN : align;
   size_t other_offset = 0;
   bool is_aligned = false;
+  bool padding_free = false;
 #if defined(DEBUG_EFM) || defined(DEBUG_EFM_USER)
   reserve_no_retention_first = false;
 #endif
@@ -709,11 +753,12 @@ sl_status_t sl_memory_heap_alloc_advanced(sl_memory_heap_t *heap,
 
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_ATOMIC();
+  sli_memory_increment_heap_generation();
   size_adjusted = sli_memory_find_free_block(heap, size_real, align, type, false, &current_block_metadata);
 
   if ((current_block_metadata == NULL) || (size_adjusted == 0)) {
     CORE_EXIT_ATOMIC();
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
     sli_memory_profiler_track_alloc_with_ownership(sli_mm_heap_name, NULL, size, return_address);
 #endif
     return SL_STATUS_ALLOCATION_FAILED;
@@ -728,6 +773,7 @@ sl_status_t sl_memory_heap_alloc_advanced(sl_memory_heap_t *heap,
 
   // Prepare found block.
   allocated_blk = current_block_metadata;
+  FREE_BINS_REMOVE(heap, current_block_metadata);
 
   // Update counter of free blocks.
   heap->free_blocks_number--;
@@ -742,7 +788,7 @@ sl_status_t sl_memory_heap_alloc_advanced(sl_memory_heap_t *heap,
       // Verify if alignment adjustment is required.
       old_block_metadata = current_block_metadata;
       if (!is_aligned) {
-        current_block_metadata = memory_manage_data_alignment(heap, current_block_metadata, block_align);
+        current_block_metadata = memory_manage_data_alignment(heap, current_block_metadata, block_align, &padding_free);
         allocated_blk = current_block_metadata;
       }
 
@@ -770,8 +816,10 @@ sl_status_t sl_memory_heap_alloc_advanced(sl_memory_heap_t *heap,
       sli_block_offset_prev_dword_encode(allocated_blk, sli_block_offset_prev_dword_decode(current_block_metadata));
       sli_block_offset_next_dword_encode(allocated_blk, sli_block_offset_prev_dword_decode(new_free_blk));
 
-      // Update head pointers. See Note #1.
-      sli_update_free_list_heads(heap, new_free_blk, old_block_metadata, false);
+      FREE_BINS_INSERT(heap, new_free_blk);
+
+      // Update head pointers. See Note #1. A free block left before the aligned block keeps the found block address.
+      sli_update_free_list_heads(heap, new_free_blk, padding_free ? allocated_blk : old_block_metadata, false);
 
       // Decrement bank counter for previous free block metadata. Will be accounted in allocation.
       DECREMENT_BANK_COUNTER(heap, (uint8_t *) allocated_blk, (uint8_t *)allocated_blk + SLI_BLOCK_METADATA_SIZE_BYTE);
@@ -801,6 +849,7 @@ sl_status_t sl_memory_heap_alloc_advanced(sl_memory_heap_t *heap,
       sli_block_len_dword_encode(new_free_blk, SLI_BLOCK_LEN_BYTE_TO_DWORD(block_size_remaining - SLI_BLOCK_METADATA_SIZE_BYTE));
 
       sli_block_offset_next_dword_encode(new_free_blk, sli_block_offset_prev_dword_decode(allocated_blk));
+      FREE_BINS_INSERT(heap, new_free_blk);
 
       // Data payload alignment for short-term is managed during the first-fit algorithm loop
       // at the beginning of this function.
@@ -827,7 +876,11 @@ sl_status_t sl_memory_heap_alloc_advanced(sl_memory_heap_t *heap,
       is_aligned = SLI_ADDR_IS_ALIGNED(data_payload, block_align);
     }
     if (!is_aligned) {
-      allocated_blk = memory_manage_data_alignment(heap, allocated_blk, block_align);
+      allocated_blk = memory_manage_data_alignment(heap, allocated_blk, block_align, &padding_free);
+      if (padding_free) {
+        // The found block address is still a free block.
+        old_block_metadata = allocated_blk;
+      }
     }
 
     // Initialize final metadata of found block that was not split.
@@ -857,13 +910,14 @@ sl_status_t sl_memory_heap_alloc_advanced(sl_memory_heap_t *heap,
   // Include metadata as it was removed or is new.
   INCREMENT_BANK_COUNTER(heap, (uint8_t *)allocated_blk, (uint8_t *)*block + SLI_BLOCK_LEN_DWORD_TO_BYTE(allocated_blk->length));
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_alloc(sli_mm_heap_name, allocated_blk, size_real + SLI_BLOCK_METADATA_SIZE_BYTE);
   if (type == BLOCK_TYPE_LONG_TERM) {
     sli_memory_profiler_track_alloc_with_ownership(sli_mm_heap_malloc_lt_name, *block, size, return_address);
   } else if (type == BLOCK_TYPE_SHORT_TERM) {
     sli_memory_profiler_track_alloc_with_ownership(sli_mm_heap_malloc_st_name, *block, size, return_address);
   }
+  HEAP_CHECK_RECORD_OWNER(heap, *block, return_address);
 #endif
 
 #if defined(SLI_MEMORY_MANAGER_ENABLE_SYSTEMVIEW)
@@ -909,12 +963,22 @@ sl_status_t sl_memory_heap_free(sl_memory_heap_t *heap,
     return SL_STATUS_NULL_POINTER;  // See Note #1.
   }
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_SIZE_CLASS_POOLS)
+  // Blocks handed out by sl_malloc() may come from a size-class pool.
+  sl_memory_pool_t *pool_handle = sli_memory_size_class_get_pool(block);
+  if (pool_handle != NULL) {
+    return sl_memory_pool_free(pool_handle, block);
+  }
+#endif
+
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_free(sli_mm_heap_name, ((uint8_t *)block - SLI_BLOCK_METADATA_SIZE_BYTE));
+  HEAP_CHECK_CLEAR_OWNER(heap, block);
 #endif
 
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_ATOMIC();
+  sli_memory_increment_heap_generation();
 
   sli_block_metadata_t *current_metadata = (sli_block_metadata_t *)((uint8_t *)block - SLI_BLOCK_METADATA_SIZE_BYTE);
   // Ensure the block being freed was in use with a valid length.
@@ -949,6 +1013,7 @@ sl_status_t sl_memory_heap_free(sl_memory_heap_t *heap,
     if ((!metadata_prev_blk->block_in_use && !current_metadata->heap_start_align)
         && (reservations_size_prev == 0)) {
       // Merge current block to free with previous adjacent block.
+      FREE_BINS_REMOVE(heap, metadata_prev_blk);
       free_block = metadata_prev_blk;
       total_size_free_block_dw += prev_blk_len_dw + SLI_BLOCK_METADATA_SIZE_DWORD;
 
@@ -964,7 +1029,12 @@ sl_status_t sl_memory_heap_free(sl_memory_heap_t *heap,
       // no valid metadata. A new valid metadata will exist after this special merge.
       free_block = metadata_prev_blk;
       total_size_free_block_dw += sli_block_offset_prev_dword_decode(current_metadata);
+#if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
+      // The lost zone was accounted as used when the block was aligned.
+      heap->used_size -= SLI_BLOCK_LEN_DWORD_TO_BYTE(sli_block_offset_prev_dword_decode(current_metadata));
+#endif
       current_metadata->heap_start_align = false;
+      free_block->heap_start_align = false;
       sli_block_offset_prev_dword_encode(free_block, 0);   // heap start.
 
       // Increment counter for new free metadata
@@ -986,6 +1056,7 @@ sl_status_t sl_memory_heap_free(sl_memory_heap_t *heap,
     if ((!next_block->block_in_use) && (reservations_size_next == 0)) {
       // Remove metadata of next block from bank counter as free block will be merged with adjacent block.
       DECREMENT_BANK_COUNTER(heap, (uint8_t*)next_block, (uint8_t*)next_block + SLI_BLOCK_METADATA_SIZE_BYTE);
+      FREE_BINS_REMOVE(heap, next_block);
 
       // Merge block with next adjacent block.
       block_len_dw = sli_block_len_dword_decode(next_block);
@@ -1035,6 +1106,8 @@ sl_status_t sl_memory_heap_free(sl_memory_heap_t *heap,
   // Update the heap's head pointers.
   heap->free_lt_list_head = (void *)free_lt_list_head;
   heap->free_st_list_head = (void *)free_st_list_head;
+  // Links are written in the free payload, so only insert once the merged metadata has been inspected.
+  FREE_BINS_INSERT(heap, free_block);
 
   CORE_EXIT_ATOMIC();
 
@@ -1059,7 +1132,7 @@ sl_status_t sl_memory_heap_calloc(sl_memory_heap_t *heap,
                                   sl_memory_block_type_t type,
                                   void **block)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   size_t block_size;
@@ -1087,8 +1160,9 @@ sl_status_t sl_memory_heap_calloc(sl_memory_heap_t *heap,
     memset(*block, 0, block_size);
   }
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, *block, return_address);
+  HEAP_CHECK_UPDATE_OWNER(*block, return_address);
 #endif
 
   return status;
@@ -1126,7 +1200,7 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
   // Make sure the heap handle isn't NULL.
   EFM_ASSERT(heap != NULL);
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   sl_status_t status = SL_STATUS_OK;
@@ -1154,8 +1228,9 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
   // Manage special parameters values (see Note #1).
   if (ptr == NULL) {
     status = sl_memory_alloc(size, BLOCK_TYPE_LONG_TERM, block);
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
     sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, *block, return_address);
+    HEAP_CHECK_UPDATE_OWNER(*block, return_address);
 #endif
     return status;
   } else if (size == 0) {
@@ -1163,8 +1238,22 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
     return status;
   }
 
+#if defined(SLI_MEMORY_MANAGER_SIZE_CLASS_POOLS)
+  // Blocks handed out by sl_malloc() may come from a size-class pool.
+  sl_memory_pool_t *pool_handle = sli_memory_size_class_get_pool(ptr);
+  if (pool_handle != NULL) {
+    status = sli_memory_size_class_realloc(pool_handle, ptr, size, block);
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
+    sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, *block, return_address);
+    HEAP_CHECK_UPDATE_OWNER(*block, return_address);
+#endif
+    return status;
+  }
+#endif
+
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_ATOMIC();
+  sli_memory_increment_heap_generation();
 
   // Get metadata of current block.
   current_block = (sli_block_metadata_t *)((uint8_t *)ptr - SLI_BLOCK_METADATA_SIZE_BYTE);
@@ -1194,6 +1283,7 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
 
         // Remove free block metadata from bank counter as free block will be merged with adjacent block or removed.
         DECREMENT_BANK_COUNTER(heap, (uint8_t*)next_block, (uint8_t*)next_block + SLI_BLOCK_METADATA_SIZE_BYTE);
+        FREE_BINS_REMOVE(heap, next_block);
 
         if (next_block_len_remaining >= SL_MEMORY_MANAGER_BLOCK_ALLOCATION_MIN_SIZE) {
           // Enough space left in next block to leave a smaller free block.
@@ -1227,10 +1317,15 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
           sli_update_free_list_heads(heap, adjusted_next_block, next_block, false);
           // Ensure old next block metadata is invalid.
           sli_memory_metadata_init(next_block);
+          FREE_BINS_INSERT(heap, adjusted_next_block);
         } else {
           // Not enough space in next block, simply append all next block to current one
           // by updating all required blocks' metadata.
           heap->free_blocks_number--;
+#if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
+          // To account for one less metadata in heap.
+          heap->used_size -= SLI_BLOCK_METADATA_SIZE_BYTE;
+#endif
           sli_block_len_dword_encode(current_block, (sli_block_len_dword_decode(current_block)
                                                      + SLI_BLOCK_METADATA_SIZE_DWORD
                                                      + sli_block_len_dword_decode(next_block)));
@@ -1257,7 +1352,7 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
 
         // Current block has been extended. Its payload must be returned to the caller.
         *block = ptr;
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
         sli_memory_profiler_track_realloc(sli_mm_heap_name,
                                           (uint8_t *)ptr - SLI_BLOCK_METADATA_SIZE_BYTE,
                                           (uint8_t *)ptr - SLI_BLOCK_METADATA_SIZE_BYTE,
@@ -1284,7 +1379,7 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
       // Copy data from current block to new block. See Note #2.
       memcpy(*block, ptr, current_block_len);
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
       sli_memory_profiler_track_realloc(sli_mm_heap_name,
                                         (uint8_t *)ptr - SLI_BLOCK_METADATA_SIZE_BYTE,
                                         (uint8_t *)*block - SLI_BLOCK_METADATA_SIZE_BYTE,
@@ -1300,7 +1395,8 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
     }
 #if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
     if (find_new_block == false) {
-      heap->used_size += size_real - current_block_len;
+      // The block can end up longer than requested when the whole next block is appended.
+      heap->used_size += SLI_BLOCK_LEN_DWORD_TO_BYTE(sli_block_len_dword_decode(current_block)) - current_block_len;
       if (heap->used_size > heap->high_watermark) {
         heap->high_watermark = heap->used_size;
       }
@@ -1327,6 +1423,8 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
 
       // Verify if next block is free to merge the newly unallocated portion of the current block.
       if (next_block->block_in_use == 0 && reservation_offset == 0) {
+        FREE_BINS_REMOVE(heap, next_block);
+
         // Compute adjusted adjacent free block location.
         sli_block_metadata_t *adjusted_next_block = (sli_block_metadata_t *)((uint8_t *)current_block + SLI_BLOCK_METADATA_SIZE_BYTE + size_real);
 
@@ -1361,6 +1459,7 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
 
         // Ensure old next block metadata is invalid.
         sli_memory_metadata_init(next_block);
+        FREE_BINS_INSERT(heap, adjusted_next_block);
       } else {
         // Next block is in use and cannot be merged with the newly unallocated portion.
         create_new_block = true;
@@ -1394,6 +1493,11 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
         }
 
         heap->free_blocks_number++;
+#if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
+        // To account for the new free block metadata.
+        heap->used_size += SLI_BLOCK_METADATA_SIZE_BYTE;
+#endif
+        FREE_BINS_INSERT(heap, adjusted_next_block);
         // Update head pointers accordingly.
         sli_update_free_list_heads(heap, adjusted_next_block, NULL, false);
       } else {
@@ -1405,20 +1509,21 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
 
     // Current block has been reduced. Its payload must be returned to the caller.
     *block = ptr;
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
     sli_memory_profiler_track_realloc(sli_mm_heap_name,
                                       (uint8_t *)ptr - SLI_BLOCK_METADATA_SIZE_BYTE,
                                       (uint8_t *)ptr - SLI_BLOCK_METADATA_SIZE_BYTE,
                                       size_real + SLI_BLOCK_METADATA_SIZE_BYTE);
 #endif
 #if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
-    heap->used_size -= current_block_len - size_real;
+    // The block keeps its length when the unallocated portion is too small to create a free block.
+    heap->used_size -= current_block_len - SLI_BLOCK_LEN_DWORD_TO_BYTE(sli_block_len_dword_decode(current_block));
 #endif
   } else {
     // If the size requested does not provoke a block extension or reduction, consider no error.
     // And return the same given address. We still track it to show that resize was requested.
     *block = ptr;
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
     sli_memory_profiler_track_realloc(sli_mm_heap_name,
                                       (uint8_t *)ptr - SLI_BLOCK_METADATA_SIZE_BYTE,
                                       (uint8_t *)ptr - SLI_BLOCK_METADATA_SIZE_BYTE,
@@ -1428,8 +1533,9 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
 
   CORE_EXIT_ATOMIC();
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, *block, return_address);
+  HEAP_CHECK_UPDATE_OWNER(*block, return_address);
 #endif
 
   return status;
@@ -1448,42 +1554,73 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
  *
  * @param[in]  block_align              Alignment required, in bytes.
  *
+ * @param[out] padding_free             Set to true if the space before the
+ *                                      aligned block is left as a free block
+ *                                      at the original block address.
+ *
  * @return     Pointer to the new block with the correct alignment.
  *
+ * @note (1) The space lost because of the alignment is merged into the
+ *           previous block. It helps to keep all computations in
+ *           malloc()/free() valid. For ST split block, the lost space is back
+ *           into a free block space. It counts as used only if the previous
+ *           block is in use.
+ *
+ * @note (2) When reserved blocks lie between the previous block and the
+ *           aligned block, the previous block cannot grow over them. The
+ *           space keeps the original metadata and becomes a free block. It
+ *           is large enough for that. See sli_memory_get_align_offset().
  ******************************************************************************/
 static sli_block_metadata_t *memory_manage_data_alignment(sl_memory_heap_t *heap,
                                                           sli_block_metadata_t *current_block_metadata,
-                                                          size_t block_align)
+                                                          size_t block_align,
+                                                          bool *padding_free)
 {
-  void *data_payload = (void *)((uint8_t *)current_block_metadata + SLI_BLOCK_METADATA_SIZE_BYTE);
   sli_block_metadata_t *old_block_metadata = current_block_metadata;
-  size_t align_offset;
+  size_t align_offset = SLI_BLOCK_LEN_BYTE_TO_DWORD(sli_memory_get_align_offset(current_block_metadata, block_align));
+  size_t used_size_delta = 0;
 
-  // Align payload to the correct alignment.
-  data_payload = (void *)SLI_ALIGN_ROUND_UP(((uintptr_t)data_payload), block_align);
+  *padding_free = false;
 
   // Get the new metadata location and update all relevant fields.
-  current_block_metadata = (sli_block_metadata_t *)((uint8_t *)data_payload - SLI_BLOCK_METADATA_SIZE_BYTE);
+  current_block_metadata = (sli_block_metadata_t *)((uint64_t *)old_block_metadata + align_offset);
   sli_memory_metadata_init(current_block_metadata);
-  align_offset = (size_t)((uint64_t *)current_block_metadata - (uint64_t *)old_block_metadata);
   sli_block_len_dword_encode(current_block_metadata, (sli_block_len_dword_decode(old_block_metadata) - align_offset));
 
-  size_t block_offset_prev_dw = sli_block_offset_prev_dword_decode(old_block_metadata) + align_offset;
-  sli_block_offset_prev_dword_encode(current_block_metadata, block_offset_prev_dw);
   if (sli_block_offset_prev_dword_decode(old_block_metadata) != 0) {
     sli_block_metadata_t *prev_block = (sli_block_metadata_t *)((uint64_t *)old_block_metadata - sli_block_offset_prev_dword_decode(old_block_metadata));
     size_t block_len_dw = sli_block_len_dword_decode(prev_block);
 
-    sli_block_offset_next_dword_encode(prev_block, sli_block_offset_prev_dword_decode(current_block_metadata));
-
-    // Merge lost space because of the alignment into the previous block. It helps to keep
-    // all computations in malloc()/free() valid. For ST split block, the lost space is back into
-    // a free block space.
-    sli_block_len_dword_encode(prev_block, (block_len_dw + align_offset));
+    if (sli_block_offset_next_dword_decode(prev_block) == (block_len_dw + SLI_BLOCK_METADATA_SIZE_DWORD)) {
+      // See Note #1.
+      sli_block_offset_prev_dword_encode(current_block_metadata, sli_block_offset_prev_dword_decode(old_block_metadata) + align_offset);
+      sli_block_offset_next_dword_encode(prev_block, sli_block_offset_prev_dword_decode(current_block_metadata));
+      if (prev_block->block_in_use) {
+        sli_block_len_dword_encode(prev_block, (block_len_dw + align_offset));
+        used_size_delta = SLI_BLOCK_LEN_DWORD_TO_BYTE(align_offset);
+      } else {
+        FREE_BINS_REMOVE(heap, prev_block);
+        sli_block_len_dword_encode(prev_block, (block_len_dw + align_offset));
+        FREE_BINS_INSERT(heap, prev_block);
+      }
+    } else {
+      // See Note #2.
+      sli_block_offset_prev_dword_encode(current_block_metadata, align_offset);
+      heap->free_blocks_number++;
+      *padding_free = true;
+
+      // One more metadata in heap. Its bank counter is decremented by the caller with the found block one.
+      used_size_delta = SLI_BLOCK_METADATA_SIZE_BYTE;
+      INCREMENT_BANK_COUNTER(heap, (uint8_t *)current_block_metadata, (uint8_t *)current_block_metadata + SLI_BLOCK_METADATA_SIZE_BYTE);
+    }
   } else {
     // Special case where the block data payload being aligned is at the heap start. A special flag in the block metadata
     // is used to identify this special block in sl_memory_free() and accordingly perform the merge with previous adjacent block.
+    // The metadata left at the heap start is flagged too and links to the aligned block. See sli_memory_get_first_block().
+    sli_block_offset_prev_dword_encode(current_block_metadata, align_offset);
     current_block_metadata->heap_start_align = true;
+    old_block_metadata->heap_start_align = true;
+    used_size_delta = SLI_BLOCK_LEN_DWORD_TO_BYTE(align_offset);
   }
 
   if (sli_block_offset_next_dword_decode(old_block_metadata) != 0) {
@@ -1495,10 +1632,19 @@ static sli_block_metadata_t *memory_manage_data_alignment(sl_memory_heap_t *heap
     sli_block_offset_next_dword_encode(current_block_metadata, 0);
   }
 
+  // The original metadata now only describes the space before the aligned block.
+  if (*padding_free || old_block_metadata->heap_start_align) {
+    sli_block_len_dword_encode(old_block_metadata, (align_offset - SLI_BLOCK_METADATA_SIZE_DWORD));
+    sli_block_offset_next_dword_encode(old_block_metadata, align_offset);
+    if (*padding_free) {
+      FREE_BINS_INSERT(heap, old_block_metadata);
+    }
+  }
+
 #if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
-  heap->used_size += SLI_BLOCK_LEN_DWORD_TO_BYTE(align_offset);
+  heap->used_size += used_size_delta;
 #else
-  (void) heap;
+  (void) used_size_delta;
 #endif
 
   return current_block_metadata;
@@ -0,0 +1,382 @@
+/***************************************************************************//**
+ * @file
+ * @brief Memory Manager Driver's Incremental Heap Integrity Check Implementation.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sl_memory_manager.h"
+#include "sli_memory_manager.h"
+
+#include "sl_assert.h"
+#include "sl_core.h"
+
+#if defined(SL_COMPONENT_CATALOG_PRESENT)
+#include "sl_component_catalog.h"
+#endif
+
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
+#include "sli_memory_profiler.h"
+#endif
+
+/*******************************************************************************
+ ***************************   LOCAL VARIABLES   *******************************
+ ******************************************************************************/
+
+// Check state of the general purpose heap.
+static sl_memory_heap_check_t heap_check;
+
+// Check handle of the last step, and heap generation when its cursor was saved.
+static const sl_memory_heap_check_t *last_check_handle = NULL;
+static uint32_t last_check_generation;
+
+#if defined(SLI_MEMORY_MANAGER_HEAP_CHECK_OWNERS)
+// Return address of the code that allocated a block of the general purpose heap.
+typedef struct {
+  const void *block;                    // Block address, NULL if the entry is free.
+  void *pc;                             // Return address of the caller.
+} heap_check_owner_t;
+
+// Owners of the general purpose heap blocks, indexed by block offset.
+static heap_check_owner_t heap_check_owners[SL_MEMORY_MANAGER_HEAP_CHECK_OWNER_COUNT];
+#endif
+
+/*******************************************************************************
+ *************************   LOCAL FUNCTION PROTOTYPES   ***********************
+ ******************************************************************************/
+
+static sli_block_metadata_t *check_block(const sl_memory_heap_t *heap,
+                                         sli_block_metadata_t *block,
+                                         bool *is_corrupted);
+
+static bool is_metadata_in_heap(const sl_memory_heap_t *heap,
+                                const void *block);
+
+#if defined(SLI_MEMORY_MANAGER_HEAP_CHECK_OWNERS)
+static heap_check_owner_t *get_owner_entry(const void *block);
+#endif
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Checks the integrity of the next blocks of the heap.
+ ******************************************************************************/
+sl_status_t sl_memory_check_heap_integrity_step(size_t block_count,
+                                                void **corrupted_block)
+{
+  return sl_memory_heap_check_integrity_step(&sli_general_purpose_heap,
+                                             &heap_check,
+                                             block_count,
+                                             corrupted_block);
+}
+
+/***************************************************************************//**
+ * Checks the integrity of the next blocks of a specific heap instance.
+ *
+ * @note (1) The check starts from the first block, which is not at the heap
+ *           start when its data payload was aligned. See
+ *           sli_memory_get_first_block().
+ *
+ * @note (2) The step's return address would only identify the code running
+ *           the check. The return address of the code that allocated the block
+ *           is the one recorded at allocation time, or NULL if its entry was
+ *           evicted by a newer block. The snapshot lets the analysis software
+ *           show the owners of the other blocks.
+ ******************************************************************************/
+sl_status_t sl_memory_heap_check_integrity_step(sl_memory_heap_t *heap,
+                                                sl_memory_heap_check_t *check_handle,
+                                                size_t block_count,
+                                                void **corrupted_block)
+{
+  sli_block_metadata_t *block;
+  sli_block_metadata_t *next_block;
+  bool is_corrupted = false;
+  CORE_DECLARE_IRQ_STATE;
+
+  // Make sure the heap handle isn't NULL.
+  EFM_ASSERT(heap != NULL);
+
+  if (check_handle == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  if (check_handle->corrupted_block == NULL) {
+    CORE_ENTER_ATOMIC();
+
+    // Restart from the heap start if blocks were split, merged or moved since
+    // this handle saved its cursor. See Note #1.
+    if ((check_handle->cursor == NULL)
+        || (check_handle != last_check_handle)
+        || (sli_memory_get_heap_generation() != last_check_generation)) {
+      check_handle->cursor = sli_memory_get_first_block(heap);
+      last_check_handle = check_handle;
+      last_check_generation = sli_memory_get_heap_generation();
+    }
+    block = (sli_block_metadata_t *)check_handle->cursor;
+
+    while ((block_count > 0) && (block != NULL)) {
+      next_block = check_block(heap, block, &is_corrupted);
+
+      if (is_corrupted) {
+        check_handle->corrupted_block = (uint8_t *)block + SLI_BLOCK_METADATA_SIZE_BYTE;
+        break;
+      }
+
+      block = next_block;
+      block_count--;
+    }
+
+    if (!is_corrupted) {
+      if (block == NULL) {
+        check_handle->pass_count++;
+      }
+      check_handle->cursor = block;
+    }
+
+    CORE_EXIT_ATOMIC();
+
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
+    if (is_corrupted) {
+      // See Note #2.
+      const uint32_t *metadata = (const uint32_t *)block;
+      void *owner = NULL;
+
+#if defined(SLI_MEMORY_MANAGER_HEAP_CHECK_OWNERS)
+      if (heap == &sli_general_purpose_heap) {
+        const heap_check_owner_t *entry = get_owner_entry(check_handle->corrupted_block);
+
+        if (entry->block == check_handle->corrupted_block) {
+          owner = entry->pc;
+        }
+      }
+#endif
+
+      sli_memory_profiler_log(SLI_MEMORY_MANAGER_LOG_ID_HEAP_CORRUPTED,
+                              (uint32_t)(uintptr_t)check_handle->corrupted_block,
+                              metadata[0],
+                              metadata[1],
+                              owner);
+      sli_memory_profiler_take_snapshot("heap corrupted");
+    }
+#endif
+  }
+
+  if (corrupted_block != NULL) {
+    *corrupted_block = check_handle->corrupted_block;
+  }
+
+  return (check_handle->corrupted_block == NULL) ? SL_STATUS_OK : SL_STATUS_FAIL;
+}
+
+/***************************************************************************//**
+ * Power Manager hook called before the system goes to sleep.
+ ******************************************************************************/
+bool sli_memory_manager_is_ok_to_sleep(void)
+{
+#if defined(SL_MEMORY_MANAGER_HEAP_CHECK_SLEEP_BLOCK_COUNT) && (SL_MEMORY_MANAGER_HEAP_CHECK_SLEEP_BLOCK_COUNT > 0)
+  (void)sl_memory_check_heap_integrity_step(SL_MEMORY_MANAGER_HEAP_CHECK_SLEEP_BLOCK_COUNT, NULL);
+#endif
+
+  return true;
+}
+
+#if defined(SLI_MEMORY_MANAGER_HEAP_CHECK_OWNERS)
+/***************************************************************************//**
+ * Records the return address of the code that allocated a heap block.
+ ******************************************************************************/
+void sli_memory_heap_check_record_owner(const sl_memory_heap_t *heap,
+                                        const void *block,
+                                        void *pc)
+{
+  heap_check_owner_t *entry;
+  CORE_DECLARE_IRQ_STATE;
+
+  if ((heap != &sli_general_purpose_heap) || (block == NULL)) {
+    return;
+  }
+
+  entry = get_owner_entry(block);
+
+  CORE_ENTER_ATOMIC();
+  entry->block = block;
+  entry->pc = pc;
+  CORE_EXIT_ATOMIC();
+}
+
+/***************************************************************************//**
+ * Replaces the recorded return address of a heap block.
+ ******************************************************************************/
+void sli_memory_heap_check_update_owner(const void *block,
+                                        void *pc)
+{
+  heap_check_owner_t *entry;
+  CORE_DECLARE_IRQ_STATE;
+
+  if ((block == NULL)
+      || !is_metadata_in_heap(&sli_general_purpose_heap, (const uint8_t *)block - SLI_BLOCK_METADATA_SIZE_BYTE)) {
+    return;
+  }
+
+  entry = get_owner_entry(block);
+
+  CORE_ENTER_ATOMIC();
+  if (entry->block == block) {
+    entry->pc = pc;
+  }
+  CORE_EXIT_ATOMIC();
+}
+
+/***************************************************************************//**
+ * Forgets the return address recorded for a heap block being freed.
+ ******************************************************************************/
+void sli_memory_heap_check_clear_owner(const sl_memory_heap_t *heap,
+                                       const void *block)
+{
+  heap_check_owner_t *entry;
+  CORE_DECLARE_IRQ_STATE;
+
+  if ((heap != &sli_general_purpose_heap) || (block == NULL)) {
+    return;
+  }
+
+  entry = get_owner_entry(block);
+
+  CORE_ENTER_ATOMIC();
+  if (entry->block == block) {
+    entry->block = NULL;
+  }
+  CORE_EXIT_ATOMIC();
+}
+#endif
+
+/*******************************************************************************
+ ***************************   LOCAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Checks the metadata of a block against the heap bounds and against the
+ * metadata of its next neighbour.
+ *
+ * @param[in]  heap          Heap handle.
+ * @param[in]  block         Pointer to the block metadata.
+ * @param[out] is_corrupted  Set to true if the block metadata is not valid.
+ *
+ * @return  Pointer to the next block metadata, NULL if the block is the last
+ *          one of the heap.
+ *
+ * @note (1) A gap between the end of a block and its next neighbour is made of
+ *           reserved blocks, which have no metadata.
+ ******************************************************************************/
+static sli_block_metadata_t *check_block(const sl_memory_heap_t *heap,
+                                         sli_block_metadata_t *block,
+                                         bool *is_corrupted)
+{
+  uintptr_t heap_end = (uintptr_t)heap->base_addr + heap->size;
+  uint32_t block_len_dw;
+  uint32_t offset_next_dw;
+  sli_block_metadata_t *next_block;
+
+  *is_corrupted = true;
+
+  if (!is_metadata_in_heap(heap, block)) {
+    return NULL;
+  }
+
+  block_len_dw = sli_block_len_dword_decode(block);
+  offset_next_dw = sli_block_offset_next_dword_decode(block);
+
+  if (block_len_dw == 0) {
+    return NULL;
+  }
+
+  // Last block: its data payload must end within the heap.
+  if (offset_next_dw == 0) {
+    if (SLI_BLOCK_LEN_DWORD_TO_BYTE(block_len_dw) > (heap_end - (uintptr_t)block - SLI_BLOCK_METADATA_SIZE_BYTE)) {
+      return NULL;
+    }
+    *is_corrupted = false;
+    return NULL;
+  }
+
+  // See Note #1.
+  if (offset_next_dw < (block_len_dw + SLI_BLOCK_METADATA_SIZE_DWORD)) {
+    return NULL;
+  }
+
+  next_block = (sli_block_metadata_t *)((uint64_t *)block + offset_next_dw);
+  if (!is_metadata_in_heap(heap, next_block)) {
+    return NULL;
+  }
+
+  // The implicit double linked-list must be consistent.
+  *is_corrupted = (sli_block_offset_prev_dword_decode(next_block) != offset_next_dw);
+
+  return next_block;
+}
+
+/***************************************************************************//**
+ * Checks that a block metadata is aligned and fully within the heap.
+ *
+ * @param[in]  heap   Heap handle.
+ * @param[in]  block  Pointer to the block metadata.
+ *
+ * @return  true if the block metadata is within the heap, false otherwise.
+ ******************************************************************************/
+static bool is_metadata_in_heap(const sl_memory_heap_t *heap,
+                                const void *block)
+{
+  uintptr_t heap_start = (uintptr_t)heap->base_addr;
+  uintptr_t heap_end = heap_start + heap->size;
+
+  return SLI_ADDR_IS_ALIGNED(block, SLI_WORD_SIZE_64)
+         && ((uintptr_t)block >= heap_start)
+         && ((uintptr_t)block <= (heap_end - SLI_BLOCK_METADATA_SIZE_BYTE));
+}
+
+#if defined(SLI_MEMORY_MANAGER_HEAP_CHECK_OWNERS)
+/***************************************************************************//**
+ * Gets the owner table entry of a block of the general purpose heap.
+ *
+ * @param[in]  block  Block address, as returned to the caller.
+ *
+ * @return  Pointer to the entry, which may hold another block.
+ *
+ * @note Blocks are at least one double word apart, so consecutive blocks use
+ *       different entries.
+ ******************************************************************************/
+static heap_check_owner_t *get_owner_entry(const void *block)
+{
+  uintptr_t offset_dw = ((uintptr_t)block - (uintptr_t)sli_general_purpose_heap.base_addr) / SLI_WORD_SIZE_64;
+
+  return &heap_check_owners[offset_dw % SL_MEMORY_MANAGER_HEAP_CHECK_OWNER_COUNT];
+}
+#endif
@@ -38,10 +38,14 @@
 #include "sl_component_catalog.h"
 #endif
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
 #include "sli_memory_profiler.h"
 #endif
 
+#if defined(SLI_MEMORY_MANAGER_SIZE_CLASS_POOLS)
+#include <string.h>
+#endif
+
 /*******************************************************************************
  *********************************   DEFINES   *********************************
  ******************************************************************************/
@@ -49,6 +53,104 @@
 #define SLI_MEM_POOL_OUT_OF_MEMORY     0xFFFFFFFF
 #define SLI_MEM_POOL_REQUIRED_PADDING(obj_size) (((sizeof(size_t) - ((obj_size) % sizeof(size_t))) % sizeof(size_t)))
 
+/*******************************************************************************
+ ***************************   LOCAL VARIABLES   *******************************
+ ******************************************************************************/
+
+#if defined(SLI_MEMORY_MANAGER_SIZE_CLASS_POOLS)
+// Size-class pools, indexed by size class. A pool is created when its block
+// address is still NULL.
+static sl_memory_pool_t size_class_pools[SLI_SIZE_CLASS_COUNT];
+#endif
+
+#if defined(SL_MEMORY_MANAGER_LOCK_FREE_POOLS_ENABLE) && (SL_MEMORY_MANAGER_LOCK_FREE_POOLS_ENABLE == 1)
+#include <stdatomic.h>
+
+#if (ATOMIC_POINTER_LOCK_FREE != 2)
+#error "Lock-free memory pools require a CPU with exclusive load/store instructions."
+#endif
+
+#define SLI_MEM_POOL_LOCK_FREE
+
+// In lock-free pools, the free list links are block indexes and the block_free
+// field of the pool handle holds a tagged head: the index of the first free
+// block in the lower bits and a tag in the upper bits. The tag is incremented
+// by every successful update of the head, so a compare-and-swap based on a
+// stale head fails even if the same block index is back at the head (ABA).
+#define SLI_MEM_POOL_INDEX_MASK        0xFFFFu
+#define SLI_MEM_POOL_INDEX_END         SLI_MEM_POOL_INDEX_MASK
+#define SLI_MEM_POOL_TAG_INCREMENT     ((uintptr_t)SLI_MEM_POOL_INDEX_MASK + 1u)
+#define SLI_MEM_POOL_NEXT_HEAD(head, index) \
+  ((((head) & ~(uintptr_t)SLI_MEM_POOL_INDEX_MASK) + SLI_MEM_POOL_TAG_INCREMENT) | (uintptr_t)(index))
+
+// Tagged head stored in place of the free list pointer, which keeps the pool
+// handle layout identical to the default pools.
+#define SLI_MEM_POOL_HEAD(pool_handle)  ((_Atomic uintptr_t *)(void *)&(pool_handle)->block_free)
+
+// Free list link stored in the first word of a free block.
+#define SLI_MEM_POOL_LINK(block)        ((_Atomic uintptr_t *)(void *)(block))
+
+/*******************************************************************************
+ ***************************   LOCAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Pops the first free block of a lock-free pool.
+ *
+ * @param[in] pool_handle  Handle to the memory pool.
+ *
+ * @return  Address of the block, or NULL if the pool is empty.
+ *
+ * @note The link read from the head block may be stale if another context
+ *       allocates that block concurrently and writes into it. The head tag
+ *       then differs and the compare-and-swap is retried.
+ ******************************************************************************/
+static void *pool_lock_free_pop(sl_memory_pool_t *pool_handle)
+{
+  _Atomic uintptr_t *head_ptr = SLI_MEM_POOL_HEAD(pool_handle);
+  uintptr_t head = atomic_load_explicit(head_ptr, memory_order_acquire);
+  uintptr_t next;
+  uint8_t *block_addr;
+
+  do {
+    if ((head & SLI_MEM_POOL_INDEX_MASK) == SLI_MEM_POOL_INDEX_END) {
+      return NULL;
+    }
+    block_addr = (uint8_t *)pool_handle->block_address + ((head & SLI_MEM_POOL_INDEX_MASK) * pool_handle->block_size);
+    next = atomic_load_explicit(SLI_MEM_POOL_LINK(block_addr), memory_order_relaxed);
+  } while (!atomic_compare_exchange_weak_explicit(head_ptr,
+                                                  &head,
+                                                  SLI_MEM_POOL_NEXT_HEAD(head, next & SLI_MEM_POOL_INDEX_MASK),
+                                                  memory_order_acquire,
+                                                  memory_order_acquire));
+
+  return block_addr;
+}
+
+/***************************************************************************//**
+ * Pushes a block on the free list of a lock-free pool.
+ *
+ * @param[in] pool_handle  Handle to the memory pool.
+ *
+ * @param[in] block        Address of the block, within the pool payload range.
+ ******************************************************************************/
+static void pool_lock_free_push(sl_memory_pool_t *pool_handle,
+                                void *block)
+{
+  _Atomic uintptr_t *head_ptr = SLI_MEM_POOL_HEAD(pool_handle);
+  uintptr_t index = ((uintptr_t)block - (uintptr_t)pool_handle->block_address) / pool_handle->block_size;
+  uintptr_t head = atomic_load_explicit(head_ptr, memory_order_relaxed);
+
+  do {
+    atomic_store_explicit(SLI_MEM_POOL_LINK(block), head & SLI_MEM_POOL_INDEX_MASK, memory_order_relaxed);
+  } while (!atomic_compare_exchange_weak_explicit(head_ptr,
+                                                  &head,
+                                                  SLI_MEM_POOL_NEXT_HEAD(head, index),
+                                                  memory_order_release,
+                                                  memory_order_relaxed));
+}
+#endif
+
 /***************************************************************************//**
  * Creates a memory pool.
  ******************************************************************************/
@@ -79,7 +181,7 @@ sl_status_t sl_memory_delete_pool(sl_memory_pool_t *pool_handle)
     return SL_STATUS_INVALID_STATE;
   }
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   // Delete the memory tracker
   sli_memory_profiler_delete_tracker(pool_handle);
 #endif
@@ -96,10 +198,12 @@ sl_status_t sl_memory_delete_pool(sl_memory_pool_t *pool_handle)
 sl_status_t sl_memory_pool_alloc(sl_memory_pool_t *pool_handle,
                                  void **block)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
+#if !defined(SLI_MEM_POOL_LOCK_FREE)
   CORE_DECLARE_IRQ_STATE;
+#endif
 
   if ((pool_handle == NULL) || (block == NULL)) {
     return SL_STATUS_NULL_POINTER;
@@ -108,11 +212,21 @@ sl_status_t sl_memory_pool_alloc(sl_memory_pool_t *pool_handle,
   // No block allocated yet.
   *block = NULL;
 
+#if defined(SLI_MEM_POOL_LOCK_FREE)
+  void *block_addr = pool_lock_free_pop(pool_handle);
+
+  if (block_addr == NULL) {
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
+    sli_memory_profiler_track_alloc_with_ownership(pool_handle, NULL, pool_handle->block_size, return_address);
+#endif
+    return SL_STATUS_EMPTY;
+  }
+#else
   CORE_ENTER_ATOMIC();
 
   if ((size_t)pool_handle->block_free == SLI_MEM_POOL_OUT_OF_MEMORY) {
     CORE_EXIT_ATOMIC();
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
     sli_memory_profiler_track_alloc_with_ownership(pool_handle, NULL, pool_handle->block_size, return_address);
 #endif
     return SL_STATUS_EMPTY;
@@ -125,8 +239,9 @@ sl_status_t sl_memory_pool_alloc(sl_memory_pool_t *pool_handle,
   pool_handle->block_free = (void *)*(size_t *)block_addr;
 
   CORE_EXIT_ATOMIC();
+#endif
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_alloc_with_ownership(pool_handle, block_addr, pool_handle->block_size, return_address);
 #endif
 
@@ -141,7 +256,9 @@ sl_status_t sl_memory_pool_alloc(sl_memory_pool_t *pool_handle,
 sl_status_t sl_memory_pool_free(sl_memory_pool_t *pool_handle,
                                 void *block)
 {
+#if !defined(SLI_MEM_POOL_LOCK_FREE)
   CORE_DECLARE_IRQ_STATE;
+#endif
 
   if ((pool_handle == NULL) || (block == NULL)) {
     return SL_STATUS_NULL_POINTER;
@@ -152,10 +269,13 @@ sl_status_t sl_memory_pool_free(sl_memory_pool_t *pool_handle,
     return SL_STATUS_INVALID_PARAMETER;
   }
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_free(pool_handle, block);
 #endif
 
+#if defined(SLI_MEM_POOL_LOCK_FREE)
+  pool_lock_free_push(pool_handle, block);
+#else
   CORE_ENTER_ATOMIC();
 
   // Save the current free block address in this block.
@@ -163,6 +283,7 @@ sl_status_t sl_memory_pool_free(sl_memory_pool_t *pool_handle,
   pool_handle->block_free = block;
 
   CORE_EXIT_ATOMIC();
+#endif
 
   return SL_STATUS_OK;
 }
@@ -180,6 +301,24 @@ uint32_t sl_memory_pool_get_free_block_count(const sl_memory_pool_t *pool_handle
   }
 
   CORE_DECLARE_IRQ_STATE;
+
+#if defined(SLI_MEM_POOL_LOCK_FREE)
+  uintptr_t index;
+
+  // Lock-free pools can be used from interrupts of any priority, so the list
+  // is walked in a critical section. The walk is bounded in case a link was
+  // overwritten.
+  CORE_ENTER_CRITICAL();
+
+  index = atomic_load_explicit(SLI_MEM_POOL_HEAD(pool_handle), memory_order_acquire) & SLI_MEM_POOL_INDEX_MASK;
+  while ((index != SLI_MEM_POOL_INDEX_END) && (free_block_count < pool_handle->block_count)) {
+    free_block = (uint32_t *)((uint8_t *)pool_handle->block_address + (index * pool_handle->block_size));
+    index = atomic_load_explicit(SLI_MEM_POOL_LINK(free_block), memory_order_relaxed) & SLI_MEM_POOL_INDEX_MASK;
+    free_block_count++;
+  }
+
+  CORE_EXIT_CRITICAL();
+#else
   CORE_ENTER_ATOMIC();
 
   free_block = pool_handle->block_free;
@@ -191,6 +330,7 @@ uint32_t sl_memory_pool_get_free_block_count(const sl_memory_pool_t *pool_handle
   }
 
   CORE_EXIT_ATOMIC();
+#endif
 
   return free_block_count;
 }
@@ -203,7 +343,7 @@ sl_status_t sl_memory_heap_create_pool(sl_memory_heap_t *heap,
                                        uint32_t block_count,
                                        sl_memory_pool_t *pool_handle)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   sl_status_t status = SL_STATUS_OK;
@@ -222,6 +362,13 @@ sl_status_t sl_memory_heap_create_pool(sl_memory_heap_t *heap,
     return SL_STATUS_NULL_POINTER;
   }
 
+#if defined(SLI_MEM_POOL_LOCK_FREE)
+  // The last index value marks the end of the free list.
+  if (block_count >= SLI_MEM_POOL_INDEX_END) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+#endif
+
   // SLI_MEM_POOL_REQUIRED_PADDING Rounds up to the nearest platform-dependant size. On a 32-bit processor,
   // it will be rounded-up to 4 bytes. E.g. 101 bytes will be rounded up to 104 bytes.
   pool_handle->block_size = block_size + (uint16_t)SLI_MEM_POOL_REQUIRED_PADDING(block_size);
@@ -232,7 +379,7 @@ sl_status_t sl_memory_heap_create_pool(sl_memory_heap_t *heap,
   pool_size = pool_handle->block_size * pool_handle->block_count;
   status = sl_memory_heap_alloc(heap, pool_size, BLOCK_TYPE_LONG_TERM, (void **)&block);
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, block, return_address);
 #endif
 
@@ -240,7 +387,7 @@ sl_status_t sl_memory_heap_create_pool(sl_memory_heap_t *heap,
     return status;
   }
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   // Create the tracker for the pool with no description. The code that created
   // the pool can add the tracker description if relevant.
   sli_memory_profiler_create_pool_tracker(pool_handle, NULL, block, pool_size);
@@ -251,6 +398,19 @@ sl_status_t sl_memory_heap_create_pool(sl_memory_heap_t *heap,
   // Returned block pointer not used because its reference is already stored in block_address.
   (void)&block;
 
+#if defined(SLI_MEM_POOL_LOCK_FREE)
+  block_addr = (size_t)pool_handle->block_address;
+
+  // Link every block to the next one by index. The last block ends the list.
+  for (uint16_t i = 0; i < block_count; i++) {
+    *(uintptr_t *)block_addr = (i < (block_count - 1)) ? (uintptr_t)i + 1u : SLI_MEM_POOL_INDEX_END;
+    block_addr += pool_handle->block_size;
+  }
+
+  atomic_store_explicit(SLI_MEM_POOL_HEAD(pool_handle), 0u, memory_order_release);
+
+  return status;
+#else
   pool_handle->block_free = (uint32_t *)pool_handle->block_address;
 
   block_addr = (size_t)pool_handle->block_address;
@@ -265,4 +425,139 @@ sl_status_t sl_memory_heap_create_pool(sl_memory_heap_t *heap,
   *(size_t *)block_addr = SLI_MEM_POOL_OUT_OF_MEMORY;
 
   return status;
+#endif
 }
+
+#if defined(SLI_MEMORY_MANAGER_SIZE_CLASS_POOLS)
+/***************************************************************************//**
+ * Allocates a block from the size-class pool matching a requested size.
+ *
+ * @note (1) The pool is created in an atomic section so that two contexts
+ *           cannot both create it. If the heap cannot hold the pool, creation
+ *           is retried at the next request of the same size class.
+ ******************************************************************************/
+void *sli_memory_size_class_alloc(size_t size)
+{
+  sl_memory_pool_t *pool_handle;
+  void *block = NULL;
+
+  if ((size == 0) || (size > SLI_SIZE_CLASS_MAX_SIZE_BYTE)) {
+    return NULL;
+  }
+
+  pool_handle = &size_class_pools[(size - 1u) / SLI_SIZE_CLASS_STEP_BYTE];
+
+  if (pool_handle->block_address == NULL) {
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    if (pool_handle->block_address == NULL) { // See Note #1.
+      (void)sl_memory_heap_create_pool(&sli_general_purpose_heap,
+                                       (((size - 1u) / SLI_SIZE_CLASS_STEP_BYTE) + 1u) * SLI_SIZE_CLASS_STEP_BYTE,
+                                       SL_MEMORY_MANAGER_SIZE_CLASS_POOL_BLOCK_COUNT,
+                                       pool_handle);
+    }
+    CORE_EXIT_ATOMIC();
+
+    if (pool_handle->block_address == NULL) {
+      return NULL;
+    }
+  }
+
+  (void)sl_memory_pool_alloc(pool_handle, &block);
+
+  return block;
+}
+
+/***************************************************************************//**
+ * Gets the size-class pool that contains a block.
+ ******************************************************************************/
+sl_memory_pool_t *sli_memory_size_class_get_pool(const void *block)
+{
+  for (uint32_t ix = 0; ix < SLI_SIZE_CLASS_COUNT; ix++) {
+    const sl_memory_pool_t *pool_handle = &size_class_pools[ix];
+    uintptr_t pool_start = (uintptr_t)pool_handle->block_address;
+
+    if ((pool_start != 0)
+        && ((uintptr_t)block >= pool_start)
+        && ((uintptr_t)block < (pool_start + (pool_handle->block_size * pool_handle->block_count)))) {
+      return &size_class_pools[ix];
+    }
+  }
+
+  return NULL;
+}
+
+/***************************************************************************//**
+ * Resizes a block allocated from a size-class pool.
+ *
+ * @note (1) The requested size of the original block is not known, so the
+ *           whole pool block is copied. It is never larger than the new size.
+ ******************************************************************************/
+sl_status_t sli_memory_size_class_realloc(sl_memory_pool_t *pool_handle,
+                                          void *ptr,
+                                          size_t size,
+                                          void **block)
+{
+  sl_status_t status = SL_STATUS_OK;
+  void *new_block;
+
+  // The block already has room for the new size.
+  if (size <= pool_handle->block_size) {
+    *block = ptr;
+    return SL_STATUS_OK;
+  }
+
+  new_block = sli_memory_size_class_alloc(size);
+  if (new_block == NULL) {
+    status = sl_memory_heap_alloc(&sli_general_purpose_heap, size, BLOCK_TYPE_LONG_TERM, &new_block);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+  }
+
+  memcpy(new_block, ptr, pool_handle->block_size); // See Note #1.
+  (void)sl_memory_pool_free(pool_handle, ptr);
+
+  *block = new_block;
+
+  return status;
+}
+
+#if defined(SLI_MEMORY_MANAGER_ENABLE_TEST_UTILITIES)
+/***************************************************************************//**
+ * Deletes the size-class pools so that the heap can be checked back to its
+ * initial state. A pool is created again at the next request of its size class.
+ *
+ * @note (1) The pool is detached before its block is freed, otherwise
+ *           sl_memory_free() would return the block to the pool itself.
+ ******************************************************************************/
+sl_status_t sli_memory_size_class_delete_pools(void)
+{
+  sl_status_t status;
+
+  for (uint32_t ix = 0; ix < SLI_SIZE_CLASS_COUNT; ix++) {
+    sl_memory_pool_t *pool_handle = &size_class_pools[ix];
+    void *block_address = pool_handle->block_address;
+
+    if (block_address == NULL) {
+      continue;
+    }
+    if (sl_memory_pool_get_free_block_count(pool_handle) != pool_handle->block_count) {
+      return SL_STATUS_INVALID_STATE;
+    }
+
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
+    sli_memory_profiler_delete_tracker(pool_handle);
+#endif
+
+    pool_handle->block_address = NULL; // See Note #1.
+    status = sl_memory_free(block_address);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+  }
+
+  return SL_STATUS_OK;
+}
+#endif
+#endif
@@ -29,12 +29,13 @@
  ******************************************************************************/
 
 #include "sl_memory_manager.h"
+#include "sli_memory_manager.h"
 
 #if defined(SL_COMPONENT_CATALOG_PRESENT)
 #include "sl_component_catalog.h"
 #endif
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
 #include "sli_memory_profiler.h"
 #endif
 
@@ -47,7 +48,7 @@
  ******************************************************************************/
 sl_status_t sl_memory_pool_handle_alloc(sl_memory_pool_t **pool_handle)
 {
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   void * volatile return_address = sli_memory_profiler_get_return_address();
 #endif
   sl_status_t status;
@@ -55,7 +56,7 @@ sl_status_t sl_memory_pool_handle_alloc(sl_memory_pool_t **pool_handle)
   // Allocate pool_handle as a long-term block.
   status = sl_memory_alloc(sizeof(sl_memory_pool_t), BLOCK_TYPE_LONG_TERM, (void **)pool_handle);
 
-#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT)
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS)
   sli_memory_profiler_track_ownership(SLI_INVALID_MEMORY_TRACKER_HANDLE, *pool_handle, return_address);
 #endif
 
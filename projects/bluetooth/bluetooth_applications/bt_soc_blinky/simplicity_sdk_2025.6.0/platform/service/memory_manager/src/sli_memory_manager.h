@@ -34,6 +34,7 @@
 #include <stdbool.h>
 
 #include "em_device.h"
+#include "sl_memory_manager_config.h"
 #include "sl_memory_manager.h"
 
 #if defined(SL_COMPONENT_CATALOG_PRESENT)
@@ -54,6 +55,14 @@ extern "C" {
 #define SLI_MEMORY_MANAGER_ENABLE_SYSTEMVIEW
 #endif
 
+// Memory Profiler hooks are called when the Memory Profiler is included, or
+// when the allocation trace recorder implemented behind the profiler stubs is
+// enabled
+#if defined(SL_CATALOG_MEMORY_PROFILER_PRESENT) \
+  || (defined(SL_MEMORY_MANAGER_TRACE_RECORDER_ENABLE) && (SL_MEMORY_MANAGER_TRACE_RECORDER_ENABLE == 1))
+#define SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS
+#endif
+
 // Minimum block alignment in bytes. 8 bytes is the minimum alignment to account for largest CPU data type
 // that can be used in some block allocation scenarios. 64-bit data type may be used to manipulate the
 // allocated block. The ARM processor ABI defines data types and byte alignment, and 8-byte alignment
@@ -106,6 +115,66 @@ extern "C" {
 // Size of pool block metadata.
 #define SLI_MEMORY_POOL_BLOCK_METADATA_SIZE_BYTE   sizeof(sli_memory_pool_block_t)
 
+// Segregated free lists. Free blocks are indexed in bins by payload length (in double words). The
+// first level splits lengths by power of two, the second level splits each power of two range in
+// SLI_FREE_BINS_SL_COUNT linear classes. Lengths below SLI_FREE_BINS_SL_COUNT map to first level 0.
+#if defined(SL_MEMORY_MANAGER_SEGREGATED_FREE_LISTS_ENABLE) && (SL_MEMORY_MANAGER_SEGREGATED_FREE_LISTS_ENABLE == 1)
+#define SLI_MEMORY_MANAGER_FREE_BINS
+
+#if defined(SL_CATALOG_BANK_RETENTION_CONTROL_PRESENT)
+#error "Segregated free lists are not supported with RAM bank retention control."
+#endif
+
+#define SLI_FREE_BINS_SL_LOG2   2u
+#define SLI_FREE_BINS_SL_COUNT  (1u << SLI_FREE_BINS_SL_LOG2)
+#if defined(SLI_LARGE_BLOCK_SUPPORT)
+#define SLI_FREE_BINS_LEN_BITS  20u
+#else
+#define SLI_FREE_BINS_LEN_BITS  16u
+#endif
+#define SLI_FREE_BINS_FL_COUNT  (SLI_FREE_BINS_LEN_BITS - SLI_FREE_BINS_SL_LOG2 + 1u)
+#endif
+
+// Size-class pools. Small sl_malloc() and sl_calloc() requests are served from
+// memory pools of SLI_SIZE_CLASS_STEP_BYTE, 2 * SLI_SIZE_CLASS_STEP_BYTE, ...
+// bytes blocks, created from the heap on first use.
+#if defined(SL_MEMORY_MANAGER_SIZE_CLASS_POOLS_ENABLE) && (SL_MEMORY_MANAGER_SIZE_CLASS_POOLS_ENABLE == 1)
+#define SLI_MEMORY_MANAGER_SIZE_CLASS_POOLS
+
+#define SLI_SIZE_CLASS_STEP_BYTE      16u
+#define SLI_SIZE_CLASS_COUNT          4u
+#define SLI_SIZE_CLASS_MAX_SIZE_BYTE  (SLI_SIZE_CLASS_STEP_BYTE * SLI_SIZE_CLASS_COUNT)
+#endif
+
+// Automatic RAM retention shrinking. The heap RAM banks that hold no data to retain are not
+// retained in EM2.
+#if defined(SL_MEMORY_MANAGER_RAM_RETENTION_SHRINK_ENABLE) && (SL_MEMORY_MANAGER_RAM_RETENTION_SHRINK_ENABLE == 1)
+#define SLI_MEMORY_MANAGER_RAM_RETENTION_SHRINK
+
+#if defined(SL_CATALOG_BANK_RETENTION_CONTROL_PRESENT)
+#error "RAM retention shrinking is not supported with RAM bank retention control."
+#endif
+
+#if !defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+#error "RAM retention shrinking requires the Power Manager."
+#endif
+
+#if !defined(_SYSCFG_DMEM0RETNCTRL_MASK) || !defined(DMEM_NUM_BANKS) || (DMEM_NUM_BANKS > 8)
+#error "RAM retention shrinking is not supported on this device."
+#endif
+#endif
+
+// Memory profiler log identifier of a corrupted heap block found by the incremental
+// integrity check. Arguments are the block address and the two metadata words.
+#define SLI_MEMORY_MANAGER_LOG_ID_HEAP_CORRUPTED  0x4D4D0001u
+
+// Return addresses of the code that allocated the blocks of the general purpose
+// heap, reported in the log event of a corrupted block.
+#if defined(SLI_MEMORY_MANAGER_ENABLE_PROFILER_HOOKS) \
+  && defined(SL_MEMORY_MANAGER_HEAP_CHECK_OWNER_COUNT) && (SL_MEMORY_MANAGER_HEAP_CHECK_OWNER_COUNT > 0)
+#define SLI_MEMORY_MANAGER_HEAP_CHECK_OWNERS
+#endif
+
 #ifdef SLI_MEMORY_MANAGER_ENABLE_TEST_UTILITIES
 #define SLI_MAX_RESERVATION_COUNT 32
 #endif
@@ -143,6 +212,24 @@ extern "C" {
 #define DECREMENT_BANK_COUNTER(heap, start_addr, end_addr)
 #endif
 
+#if defined(SLI_MEMORY_MANAGER_FREE_BINS)
+#define FREE_BINS_INSERT(heap, block) sli_memory_free_bins_insert(heap, block)
+#define FREE_BINS_REMOVE(heap, block) sli_memory_free_bins_remove(heap, block)
+#else
+#define FREE_BINS_INSERT(heap, block)
+#define FREE_BINS_REMOVE(heap, block)
+#endif
+
+#if defined(SLI_MEMORY_MANAGER_HEAP_CHECK_OWNERS)
+#define HEAP_CHECK_RECORD_OWNER(heap, block, pc) sli_memory_heap_check_record_owner(heap, block, pc)
+#define HEAP_CHECK_UPDATE_OWNER(block, pc)       sli_memory_heap_check_update_owner(block, pc)
+#define HEAP_CHECK_CLEAR_OWNER(heap, block)      sli_memory_heap_check_clear_owner(heap, block)
+#else
+#define HEAP_CHECK_RECORD_OWNER(heap, block, pc)
+#define HEAP_CHECK_UPDATE_OWNER(block, pc)
+#define HEAP_CHECK_CLEAR_OWNER(heap, block)
+#endif
+
 /*******************************************************************************
  *********************************   TYPEDEF   *********************************
  ******************************************************************************/
@@ -159,6 +246,7 @@ extern "C" {
 typedef struct {
   uint16_t block_in_use : 1;              // Flag indicating if block allocated or not.
   uint16_t heap_start_align : 1;          // Flag indicating if first block at heap start undergone a data payload adjustment.
+                                          // Also set on the heap start metadata, which then links to the first block.
   uint16_t block_type : 1;                // Block type (LT or ST). Used only with SLI_MEMORY_MANAGER_ENABLE_SYSTEMVIEW.
   uint16_t reserved : 1;                  // Unallocated for future usage.
   uint16_t length_msb : 4;                // MSBs of field "length" for blocks larger than 512 KB.
@@ -169,6 +257,23 @@ typedef struct {
   uint16_t offset_neighbour_next;         // Offset to next neighbor, in double words.
 } sli_block_metadata_t;
 
+#if defined(SLI_MEMORY_MANAGER_FREE_BINS)
+// Links of a free block in its bin. Stored at the start of the free block data payload, which is
+// at least one double word long. Links are offsets from the heap base so that they fit in a double
+// word whatever the pointer size. Bins are circular lists: the bin head's 'prev' is the bin tail.
+typedef struct {
+  uint32_t offset_next;                   // Offset to next free block in the same bin, in double words.
+  uint32_t offset_prev;                   // Offset to previous free block in the same bin, in double words.
+} sli_free_block_link_t;
+
+// Segregated free lists index of a heap.
+typedef struct {
+  uint32_t fl_bitmap;                                                       // Bit set for each first level with a non-empty bin.
+  uint32_t sl_bitmap[SLI_FREE_BINS_FL_COUNT];                               // Bit set for each non-empty second level bin.
+  sli_block_metadata_t *bins[SLI_FREE_BINS_FL_COUNT][SLI_FREE_BINS_SL_COUNT]; // Bin heads.
+} sli_memory_free_bins_t;
+#endif
+
 /// @brief Pool free count list structure.
 struct sli_memory_pool_free_cnt_entry {
   uint16_t free_cnt;                      ///< The number of free blocks available in this free count entry.
@@ -195,9 +300,9 @@ struct sli_memory_pool_block {
  ******************************************************************************/
 
 extern sl_memory_heap_t sli_general_purpose_heap;
+extern uint32_t reserve_no_retention_size;
 #if defined(DEBUG_EFM) || defined(DEBUG_EFM_USER)
 extern bool reserve_no_retention_first;
-extern uint32_t reserve_no_retention_size;
 #endif
 
 #if defined(SLI_MEMORY_MANAGER_ENABLE_TEST_UTILITIES)
@@ -223,6 +328,44 @@ extern const char sli_mm_heap_reservation_name[];
  ******************************************************************************/
 void sli_memory_metadata_init(sli_block_metadata_t *block_metadata);
 
+/***************************************************************************//**
+ * Gets the first block of a heap.
+ *
+ * @param[in] heap  Heap handle.
+ *
+ * @return    Pointer to the first block metadata.
+ ******************************************************************************/
+sli_block_metadata_t *sli_memory_get_first_block(const sl_memory_heap_t *heap);
+
+/***************************************************************************//**
+ * Gets the heap generation.
+ *
+ * @return    Generation, incremented each time the blocks list of a heap may
+ *            change.
+ *
+ * @note The generation is kept outside of the heap handle, and is shared by
+ *       all the heaps. A change in any heap invalidates the state saved for
+ *       the others, which is only conservative.
+ ******************************************************************************/
+uint32_t sli_memory_get_heap_generation(void);
+
+/***************************************************************************//**
+ * Increments the heap generation. Must be called in a critical section, before
+ * the blocks list of a heap changes.
+ ******************************************************************************/
+void sli_memory_increment_heap_generation(void);
+
+/***************************************************************************//**
+ * Gets the offset that aligns the data payload of a block kept at its address.
+ *
+ * @param[in] block        Pointer to block metadata.
+ * @param[in] block_align  Required alignment, in bytes.
+ *
+ * @return    Offset to add to the block metadata address, in bytes.
+ ******************************************************************************/
+size_t sli_memory_get_align_offset(const sli_block_metadata_t *block,
+                                   size_t block_align);
+
 /***************************************************************************//**
  * Gets pointer to the first free block of adequate size.
  *
@@ -246,6 +389,80 @@ size_t sli_memory_find_free_block(sl_memory_heap_t *heap,
                                   bool block_reservation,
                                   sli_block_metadata_t **block);
 
+#if defined(SLI_MEMORY_MANAGER_FREE_BINS)
+/***************************************************************************//**
+ * Adds a free block to the segregated free lists of a heap.
+ *
+ * @param[in]  heap   Heap handle.
+ * @param[in]  block  Free block whose metadata length is final.
+ *
+ * @note Blocks closer to the heap start than the bin head are put first,
+ *       others last. Long-term allocations take the bin head and short-term
+ *       allocations the bin tail.
+ ******************************************************************************/
+void sli_memory_free_bins_insert(sl_memory_heap_t *heap,
+                                 sli_block_metadata_t *block);
+
+/***************************************************************************//**
+ * Removes a free block from the segregated free lists of a heap. Must be
+ * called before the block length changes or the block stops being free.
+ *
+ * @param[in]  heap   Heap handle.
+ * @param[in]  block  Free block currently in a bin.
+ ******************************************************************************/
+void sli_memory_free_bins_remove(sl_memory_heap_t *heap,
+                                 sli_block_metadata_t *block);
+#endif
+
+#if defined(SLI_MEMORY_MANAGER_SIZE_CLASS_POOLS)
+/***************************************************************************//**
+ * Allocates a block from the size-class pool matching a requested size. The
+ * pool is created from the general purpose heap on first use.
+ *
+ * @param[in]  size  Size of the block, in bytes.
+ *
+ * @return  Pointer to the block, or NULL if the size is not handled by a size
+ *          class, or if the size-class pool is exhausted or cannot be created.
+ ******************************************************************************/
+void *sli_memory_size_class_alloc(size_t size);
+
+/***************************************************************************//**
+ * Gets the size-class pool that contains a block.
+ *
+ * @param[in]  block  A block's address.
+ *
+ * @return  Pool handle, or NULL if the block is not in a size-class pool.
+ ******************************************************************************/
+sl_memory_pool_t *sli_memory_size_class_get_pool(const void *block);
+
+/***************************************************************************//**
+ * Resizes a block allocated from a size-class pool.
+ *
+ * @param[in]  pool_handle  Size-class pool that contains the block.
+ * @param[in]  ptr          Pointer to the block.
+ * @param[in]  size         New size of the block, in bytes. Must not be 0.
+ * @param[out] block        Pointer to a variable that will receive the address
+ *                          of the resized block. NULL in case of error
+ *                          condition.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sli_memory_size_class_realloc(sl_memory_pool_t *pool_handle,
+                                          void *ptr,
+                                          size_t size,
+                                          void **block);
+
+#if defined(SLI_MEMORY_MANAGER_ENABLE_TEST_UTILITIES)
+/***************************************************************************//**
+ * Deletes the size-class pools.
+ *
+ * @return  SL_STATUS_OK if successful, SL_STATUS_INVALID_STATE if a block is
+ *          still allocated from a size-class pool.
+ ******************************************************************************/
+sl_status_t sli_memory_size_class_delete_pools(void);
+#endif
+#endif
+
 /***************************************************************************//**
  * Finds the next free block that will become the long-term or short-term head
  * pointer in a specific heap instance.
@@ -319,6 +536,94 @@ sl_status_t sli_memory_create_heap(void *base_addr,
  ******************************************************************************/
 sl_memory_heap_t *sli_memory_get_heap_handle(const void *block);
 
+/***************************************************************************//**
+ * Power Manager hook called before the system goes to sleep, with interrupts
+ * disabled. Runs one incremental heap integrity check step when
+ * SL_MEMORY_MANAGER_HEAP_CHECK_SLEEP_BLOCK_COUNT is not 0.
+ *
+ * @return  Always true, the Memory Manager never prevents sleeping.
+ ******************************************************************************/
+bool sli_memory_manager_is_ok_to_sleep(void);
+
+#if defined(SLI_MEMORY_MANAGER_HEAP_CHECK_OWNERS)
+/***************************************************************************//**
+ * Records the return address of the code that allocated a heap block.
+ *
+ * @param[in]  heap   Heap handle.
+ * @param[in]  block  Block address, as returned to the caller.
+ * @param[in]  pc     Return address of the caller.
+ *
+ * @note Only the blocks of the general purpose heap are recorded. The table
+ *       has SL_MEMORY_MANAGER_HEAP_CHECK_OWNER_COUNT entries indexed by block
+ *       offset, so a new block may evict the entry of an older one.
+ ******************************************************************************/
+void sli_memory_heap_check_record_owner(const sl_memory_heap_t *heap,
+                                        const void *block,
+                                        void *pc);
+
+/***************************************************************************//**
+ * Replaces the recorded return address of a heap block by the one of an outer
+ * allocation function, in the order the memory profiler tracks ownership.
+ *
+ * @param[in]  block  Block address, as returned to the caller.
+ * @param[in]  pc     Return address of the caller.
+ *
+ * @note Does nothing if the block has no entry, for instance a pool block.
+ ******************************************************************************/
+void sli_memory_heap_check_update_owner(const void *block,
+                                        void *pc);
+
+/***************************************************************************//**
+ * Forgets the return address recorded for a heap block being freed.
+ *
+ * @param[in]  heap   Heap handle.
+ * @param[in]  block  Block address, as returned to the caller.
+ ******************************************************************************/
+void sli_memory_heap_check_clear_owner(const sl_memory_heap_t *heap,
+                                       const void *block);
+#endif
+
+/***************************************************************************//**
+ * Paints the unused part of the stack, below the current stack pointer, so
+ * that the stack high watermark can be measured later.
+ *
+ * @note Does nothing unless SL_STACK_HIGH_WATERMARK_ENABLE is 1.
+ ******************************************************************************/
+void sli_memory_paint_stack(void);
+
+/***************************************************************************//**
+ * Gets the RAM banks that can be left unretained in EM2.
+ *
+ * @param[in]  heap        Heap handle.
+ * @param[in]  ram_base    Start address of the first RAM bank.
+ * @param[in]  bank_size   Size of each RAM bank, in address order.
+ * @param[in]  bank_count  Number of RAM banks.
+ *
+ * @return  Bit mask of the RAM banks, bit n for bank n. A bank is set if it
+ *          lies entirely in the heap and holds nothing but free block data
+ *          payload and blocks reserved with sl_memory_reserve_no_retention().
+ *          0 if the heap blocks are not consistent.
+ *
+ * @note Must be called with interrupts disabled.
+ ******************************************************************************/
+uint32_t sli_memory_get_unretained_bank_mask(const sl_memory_heap_t *heap,
+                                             uintptr_t ram_base,
+                                             const uint32_t *bank_size,
+                                             uint32_t bank_count);
+
+/***************************************************************************//**
+ * Makes the bottom of the stack a read-only MPU region, so that a stack
+ * overflow triggers a MemManage fault instead of corrupting the memory below
+ * the stack.
+ *
+ * @return  SL_STATUS_OK if successful or if the guard is disabled. Error code
+ *          otherwise.
+ *
+ * @note Does nothing when SL_STACK_GUARD_SIZE is 0. Must be called after
+ *       sl_mpu_disable_execute_from_ram().
+ ******************************************************************************/
+sl_status_t sli_memory_enable_stack_guard(void);
+
 #if defined(SLI_MEMORY_MANAGER_ENABLE_TEST_UTILITIES)
 /***************************************************************************//**
  * Get an index of sli_reservation_handle_ptr_table that is free.
@@ -33,6 +33,7 @@
 #include "sl_assert.h"
 #include "sl_event_handler.h"
 #include "sl_main_init.h"
+#include "sl_main_profiler.h"
 
 #if defined(SL_COMPONENT_CATALOG_PRESENT)
 #include "sl_component_catalog.h"
@@ -104,6 +105,10 @@
 #include "sl_memory_manager.h"
 #endif
 
+#if defined(SL_CATALOG_MEMORY_MANAGER_PRESENT)
+#include "sli_memory_manager.h"
+#endif
+
 #if defined(SL_CATALOG_CLOCK_MANAGER_PRESENT)
 #include "sl_clock_manager_init.h"
 #endif
@@ -190,6 +195,7 @@ __WEAK void app_process_action(void)
  *****************************************************************************/
 void sl_main_second_stage_init(void)
 {
+  sl_main_profiler_init();
   sl_platform_init();
   sl_driver_init();
   sl_service_init();
@@ -210,6 +216,11 @@ void sl_main_second_stage_init(void)
  *****************************************************************************/
 void sl_main_init(void)
 {
+#if defined(SL_CATALOG_MEMORY_MANAGER_PRESENT)
+  // Paint the unused stack first, to measure the stack high watermark.
+  sli_memory_paint_stack();
+#endif
+
 #if defined(SL_CATALOG_MEMORY_MANAGER_PRESENT) && !defined(SL_CATALOG_CPP_SUPPORT_PRESENT)
   sl_memory_init();
 #endif
@@ -289,6 +300,12 @@ void sl_main_init(void)
   sl_mpu_disable_execute_from_ram();
 #endif
 
+#if defined(SL_CATALOG_MEMORY_MANAGER_PRESENT)
+  sl_status_t status = sli_memory_enable_stack_guard();
+  EFM_ASSERT(status == SL_STATUS_OK);
+  (void)status;
+#endif
+
   // Early application initialization (post-system init).
   app_init_early();
 
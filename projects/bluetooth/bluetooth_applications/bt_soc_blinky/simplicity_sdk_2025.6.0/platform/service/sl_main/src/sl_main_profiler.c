@@ -0,0 +1,277 @@
+/***************************************************************************//**
+ * @file
+ * @brief Main loop profiler.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#include <string.h>
+#include "sl_main_profiler.h"
+#include "sl_core.h"
+#include "em_device.h"
+
+#if !defined(DWT)
+#include <time.h>
+#endif
+
+/*******************************************************************************
+ ***************************   LOCAL VARIABLES   *******************************
+ ******************************************************************************/
+
+static sl_main_profiler_stats_t probe_stats[SL_MAIN_PROFILER_PROBE_COUNT];
+
+#if defined(SL_CATALOG_IOSTREAM_PRESENT)
+static const char *const probe_names[SL_MAIN_PROFILER_PROBE_COUNT] = {
+  "platform",
+  "service",
+  "stack",
+  "internal_app",
+  "app",
+  "bt_components",
+  "bt_app",
+};
+#endif
+
+/*******************************************************************************
+ *************************   LOCAL FUNCTION PROTOTYPES   ***********************
+ ******************************************************************************/
+
+static uint32_t get_bucket(uint32_t cycles);
+
+static void write_u32(uint8_t *buffer,
+                      uint32_t value);
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/******************************************************************************
+ * Initializes the profiler and starts its cycle counter.
+ *****************************************************************************/
+void sl_main_profiler_init(void)
+{
+#if (SL_MAIN_PROFILER_ENABLE == 1) && defined(DWT)
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+  sl_main_profiler_reset();
+}
+
+/******************************************************************************
+ * Gets the current cycle count.
+ *****************************************************************************/
+uint64_t sl_main_profiler_get_cycles(void)
+{
+#if defined(DWT)
+  return DWT->CYCCNT;
+#else
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+#endif
+}
+
+/******************************************************************************
+ * Gets the cycles elapsed since a cycle count.
+ *
+ * @note (1) The DWT cycle counter wraps around, so the delta is taken on
+ *           32 bits.
+ *
+ * @note (2) The monotonic clock of the host does not wrap around. The delta is
+ *           taken on 64 bits and saturated, so that a section longer than
+ *           2^32 ns, about 4.3 s, is not recorded as a short one.
+ *****************************************************************************/
+uint32_t sl_main_profiler_get_elapsed_cycles(uint64_t start)
+{
+#if defined(DWT)
+  // See Note #1.
+  return (uint32_t)sl_main_profiler_get_cycles() - (uint32_t)start;
+#else
+  // See Note #2.
+  uint64_t elapsed = sl_main_profiler_get_cycles() - start;
+
+  return (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed;
+#endif
+}
+
+/******************************************************************************
+ * Records the duration of a section.
+ *****************************************************************************/
+void sl_main_profiler_record(sl_main_profiler_probe_t probe,
+                             uint32_t cycles)
+{
+  sl_main_profiler_stats_t *stats;
+  uint32_t bucket;
+  CORE_DECLARE_IRQ_STATE;
+
+  if (probe >= SL_MAIN_PROFILER_PROBE_COUNT) {
+    return;
+  }
+  stats = &probe_stats[probe];
+  bucket = get_bucket(cycles);
+
+  CORE_ENTER_ATOMIC();
+  stats->count++;
+  stats->total += cycles;
+  if (cycles > stats->max) {
+    stats->max = cycles;
+  }
+  stats->buckets[bucket]++;
+  CORE_EXIT_ATOMIC();
+}
+
+/******************************************************************************
+ * Gets the statistics of a probe.
+ *****************************************************************************/
+sl_status_t sl_main_profiler_get_stats(sl_main_profiler_probe_t probe,
+                                       sl_main_profiler_stats_t *stats)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if ((probe >= SL_MAIN_PROFILER_PROBE_COUNT) || (stats == NULL)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  CORE_ENTER_ATOMIC();
+  *stats = probe_stats[probe];
+  CORE_EXIT_ATOMIC();
+
+  return SL_STATUS_OK;
+}
+
+/******************************************************************************
+ * Clears the statistics of all probes.
+ *****************************************************************************/
+void sl_main_profiler_reset(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  memset(probe_stats, 0, sizeof(probe_stats));
+  CORE_EXIT_ATOMIC();
+}
+
+/******************************************************************************
+ * Writes a summary of all probes.
+ *****************************************************************************/
+size_t sl_main_profiler_serialize(uint8_t *buffer,
+                                  size_t size)
+{
+  sl_main_profiler_stats_t stats;
+  size_t offset = 0;
+
+  for (uint32_t probe = 0; probe < SL_MAIN_PROFILER_PROBE_COUNT; probe++) {
+    if ((size - offset) < SL_MAIN_PROFILER_SUMMARY_SIZE) {
+      break;
+    }
+    (void)sl_main_profiler_get_stats((sl_main_profiler_probe_t)probe, &stats);
+    write_u32(&buffer[offset], stats.count);
+    write_u32(&buffer[offset + 4], stats.max);
+    write_u32(&buffer[offset + 8],
+              (stats.count != 0) ? (uint32_t)(stats.total / stats.count) : 0);
+    offset += SL_MAIN_PROFILER_SUMMARY_SIZE;
+  }
+
+  return offset;
+}
+
+#if defined(SL_CATALOG_IOSTREAM_PRESENT)
+/******************************************************************************
+ * Prints the statistics and histograms of all probes.
+ *****************************************************************************/
+void sl_main_profiler_dump(sl_iostream_t *stream)
+{
+  sl_main_profiler_stats_t stats;
+
+  for (uint32_t probe = 0; probe < SL_MAIN_PROFILER_PROBE_COUNT; probe++) {
+    (void)sl_main_profiler_get_stats((sl_main_profiler_probe_t)probe, &stats);
+    sl_iostream_printf(stream, "%s: count %lu, max %lu, mean %lu\r\n",
+                       probe_names[probe],
+                       (unsigned long)stats.count,
+                       (unsigned long)stats.max,
+                       (unsigned long)((stats.count != 0) ? (stats.total / stats.count) : 0));
+    for (uint32_t bucket = 0; bucket < SL_MAIN_PROFILER_BUCKET_COUNT; bucket++) {
+      if (stats.buckets[bucket] == 0) {
+        continue;
+      }
+      if (bucket < (SL_MAIN_PROFILER_BUCKET_COUNT - 1)) {
+        sl_iostream_printf(stream, "  < 2^%lu: %lu\r\n",
+                           (unsigned long)(SL_MAIN_PROFILER_FIRST_BUCKET_LOG2 + bucket),
+                           (unsigned long)stats.buckets[bucket]);
+      } else {
+        sl_iostream_printf(stream, "  >= 2^%lu: %lu\r\n",
+                           (unsigned long)(SL_MAIN_PROFILER_FIRST_BUCKET_LOG2 + bucket - 1),
+                           (unsigned long)stats.buckets[bucket]);
+      }
+    }
+  }
+}
+#endif
+
+/*******************************************************************************
+ ***************************   LOCAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/******************************************************************************
+ * Gets the histogram bucket of a duration.
+ *
+ * @param[in] cycles  Duration, in cycles.
+ *
+ * @return Bucket index.
+ *
+ * @note (1) Bucket n counts the durations below
+ *           2^(SL_MAIN_PROFILER_FIRST_BUCKET_LOG2 + n) cycles that do not fit
+ *           a lower bucket. The last bucket also counts all longer durations.
+ *****************************************************************************/
+static uint32_t get_bucket(uint32_t cycles)
+{
+  uint32_t bucket = 0;
+  uint32_t bound_cycles = cycles >> SL_MAIN_PROFILER_FIRST_BUCKET_LOG2;
+
+  // See Note #1.
+  while ((bound_cycles != 0) && (bucket < (SL_MAIN_PROFILER_BUCKET_COUNT - 1))) {
+    bound_cycles >>= 1;
+    bucket++;
+  }
+
+  return bucket;
+}
+
+/******************************************************************************
+ * Writes a 32-bit value in little endian.
+ *
+ * @param[out] buffer  Output buffer, at least 4 bytes.
+ * @param[in]  value   Value.
+ *****************************************************************************/
+static void write_u32(uint8_t *buffer,
+                      uint32_t value)
+{
+  buffer[0] = (uint8_t)value;
+  buffer[1] = (uint8_t)(value >> 8);
+  buffer[2] = (uint8_t)(value >> 16);
+  buffer[3] = (uint8_t)(value >> 24);
+}
@@ -0,0 +1,49 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stand-in for the common utility macros used by the Sleeptimer
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_COMMON_H
+#define SL_COMMON_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sl_assert.h"
+#include "em_device.h"
+
+#define SL_MIN(a, b)  ((a) < (b) ? (a) : (b))
+#define SL_MAX(a, b)  ((a) > (b) ? (a) : (b))
+
+#define SL_WEAK       __attribute__((weak))
+
+static inline uint32_t SL_CTZ(uint32_t value)
+{
+  return (uint32_t)__builtin_ctz(value);
+}
+
+#endif // SL_COMMON_H
@@ -0,0 +1,75 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sleeptimer configuration for the host tools
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_SLEEPTIMER_CONFIG_H
+#define SL_SLEEPTIMER_CONFIG_H
+
+#define SL_SLEEPTIMER_PERIPHERAL_DEFAULT 0
+#define SL_SLEEPTIMER_PERIPHERAL_RTCC    1
+#define SL_SLEEPTIMER_PERIPHERAL_PRORTC  2
+#define SL_SLEEPTIMER_PERIPHERAL_RTC     3
+#define SL_SLEEPTIMER_PERIPHERAL_SYSRTC  4
+#define SL_SLEEPTIMER_PERIPHERAL_BURTC   5
+#define SL_SLEEPTIMER_PERIPHERAL_WTIMER  6
+#define SL_SLEEPTIMER_PERIPHERAL_TIMER   7
+#define SL_SLEEPTIMER_PERIPHERAL_HOST    8
+
+// The default peripheral is the virtual clock, selected by
+// SL_SLEEPTIMER_HOST_BUILD.
+#define SL_SLEEPTIMER_PERIPHERAL  SL_SLEEPTIMER_PERIPHERAL_DEFAULT
+
+#define SL_SLEEPTIMER_TIMER_INSTANCE  0
+
+// The calendar test enables the wall clock from the command line.
+#ifndef SL_SLEEPTIMER_WALLCLOCK_CONFIG
+#define SL_SLEEPTIMER_WALLCLOCK_CONFIG  0
+#endif
+
+#define SL_SLEEPTIMER_FREQ_DIVIDER  1
+
+#define SL_SLEEPTIMER_PRORTC_HAL_OWNS_IRQ_HANDLER  0
+
+#define SL_SLEEPTIMER_DEBUGRUN  0
+
+#define SL_SLEEPTIMER_TIMER_QUEUE_DELTA_LIST 0
+#define SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP   1
+
+// The timer queue can be set on the make command line to compare both queues,
+// e.g. make QUEUE=1.
+#ifndef SL_SLEEPTIMER_TIMER_QUEUE
+#define SL_SLEEPTIMER_TIMER_QUEUE  SL_SLEEPTIMER_TIMER_QUEUE_DELTA_LIST
+#endif
+
+#define SL_SLEEPTIMER_TIMER_HEAP_SIZE  32
+
+// Enough for all the timers of the host simulations to run with a slack.
+#define SL_SLEEPTIMER_SLACK_TIMER_COUNT  16
+
+#endif // SL_SLEEPTIMER_CONFIG_H
@@ -0,0 +1,348 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host benchmark of app_timer on the virtual clock of the Sleeptimer
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Runs hundreds of periodic app timers on the sleeptimer and the virtual
+ * clock of the host HAL, and times app_timer.
+ *
+ * The timers have random periods and callback priorities. The clock is
+ * advanced either from one expiration to the next, or by a fixed step so that
+ * many timers fire between two calls of sli_app_timer_step(). After each step,
+ * a random timer may be restarted with a new period and priority. Since
+ * app_timer serves at most one expiration per timer and step, the fixed step
+ * must be shorter than the shortest period.
+ *
+ * Every timer must get one callback per period elapsed since it was last
+ * started, and the callbacks of a step must come in priority order.
+ *
+ * Usage: sl_sleeptimer_host_app_timer [options]
+ *   -t <count>   Number of timers. Default: 600.
+ *   -p <ms>      Shortest timer period. Default: 50.
+ *   -P <ms>      Longest timer period. Default: 2000.
+ *   -m <min>     Simulated time of each run. Default: 10.
+ *   -b <ms>      Clock step of the batched run, shorter than the shortest
+ *                period. Default: 40.
+ *   -r <seed>    Seed of the timer periods and restarts. Default: 1.
+ *
+ * For each run, prints the callbacks per step and the time spent per callback
+ * in the whole run, in sli_app_timer_step(), and per timer restart.
+ ******************************************************************************/
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sl_sleeptimer.h"
+#include "sl_sleeptimer_host.h"
+#include "app_timer.h"
+#include "app_timer_internal.h"
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+#define HOST_TIMER_COUNT_DEFAULT   600u
+#define HOST_PERIOD_MIN_DEFAULT    50u
+#define HOST_PERIOD_MAX_DEFAULT    2000u
+#define HOST_MINUTES_DEFAULT       10u
+#define HOST_BATCH_MS_DEFAULT      40u
+
+// One timer out of this many steps is restarted.
+#define HOST_RESTART_RATE          4u
+
+/*******************************************************************************
+ ********************************   DATA TYPES   *******************************
+ ******************************************************************************/
+
+// Periodic app timer of the workload.
+typedef struct {
+  app_timer_t timer;
+  uint32_t period_ms;
+  uint64_t start_tick;
+  uint64_t callback_count;
+  uint64_t expected_min;
+  uint64_t expected_max;
+} host_timer_t;
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+static host_timer_t *host_timers;
+static uint32_t host_timer_count = HOST_TIMER_COUNT_DEFAULT;
+static uint32_t host_period_min_ms = HOST_PERIOD_MIN_DEFAULT;
+static uint32_t host_period_max_ms = HOST_PERIOD_MAX_DEFAULT;
+
+static uint32_t host_timer_freq;
+static uint64_t host_callback_count;
+static uint32_t host_last_priority;
+static uint64_t host_priority_fail_count;
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Returns a monotonic timestamp in nanoseconds.
+ ******************************************************************************/
+static uint64_t host_time_ns(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/***************************************************************************//**
+ * Counts the periods elapsed in a number of ticks.
+ *
+ * @note The sleeptimer compensates the rounding of the period to ticks, so
+ *       the k-th expiration is within a tick of k periods rounded up to ticks.
+ ******************************************************************************/
+static uint64_t host_period_count(uint64_t ticks, uint32_t period_ms)
+{
+  return (ticks * 1000u) / ((uint64_t)period_ms * host_timer_freq);
+}
+
+/***************************************************************************//**
+ * Counts a callback and checks the priority order of the step.
+ ******************************************************************************/
+static void host_on_timeout(app_timer_t *timer, void *data)
+{
+  host_timer_t *host_timer = (host_timer_t *)data;
+
+  (void)timer;
+
+  host_timer->callback_count++;
+  host_callback_count++;
+  if (host_timer->timer.priority < host_last_priority) {
+    host_priority_fail_count++;
+  }
+  host_last_priority = host_timer->timer.priority;
+}
+
+/***************************************************************************//**
+ * Adds the periods elapsed since a timer was started to its expected number
+ * of callbacks.
+ ******************************************************************************/
+static void host_close_timer(host_timer_t *host_timer)
+{
+  uint64_t ticks = sl_sleeptimer_host_get_elapsed_ticks() - host_timer->start_tick;
+
+  host_timer->expected_min += host_period_count((ticks > 0) ? (ticks - 1u) : 0u, host_timer->period_ms);
+  host_timer->expected_max += host_period_count(ticks + 1u, host_timer->period_ms);
+}
+
+/***************************************************************************//**
+ * Starts a timer with a random period and priority.
+ ******************************************************************************/
+static void host_start_timer(host_timer_t *host_timer)
+{
+  sl_status_t status;
+
+  host_timer->period_ms = host_period_min_ms
+                          + ((uint32_t)rand() % (host_period_max_ms - host_period_min_ms + 1u));
+  host_timer->start_tick = sl_sleeptimer_host_get_elapsed_ticks();
+  status = app_timer_start_with_priority(&host_timer->timer,
+                                         host_timer->period_ms,
+                                         host_on_timeout,
+                                         host_timer,
+                                         true,
+                                         (uint8_t)((uint32_t)rand() % APP_TIMER_PRIORITY_COUNT));
+  if (status != SL_STATUS_OK) {
+    fprintf(stderr, "cannot start timer %td: status 0x%04" PRIx32 "\n",
+            host_timer - host_timers, (uint32_t)status);
+    exit(EXIT_FAILURE);
+  }
+}
+
+/***************************************************************************//**
+ * Runs the workload.
+ *
+ * @param name Name of the run.
+ * @param batch_ms Clock step between two calls of sli_app_timer_step(), 0 to
+ *                 step on each expiration.
+ * @param minutes Simulated time.
+ * @param seed Seed of the timer periods and restarts.
+ ******************************************************************************/
+static void host_run(const char *name, uint32_t batch_ms, uint32_t minutes, uint32_t seed)
+{
+  uint64_t end_tick;
+  uint64_t batch_ticks = ((uint64_t)batch_ms * host_timer_freq) / 1000u;
+  uint64_t step_count = 0;
+  uint64_t restart_count = 0;
+  uint64_t step_ns = 0;
+  uint64_t restart_ns = 0;
+  uint64_t run_ns;
+  uint64_t start_ns;
+  uint64_t fail_count = 0;
+
+  srand(seed);
+  host_callback_count = 0;
+  host_priority_fail_count = 0;
+  for (uint32_t i = 0; i < host_timer_count; i++) {
+    host_timers[i].callback_count = 0;
+    host_timers[i].expected_min = 0;
+    host_timers[i].expected_max = 0;
+    host_start_timer(&host_timers[i]);
+  }
+
+  end_tick = sl_sleeptimer_host_get_elapsed_ticks() + ((uint64_t)minutes * 60u * host_timer_freq);
+  run_ns = host_time_ns();
+  while (sl_sleeptimer_host_get_elapsed_ticks() < end_tick) {
+    uint64_t ticks_left = end_tick - sl_sleeptimer_host_get_elapsed_ticks();
+
+    if (batch_ticks == 0) {
+      (void)sl_sleeptimer_host_advance_to_next_event();
+    } else {
+      sl_sleeptimer_host_advance((batch_ticks < ticks_left) ? batch_ticks : ticks_left);
+    }
+
+    host_last_priority = 0;
+    start_ns = host_time_ns();
+    sli_app_timer_step();
+    step_ns += host_time_ns() - start_ns;
+    step_count++;
+
+    // Every expiration so far was served, so the restarted timer drops none.
+    if (((uint32_t)rand() % HOST_RESTART_RATE) == 0u) {
+      host_timer_t *host_timer = &host_timers[(uint32_t)rand() % host_timer_count];
+
+      host_close_timer(host_timer);
+      start_ns = host_time_ns();
+      host_start_timer(host_timer);
+      restart_ns += host_time_ns() - start_ns;
+      restart_count++;
+    }
+  }
+  run_ns = host_time_ns() - run_ns;
+
+  for (uint32_t i = 0; i < host_timer_count; i++) {
+    host_timer_t *host_timer = &host_timers[i];
+
+    host_close_timer(host_timer);
+    (void)app_timer_stop(&host_timer->timer);
+    if ((host_timer->callback_count < host_timer->expected_min)
+        || (host_timer->callback_count > host_timer->expected_max)) {
+      if (fail_count < 10u) {
+        fprintf(stderr, "timer %" PRIu32 ": %" PRIu64 " callbacks, expected %" PRIu64 " to %" PRIu64 "\n",
+                i, host_timer->callback_count, host_timer->expected_min, host_timer->expected_max);
+      }
+      fail_count++;
+    }
+  }
+  if ((fail_count > 0) || (host_priority_fail_count > 0)) {
+    fprintf(stderr, "FAIL: %s: %" PRIu64 " timers with a wrong callback count, "
+            "%" PRIu64 " callbacks out of priority order\n",
+            name, fail_count, host_priority_fail_count);
+    exit(EXIT_FAILURE);
+  }
+
+  printf("%-8s %8" PRIu64 " callbacks, %6.1f per step: %7.1f ns per callback, "
+         "%6.1f ns in sli_app_timer_step(), %7.1f ns per restart\n",
+         name,
+         host_callback_count,
+         (double)host_callback_count / step_count,
+         (double)run_ns / host_callback_count,
+         (double)step_ns / host_callback_count,
+         (restart_count > 0) ? ((double)restart_ns / restart_count) : 0.0);
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+  uint32_t minutes = HOST_MINUTES_DEFAULT;
+  uint32_t batch_ms = HOST_BATCH_MS_DEFAULT;
+  uint32_t seed = 1u;
+  int option;
+
+  while ((option = getopt(argc, argv, "t:p:P:m:b:r:")) != -1) {
+    switch (option) {
+      case 't':
+        host_timer_count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'p':
+        host_period_min_ms = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'P':
+        host_period_max_ms = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'm':
+        minutes = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'b':
+        batch_ms = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'r':
+        seed = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      default:
+        fprintf(stderr, "usage: %s [-t count] [-p ms] [-P ms] [-m min] [-b ms] [-r seed]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+  }
+  if ((host_timer_count == 0) || (host_period_min_ms == 0)
+      || (host_period_max_ms < host_period_min_ms) || (minutes == 0) || (batch_ms == 0)
+      || (batch_ms >= host_period_min_ms)) {
+    fprintf(stderr, "invalid options\n");
+    return EXIT_FAILURE;
+  }
+
+  host_timers = calloc(host_timer_count, sizeof(*host_timers));
+  if (host_timers == NULL) {
+    fprintf(stderr, "out of host memory\n");
+    return EXIT_FAILURE;
+  }
+
+  sl_sleeptimer_init();
+  host_timer_freq = sl_sleeptimer_get_timer_frequency();
+
+  printf("%" PRIu32 " timers, periods %" PRIu32 " to %" PRIu32 " ms, %" PRIu32 " min\n",
+         host_timer_count, host_period_min_ms, host_period_max_ms, minutes);
+  host_run("expiry", 0, minutes, seed);
+  host_run("batched", batch_ms, minutes, seed);
+  printf("app timer ok\n");
+
+  free(host_timers);
+  return EXIT_SUCCESS;
+}
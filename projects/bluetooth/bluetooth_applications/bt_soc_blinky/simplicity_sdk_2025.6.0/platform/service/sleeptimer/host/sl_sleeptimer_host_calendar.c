@@ -0,0 +1,576 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test and benchmark of the Sleeptimer calendar conversions
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Checks the date and time conversions of the sleeptimer wall clock.
+ *
+ * Every day from 1900-01-01 to 11899-12-31, with a random time of day and
+ * time zone, is converted in both directions and compared with a day-by-day
+ * calendar, and with the previous implementation of the conversions, copied
+ * below. The previous implementation is expected to differ only in the years
+ * where its leap year check was wrong (2000, 2300, 2400, ...), and from 3408
+ * on, where its year approximation is off. The 32-bit conversions are checked
+ * over the Unix time range. Dates around the leap years that the previous
+ * leap year check got wrong are then checked explicitly.
+ *
+ * Finally, both implementations are timed on random timestamps.
+ *
+ * Usage: sl_sleeptimer_host_calendar [-r seed] [-n conversions]
+ ******************************************************************************/
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sl_sleeptimer.h"
+
+#if !SL_SLEEPTIMER_WALLCLOCK_CONFIG
+#error "The calendar test requires SL_SLEEPTIMER_WALLCLOCK_CONFIG."
+#endif
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+#define HOST_EPOCH_YEAR             1900u
+#define HOST_LAST_YEAR              11899u
+#define HOST_SEC_PER_DAY            86400u
+#define HOST_TIMESTAMP_64_MAX       0x497968BD7F // 11899-12-31 23:59:59
+#define HOST_UNIX_EPOCH_DAY         25567u   // Days from 1900-01-01 to 1970-01-01
+#define HOST_UNIX_LAST_DAY          (HOST_UNIX_EPOCH_DAY + 24855u) // 2038-01-19
+#define HOST_TIME_ZONE_MIN          (-12 * 3600)
+#define HOST_TIME_ZONE_MAX          (14 * 3600)
+#define HOST_TIME_ZONE_STEP         (15 * 60)
+#define HOST_OLD_YEAR_APPROX_LIMIT  3408u
+#define HOST_BENCH_COUNT_DEFAULT    1000000u
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+static const uint8_t host_days_in_month[2u][12] = {
+  { 31u, 28u, 31u, 30u, 31u, 30u, 31u, 31u, 30u, 31u, 30u, 31u },
+  { 31u, 29u, 31u, 30u, 31u, 30u, 31u, 31u, 30u, 31u, 30u, 31u }
+};
+
+static uint64_t host_check_count;
+
+/*******************************************************************************
+ *********************   PREVIOUS IMPLEMENTATION   *****************************
+ ******************************************************************************/
+
+// The functions below are the calendar conversions of the sleeptimer before
+// days_from_civil() and civil_from_days(), without the parameter checks.
+
+static bool old_is_leap_year(uint16_t year)
+{
+  // 1900 is not a leap year but 0 % anything is 0.
+  if (year == 0) {
+    return false;
+  }
+
+  bool leap_year;
+
+  leap_year = (((year %   4u) == 0u)
+               && (((year % 100u) != 0u) || ((year % 400u) == 0u))) ? true : false;
+
+  return (leap_year);
+}
+
+static uint16_t old_number_of_leap_days(uint32_t base_year, uint32_t current_year)
+{
+  // Regular leap years
+  uint16_t lo_reg = (base_year - 0) / 4;
+  uint16_t hi_reg = (current_year - 1) / 4;
+  uint16_t leap_days = hi_reg - lo_reg;
+
+  // Account for non leap years
+  uint16_t lo_century = (base_year - 0) / 100;
+  uint16_t hi_century = (current_year - 1) / 100;
+  leap_days -= hi_century - lo_century;
+
+  // Account for quad century leap years
+  uint16_t lo_quad = (base_year - 0) / 400;
+  uint16_t hi_quad = (current_year - 1) / 400;
+  leap_days += hi_quad - lo_quad;
+
+  return (leap_days);
+}
+
+static void old_convert_time_to_date_64(sl_sleeptimer_timestamp_64_t time,
+                                        sl_sleeptimer_time_zone_offset_t time_zone,
+                                        sl_sleeptimer_date_t *date)
+{
+  uint16_t full_year = 0;
+  uint16_t leap_day = 0;
+  uint8_t leap_year_flag = 0;
+  uint8_t current_month = 0;
+
+  time += time_zone;  // add UTC offset to convert to Standard Time
+  date->sec = time % 60;
+  time /= 60;
+  date->min = time % 60;
+  time /= 60;
+  date->hour = time % 24;
+  time /= 24; // time is now the number of days since 1900
+
+  date->day_of_week = (sl_sleeptimer_weekDay_t)((time + 1) % 7);
+
+  full_year = time / 365u; // Approximates the number of full years
+  uint32_t base_year = 1900u;
+  uint32_t current_year = full_year + base_year;
+
+  if (full_year > 4) { // 1904 is the first leap year since 1900
+    leap_day = old_number_of_leap_days(base_year, current_year);  // Approximates the number of leap days.
+    full_year = (time - leap_day) / 365u; // Computes the number of year integrating the leap days.
+    current_year = full_year + base_year;
+    leap_day = old_number_of_leap_days(base_year, current_year); // Computes the actual number of leap days of the previous years.
+  }
+  date->year = full_year; // Year in date struct must be based on a 1900 epoch.
+  if (old_is_leap_year(date->year)) {
+    leap_year_flag = 1;
+  }
+
+  time = (time - leap_day) - (365u * full_year);  // Subtracts days of previous year.
+  date->day_of_year = time + 1;
+
+  while (time >= host_days_in_month[leap_year_flag][current_month]) {
+    time -= host_days_in_month[leap_year_flag][current_month]; // Subtracts the number of days of the passed month.
+    current_month++;
+  }
+  date->month = (sl_sleeptimer_month_t)current_month;
+  date->month_day = time + 1;
+  date->time_zone = time_zone;
+}
+
+static void old_convert_date_to_time_64(const sl_sleeptimer_date_t *date,
+                                        sl_sleeptimer_timestamp_64_t *time)
+{
+  uint16_t month_days = 0;
+  uint8_t  month;
+  uint16_t  full_year = 0;
+  uint8_t  leap_year_flag = 0;
+  uint16_t  leap_days = 0;
+
+  full_year = (date->year);                                  // base year for 64 bits its 1900 not 1970
+  month = date->month;                              // offset to get months value from 1 to 12.
+
+  uint32_t base_year = 1900u;
+  uint32_t current_year = full_year + base_year;
+
+  *time = (full_year * (uint64_t)(HOST_SEC_PER_DAY * 365u));
+
+  if (full_year > 4) {                                       // 1904 is the first leap year since 1900
+    leap_days = old_number_of_leap_days(base_year, current_year);
+    month_days = leap_days;
+  }
+
+  if (old_is_leap_year(date->year)) {
+    leap_year_flag = 1;
+  }
+
+  for (int i = 0; i < month; i++) {
+    month_days += host_days_in_month[leap_year_flag][i];         // Add the number of days of the month of the year.
+  }
+
+  month_days += (date->month_day - 1);                       // Add full days of the current month.
+  *time += month_days * HOST_SEC_PER_DAY;
+  *time += (3600 * date->hour) + (60 * date->min) + date->sec;
+  *time -= date->time_zone;
+}
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Reports an error and exits.
+ ******************************************************************************/
+static void host_fail(const char *what, const sl_sleeptimer_date_t *expected, const sl_sleeptimer_date_t *actual)
+{
+  fprintf(stderr, "FAIL: %s\n", what);
+  if (expected != NULL) {
+    fprintf(stderr, "  expected %u-%02u-%02u %02u:%02u:%02u wday %u yday %u\n",
+            expected->year + HOST_EPOCH_YEAR, expected->month + 1u, expected->month_day,
+            expected->hour, expected->min, expected->sec, expected->day_of_week, expected->day_of_year);
+  }
+  if (actual != NULL) {
+    fprintf(stderr, "  actual   %u-%02u-%02u %02u:%02u:%02u wday %u yday %u\n",
+            actual->year + HOST_EPOCH_YEAR, actual->month + 1u, actual->month_day,
+            actual->hour, actual->min, actual->sec, actual->day_of_week, actual->day_of_year);
+  }
+  exit(EXIT_FAILURE);
+}
+
+/***************************************************************************//**
+ * Checks a condition.
+ ******************************************************************************/
+static void host_expect(bool condition, const char *what)
+{
+  if (!condition) {
+    host_fail(what, NULL, NULL);
+  }
+  host_check_count++;
+}
+
+/***************************************************************************//**
+ * Gets whether a year is a leap year.
+ ******************************************************************************/
+static bool host_is_leap_year(uint32_t full_year)
+{
+  return ((full_year % 4u) == 0u) && (((full_year % 100u) != 0u) || ((full_year % 400u) == 0u));
+}
+
+/***************************************************************************//**
+ * Compares the fields of two dates.
+ ******************************************************************************/
+static bool host_date_equal(const sl_sleeptimer_date_t *a, const sl_sleeptimer_date_t *b)
+{
+  return (a->sec == b->sec) && (a->min == b->min) && (a->hour == b->hour)
+         && (a->month_day == b->month_day) && (a->month == b->month) && (a->year == b->year)
+         && (a->day_of_week == b->day_of_week) && (a->day_of_year == b->day_of_year)
+         && (a->time_zone == b->time_zone);
+}
+
+/***************************************************************************//**
+ * Draws a random time of day and time zone for a day, and the matching
+ * timestamp. The time zone is 0 where the timestamp would be out of range
+ * on either end.
+ ******************************************************************************/
+static sl_sleeptimer_timestamp_64_t host_random_time(uint32_t day, sl_sleeptimer_date_t *date)
+{
+  uint32_t day_sec = (uint32_t)rand() % HOST_SEC_PER_DAY;
+  int32_t zone_count = ((HOST_TIME_ZONE_MAX - HOST_TIME_ZONE_MIN) / HOST_TIME_ZONE_STEP) + 1;
+  int32_t time_zone = HOST_TIME_ZONE_MIN + ((rand() % zone_count) * HOST_TIME_ZONE_STEP);
+  int64_t time = ((int64_t)day * HOST_SEC_PER_DAY) + day_sec - time_zone;
+
+  if ((time <= HOST_TIME_ZONE_MAX) || (time > HOST_TIMESTAMP_64_MAX)) {
+    time_zone = 0;
+    time = ((int64_t)day * HOST_SEC_PER_DAY) + day_sec;
+  }
+
+  date->sec = day_sec % 60u;
+  date->min = (day_sec / 60u) % 60u;
+  date->hour = day_sec / 3600u;
+  date->time_zone = time_zone;
+  return (sl_sleeptimer_timestamp_64_t)time;
+}
+
+/***************************************************************************//**
+ * Converts every day of the 64-bit range in both directions and compares the
+ * results with the calendar and with the previous implementation.
+ ******************************************************************************/
+static void host_check_all_days(void)
+{
+  sl_sleeptimer_date_t expected;
+  sl_sleeptimer_date_t date;
+  sl_sleeptimer_date_t built;
+  sl_sleeptimer_timestamp_64_t time;
+  sl_sleeptimer_timestamp_64_t converted;
+  uint32_t full_year = HOST_EPOCH_YEAR;
+  uint32_t month = 0;
+  uint32_t month_day = 1;
+  uint32_t day_of_year = 1;
+  uint32_t day = 0;
+  uint64_t old_diff_count = 0;
+  uint64_t old_diff_leap_count = 0;
+  uint32_t old_first_diff_year = 0;
+
+  memset(&expected, 0, sizeof(expected));
+  while (full_year <= HOST_LAST_YEAR) {
+    bool is_leap = host_is_leap_year(full_year);
+    bool is_old_leap_wrong = (old_is_leap_year((uint16_t)(full_year - HOST_EPOCH_YEAR)) != is_leap);
+
+    time = host_random_time(day, &expected);
+    expected.year = (uint16_t)(full_year - HOST_EPOCH_YEAR);
+    expected.month = (sl_sleeptimer_month_t)month;
+    expected.month_day = (uint8_t)month_day;
+    expected.day_of_year = (uint16_t)day_of_year;
+    expected.day_of_week = (sl_sleeptimer_weekDay_t)((day + 1u) % 7u); // 1900-01-01 was a Monday
+
+    // Timestamp to date.
+    memset(&date, 0, sizeof(date));
+    if ((sl_sleeptimer_convert_time_to_date_64(time, expected.time_zone, &date) != SL_STATUS_OK)
+        || !host_date_equal(&date, &expected)) {
+      host_fail("sl_sleeptimer_convert_time_to_date_64", &expected, &date);
+    }
+
+    // Date to timestamp.
+    if ((sl_sleeptimer_convert_date_to_time_64(&expected, &converted) != SL_STATUS_OK)
+        || (converted != time)) {
+      host_fail("sl_sleeptimer_convert_date_to_time_64", &expected, NULL);
+    }
+
+    // Date building.
+    if ((sl_sleeptimer_build_datetime_64(&built, (uint16_t)full_year, expected.month, expected.month_day,
+                                         expected.hour, expected.min, expected.sec, expected.time_zone) != SL_STATUS_OK)
+        || !host_date_equal(&built, &expected)) {
+      host_fail("sl_sleeptimer_build_datetime_64", &expected, &built);
+    }
+    host_check_count += 3u;
+
+    // Previous implementation.
+    old_convert_time_to_date_64(time, expected.time_zone, &date);
+    old_convert_date_to_time_64(&expected, &converted);
+    if (!host_date_equal(&date, &expected) || (converted != time)) {
+      if (!is_old_leap_wrong && (full_year < HOST_OLD_YEAR_APPROX_LIMIT)) {
+        host_fail("previous implementation differs outside of the expected years", &expected, &date);
+      }
+      if (old_first_diff_year == 0) {
+        old_first_diff_year = full_year;
+      }
+      old_diff_count++;
+      if (is_old_leap_wrong) {
+        old_diff_leap_count++;
+      }
+    }
+
+    // Next day.
+    day++;
+    day_of_year++;
+    month_day++;
+    if (month_day > host_days_in_month[is_leap][month]) {
+      month_day = 1;
+      month++;
+      if (month == 12u) {
+        month = 0;
+        day_of_year = 1;
+        full_year++;
+      }
+    }
+  }
+
+  host_expect(day == 3652425u, "day count of the 64-bit range");
+  printf("%" PRIu32 " days checked, previous implementation: %" PRIu64 " days differ, "
+         "%" PRIu64 " in its wrong leap years, first in %" PRIu32 "\n",
+         day, old_diff_count, old_diff_leap_count, old_first_diff_year);
+}
+
+/***************************************************************************//**
+ * Converts every day of the Unix range with the 32-bit functions.
+ ******************************************************************************/
+static void host_check_unix_days(void)
+{
+  sl_sleeptimer_date_t expected;
+  sl_sleeptimer_date_t date;
+  sl_sleeptimer_timestamp_t converted;
+
+  for (uint32_t day = HOST_UNIX_EPOCH_DAY; day < HOST_UNIX_LAST_DAY; day++) {
+    uint32_t day_sec = (uint32_t)rand() % HOST_SEC_PER_DAY;
+    sl_sleeptimer_timestamp_t time = ((day - HOST_UNIX_EPOCH_DAY) * HOST_SEC_PER_DAY) + day_sec;
+
+    host_expect(sl_sleeptimer_convert_time_to_date_64((sl_sleeptimer_timestamp_64_t)day * HOST_SEC_PER_DAY + day_sec,
+                                                      0, &expected) == SL_STATUS_OK,
+                "64-bit reference");
+    memset(&date, 0, sizeof(date));
+    if ((sl_sleeptimer_convert_time_to_date(time, 0, &date) != SL_STATUS_OK)
+        || !host_date_equal(&date, &expected)) {
+      host_fail("sl_sleeptimer_convert_time_to_date", &expected, &date);
+    }
+    if ((sl_sleeptimer_convert_date_to_time(&expected, &converted) != SL_STATUS_OK)
+        || (converted != time)) {
+      host_fail("sl_sleeptimer_convert_date_to_time", &expected, NULL);
+    }
+    host_check_count += 2u;
+  }
+}
+
+/***************************************************************************//**
+ * Checks dates around the leap years that the previous leap year check got
+ * wrong: 2000 and 2400 are leap years, 1900, 2100 and 2300 are not.
+ ******************************************************************************/
+static void host_check_leap_years(void)
+{
+  static const struct {
+    uint16_t year;
+    bool is_leap;
+  } cases[] = {
+    { 1900u, false }, { 1904u, true }, { 2000u, true }, { 2024u, true },
+    { 2100u, false }, { 2300u, false }, { 2400u, true }, { 2500u, false },
+  };
+  sl_sleeptimer_date_t date;
+  sl_sleeptimer_date_t next;
+  sl_sleeptimer_timestamp_64_t time;
+  sl_sleeptimer_timestamp_64_t time_next;
+
+  for (size_t index = 0; index < (sizeof(cases) / sizeof(cases[0])); index++) {
+    uint16_t year = cases[index].year;
+    sl_status_t status = sl_sleeptimer_build_datetime_64(&date, year, MONTH_FEBRUARY, 29u, 12u, 0u, 0u, 0);
+
+    host_expect((status == SL_STATUS_OK) == cases[index].is_leap, "February 29th accepted only in leap years");
+
+    // The day after February 28th, and the length of the year.
+    host_expect(sl_sleeptimer_build_datetime_64(&date, year, MONTH_FEBRUARY, 28u, 0u, 0u, 0u, 0) == SL_STATUS_OK, "February 28th");
+    host_expect(sl_sleeptimer_convert_date_to_time_64(&date, &time) == SL_STATUS_OK, "February 28th timestamp");
+    host_expect(sl_sleeptimer_convert_time_to_date_64(time + HOST_SEC_PER_DAY, 0, &next) == SL_STATUS_OK, "next day");
+    host_expect((next.month == (cases[index].is_leap ? MONTH_FEBRUARY : MONTH_MARCH))
+                && (next.month_day == (cases[index].is_leap ? 29u : 1u)),
+                "day after February 28th");
+    host_expect(sl_sleeptimer_build_datetime_64(&date, year, MONTH_DECEMBER, 31u, 0u, 0u, 0u, 0) == SL_STATUS_OK, "December 31st");
+    host_expect(date.day_of_year == (cases[index].is_leap ? 366u : 365u), "day of year of December 31st");
+    host_expect(sl_sleeptimer_convert_date_to_time_64(&date, &time_next) == SL_STATUS_OK, "December 31st timestamp");
+    host_expect(sl_sleeptimer_build_datetime_64(&next, year, MONTH_JANUARY, 1u, 0u, 0u, 0u, 0) == SL_STATUS_OK, "January 1st");
+    host_expect(sl_sleeptimer_convert_date_to_time_64(&next, &time) == SL_STATUS_OK, "January 1st timestamp");
+    host_expect((time_next - time) == ((cases[index].is_leap ? 365u : 364u) * (uint64_t)HOST_SEC_PER_DAY), "year length");
+  }
+
+  // Well-known Unix timestamps around February 29th, 2000.
+  host_expect(sl_sleeptimer_build_datetime(&date, 2000u, MONTH_FEBRUARY, 29u, 0u, 0u, 0u, 0) == SL_STATUS_OK, "2000-02-29");
+  host_expect((date.day_of_week == DAY_TUESDAY) && (date.day_of_year == 60u), "2000-02-29 day of week and year");
+  host_expect(sl_sleeptimer_build_datetime(&date, 2000u, MONTH_MARCH, 1u, 0u, 0u, 0u, 0) == SL_STATUS_OK, "2000-03-01");
+  {
+    sl_sleeptimer_timestamp_t unix_time;
+
+    host_expect((sl_sleeptimer_convert_date_to_time(&date, &unix_time) == SL_STATUS_OK) && (unix_time == 951868800u),
+                "2000-03-01 Unix timestamp");
+  }
+}
+
+/***************************************************************************//**
+ * Returns a monotonic timestamp in nanoseconds.
+ ******************************************************************************/
+static uint64_t host_time_ns(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/***************************************************************************//**
+ * Times both implementations on random timestamps of a range of days.
+ ******************************************************************************/
+static void host_benchmark(const char *name, uint32_t first_day, uint32_t day_count, uint32_t count)
+{
+  sl_sleeptimer_timestamp_64_t *times = malloc(count * sizeof(*times));
+  sl_sleeptimer_date_t *dates = malloc(count * sizeof(*dates));
+  volatile uint64_t sink = 0;
+  uint64_t start_ns;
+  uint64_t new_t2d_ns;
+  uint64_t old_t2d_ns;
+  uint64_t new_d2t_ns;
+  uint64_t old_d2t_ns;
+
+  if ((times == NULL) || (dates == NULL)) {
+    fprintf(stderr, "out of host memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for (uint32_t index = 0; index < count; index++) {
+    uint64_t day = first_day + (((uint64_t)(uint32_t)rand() * RAND_MAX + (uint32_t)rand()) % day_count);
+
+    times[index] = (day * HOST_SEC_PER_DAY) + ((uint32_t)rand() % HOST_SEC_PER_DAY);
+  }
+
+  start_ns = host_time_ns();
+  for (uint32_t index = 0; index < count; index++) {
+    (void)sl_sleeptimer_convert_time_to_date_64(times[index], 0, &dates[index]);
+  }
+  new_t2d_ns = host_time_ns() - start_ns;
+
+  start_ns = host_time_ns();
+  for (uint32_t index = 0; index < count; index++) {
+    sl_sleeptimer_timestamp_64_t time;
+
+    (void)sl_sleeptimer_convert_date_to_time_64(&dates[index], &time);
+    sink += time;
+  }
+  new_d2t_ns = host_time_ns() - start_ns;
+
+  start_ns = host_time_ns();
+  for (uint32_t index = 0; index < count; index++) {
+    old_convert_time_to_date_64(times[index], 0, &dates[index]);
+  }
+  old_t2d_ns = host_time_ns() - start_ns;
+
+  start_ns = host_time_ns();
+  for (uint32_t index = 0; index < count; index++) {
+    sl_sleeptimer_timestamp_64_t time;
+
+    old_convert_date_to_time_64(&dates[index], &time);
+    sink += time;
+  }
+  old_d2t_ns = host_time_ns() - start_ns;
+
+  printf("%-12s time to date %6.1f ns (previous %6.1f ns), date to time %6.1f ns (previous %6.1f ns)\n",
+         name,
+         (double)new_t2d_ns / count, (double)old_t2d_ns / count,
+         (double)new_d2t_ns / count, (double)old_d2t_ns / count);
+  (void)sink;
+  free(times);
+  free(dates);
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Runs the calendar test and benchmark.
+ ******************************************************************************/
+int main(int argc, char *argv[])
+{
+  uint32_t seed = 1u;
+  uint32_t bench_count = HOST_BENCH_COUNT_DEFAULT;
+  int option;
+
+  while ((option = getopt(argc, argv, "r:n:")) != -1) {
+    switch (option) {
+      case 'r':
+        seed = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'n':
+        bench_count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      default:
+        fprintf(stderr, "usage: %s [-r seed] [-n conversions]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+  }
+
+  srand(seed);
+  host_check_all_days();
+  host_check_unix_days();
+  host_check_leap_years();
+  printf("%" PRIu64 " calendar checks ok\n", host_check_count);
+
+  if (bench_count > 0) {
+    host_benchmark("1900-11899", 0, 3652425u, bench_count);
+    host_benchmark("1970-2038", HOST_UNIX_EPOCH_DAY, HOST_UNIX_LAST_DAY - HOST_UNIX_EPOCH_DAY, bench_count);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,300 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sleeptimer host simulation of the EM2 exits caused by periodic timers
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Runs the sleeptimer on the virtual clock of the host HAL and counts the
+ * timer wakeups over a simulated time. On a device that sleeps in EM2 between
+ * events, each timer compare interrupt is an EM2 exit. The workload is a set of
+ * periodic timers started with random phases. It is run once per slack value,
+ * with the same phases, the slack of each timer being a percentage of its
+ * period.
+ *
+ * Usage: sl_sleeptimer_host_wakeups [options]
+ *   -p <ms>[,<ms>...]    Timer periods, at most HOST_TIMER_COUNT_MAX.
+ *                        Default: 800,1000,1500,3000,5000,10000.
+ *   -s <pct>[,<pct>...]  Slack of each run, in percent of the timer periods.
+ *                        Default: 0,5,10,25.
+ *   -H <hours>           Simulated time of each run. Default: 1.
+ *   -r <seed>            Seed of the timer phases. Default: 1.
+ *
+ * For each slack, prints the EM2 exits and the timer expirations per hour,
+ * and how late the latest expiration was. Every expiration is checked to be
+ * within the slack of its timer; the tool fails otherwise.
+ *
+ * The overflow interrupt of the counter, once every 36 hours at 32768 Hz, is
+ * not counted.
+ ******************************************************************************/
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "sl_sleeptimer.h"
+#include "sl_sleeptimer_host.h"
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+#define HOST_TIMER_COUNT_MAX   16u
+#define HOST_SLACK_COUNT_MAX   16u
+
+// Counter ticks allowed around an expiration for the rounding of the timer
+// period and slack from milliseconds to ticks.
+#define HOST_ROUNDING_TICKS    1
+
+/*******************************************************************************
+ ********************************   DATA TYPES   *******************************
+ ******************************************************************************/
+
+// Periodic timer of the workload.
+typedef struct {
+  sl_sleeptimer_timer_handle_t handle;
+  uint32_t period_ms;
+  uint32_t phase_ms;
+  uint32_t slack_ms;
+  uint64_t start_tick;
+  uint64_t expiration_count;
+} host_timer_t;
+
+/*******************************************************************************
+ ***************************  LOCAL VARIABLES   ********************************
+ ******************************************************************************/
+
+static host_timer_t host_timers[HOST_TIMER_COUNT_MAX];
+static uint32_t host_timer_count;
+
+static uint32_t host_slack_pcts[HOST_SLACK_COUNT_MAX];
+static uint32_t host_slack_count;
+
+static uint32_t host_timer_freq;
+static int64_t host_late_max_ticks;
+static uint64_t host_window_fail_count;
+
+/*******************************************************************************
+ **************************   LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Converts a duration in milliseconds to counter ticks, rounded up as done by
+ * sl_sleeptimer_ms32_to_tick().
+ ******************************************************************************/
+static uint64_t host_ms_to_ticks(uint64_t ms)
+{
+  return ((ms * host_timer_freq) + 999u) / 1000u;
+}
+
+/***************************************************************************//**
+ * Parses a comma-separated list of numbers.
+ *
+ * @return Number of values parsed, 0 if the list is invalid or too long.
+ ******************************************************************************/
+static uint32_t host_parse_list(const char *list, uint32_t *values, uint32_t count_max)
+{
+  uint32_t count = 0u;
+  const char *cursor = list;
+  char *end;
+
+  while (count < count_max) {
+    values[count++] = (uint32_t)strtoul(cursor, &end, 0);
+    if (end == cursor) {
+      return 0u;
+    }
+    if (*end == '\0') {
+      return count;
+    }
+    if (*end != ',') {
+      return 0u;
+    }
+    cursor = end + 1;
+  }
+
+  return 0u;
+}
+
+/***************************************************************************//**
+ * Checks that a timer expires within its slack.
+ ******************************************************************************/
+static void host_on_timeout(sl_sleeptimer_timer_handle_t *handle, void *data)
+{
+  host_timer_t *timer = (host_timer_t *)data;
+  uint64_t now = sl_sleeptimer_host_get_elapsed_ticks();
+  uint64_t deadline;
+  int64_t late_ticks;
+
+  (void)handle;
+
+  timer->expiration_count++;
+  deadline = timer->start_tick + host_ms_to_ticks(timer->expiration_count * timer->period_ms);
+  late_ticks = (int64_t)(now - deadline);
+
+  if ((late_ticks < -HOST_ROUNDING_TICKS)
+      || (late_ticks > (int64_t)host_ms_to_ticks(timer->slack_ms) + HOST_ROUNDING_TICKS)) {
+    if (host_window_fail_count < 10u) {
+      fprintf(stderr, "timer %td (%" PRIu32 " ms, slack %" PRIu32 " ms) expired %" PRId64 " ticks late\n",
+              timer - host_timers, timer->period_ms, timer->slack_ms, late_ticks);
+    }
+    host_window_fail_count++;
+  }
+  if (late_ticks > host_late_max_ticks) {
+    host_late_max_ticks = late_ticks;
+  }
+}
+
+/***************************************************************************//**
+ * Runs the workload with a slack and prints the wakeups per hour.
+ ******************************************************************************/
+static bool host_run(uint32_t slack_pct, uint32_t hours)
+{
+  sl_sleeptimer_wakeup_statistics_t statistics;
+  sl_status_t status;
+  uint32_t i;
+
+  host_late_max_ticks = 0;
+
+  // The timers are started one after the other, the clock being advanced by
+  // the phase of each timer before it is started.
+  for (i = 0u; i < host_timer_count; i++) {
+    host_timer_t *timer = &host_timers[i];
+
+    sl_sleeptimer_host_advance(host_ms_to_ticks(timer->phase_ms));
+    timer->slack_ms = (timer->period_ms * slack_pct) / 100u;
+    timer->expiration_count = 0u;
+    timer->start_tick = sl_sleeptimer_host_get_elapsed_ticks();
+    status = sl_sleeptimer_start_periodic_timer_ms_with_slack(&timer->handle,
+                                                              timer->period_ms,
+                                                              timer->slack_ms,
+                                                              host_on_timeout,
+                                                              timer,
+                                                              0u,
+                                                              0u);
+    if (status != SL_STATUS_OK) {
+      fprintf(stderr, "cannot start timer %" PRIu32 ": status 0x%04" PRIx32 "\n", i, (uint32_t)status);
+      return false;
+    }
+  }
+
+  sl_sleeptimer_reset_wakeup_statistics();
+  sl_sleeptimer_host_advance((uint64_t)hours * 3600u * host_timer_freq);
+  sl_sleeptimer_get_wakeup_statistics(&statistics);
+
+  for (i = 0u; i < host_timer_count; i++) {
+    sl_sleeptimer_stop_timer(&host_timers[i].handle);
+  }
+
+  printf("slack %3" PRIu32 "%%: %8" PRIu32 " EM2 exits/hour, %8" PRIu32 " expirations/hour, max late %8.3f ms\n",
+         slack_pct,
+         statistics.wakeup_count / hours,
+         statistics.expired_timer_count / hours,
+         ((double)host_late_max_ticks * 1000.0) / host_timer_freq);
+
+  return true;
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+  static const uint32_t default_periods_ms[] = { 800u, 1000u, 1500u, 3000u, 5000u, 10000u };
+  static const uint32_t default_slack_pcts[] = { 0u, 5u, 10u, 25u };
+  uint32_t periods_ms[HOST_TIMER_COUNT_MAX];
+  uint32_t hours = 1u;
+  uint32_t seed = 1u;
+  uint32_t i;
+  int option;
+
+  host_timer_count = sizeof(default_periods_ms) / sizeof(default_periods_ms[0]);
+  memcpy(periods_ms, default_periods_ms, sizeof(default_periods_ms));
+  host_slack_count = sizeof(default_slack_pcts) / sizeof(default_slack_pcts[0]);
+  memcpy(host_slack_pcts, default_slack_pcts, sizeof(default_slack_pcts));
+
+  while ((option = getopt(argc, argv, "p:s:H:r:")) != -1) {
+    switch (option) {
+      case 'p':
+        host_timer_count = host_parse_list(optarg, periods_ms, HOST_TIMER_COUNT_MAX);
+        break;
+
+      case 's':
+        host_slack_count = host_parse_list(optarg, host_slack_pcts, HOST_SLACK_COUNT_MAX);
+        break;
+
+      case 'H':
+        hours = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      case 'r':
+        seed = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+
+      default:
+        host_timer_count = 0u;
+        break;
+    }
+  }
+
+  if ((host_timer_count == 0u) || (host_slack_count == 0u) || (hours == 0u)) {
+    fprintf(stderr, "usage: %s [-p period_ms,...] [-s slack_percent,...] [-H hours] [-r seed]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // The phases are drawn once so that all the runs share them.
+  srand(seed);
+  for (i = 0u; i < host_timer_count; i++) {
+    if (periods_ms[i] == 0u) {
+      fprintf(stderr, "invalid timer period\n");
+      return EXIT_FAILURE;
+    }
+    host_timers[i].period_ms = periods_ms[i];
+    host_timers[i].phase_ms = (uint32_t)rand() % periods_ms[i];
+  }
+
+  sl_sleeptimer_init();
+  host_timer_freq = sl_sleeptimer_get_timer_frequency();
+
+  printf("%" PRIu32 " timers, %" PRIu32 " hour(s) per run, seed %" PRIu32 "\n", host_timer_count, hours, seed);
+  for (i = 0u; i < host_slack_count; i++) {
+    if (!host_run(host_slack_pcts[i], hours)) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (host_window_fail_count != 0u) {
+    fprintf(stderr, "FAIL: %" PRIu64 " expirations outside of their timer slack\n", host_window_fail_count);
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -127,6 +127,12 @@ typedef  struct  time_date {
   sl_sleeptimer_time_zone_offset_t time_zone; ///< Offset, in seconds, from UTC
 } sl_sleeptimer_date_t;
 
+/// @brief Wakeup statistics.
+typedef struct {
+  uint32_t wakeup_count;                   ///< Number of timer compare interrupts.
+  uint32_t expired_timer_count;            ///< Number of timer expirations processed in these interrupts.
+} sl_sleeptimer_wakeup_statistics_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -250,6 +256,46 @@ sl_status_t sl_sleeptimer_restart_periodic_timer(sl_sleeptimer_timer_handle_t *h
                                                  uint8_t priority,
                                                  uint16_t option_flags);
 
+/***************************************************************************//**
+ * Starts a 32 bits timer that may expire late, to share a wakeup with other
+ * timers.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param timeout Timer timeout, in timer ticks.
+ * @param slack Maximum delay after the timeout at which the timer may expire,
+ *        in timer ticks.
+ * @param callback Callback function that will be called when
+ *        initial/periodic timeout expires.
+ * @param callback_data Pointer to user data that will be passed to callback.
+ * @param priority Priority of callback. Useful in case multiple timer expire
+ *        at the same time. 0 = highest priority.
+ * @param option_flags Bit array of option flags for the timer.
+ *        Valid bit-wise OR of one or more of the following:
+ *          - SL_SLEEPTIMER_NO_HIGH_PRECISION_HF_CLOCKS_REQUIRED_FLAG
+ *        or 0 for not flags.
+ *
+ * @note The timer never expires before its timeout. The timer compare is set
+ *       at the latest time at which every timer expired by then is still
+ *       within its slack, so that these timers expire in a single interrupt.
+ *
+ * @note At most SL_SLEEPTIMER_SLACK_TIMER_COUNT timers with a non-zero slack
+ *       can run at the same time. Starting one more returns
+ *       SL_STATUS_NO_MORE_RESOURCE.
+ *
+ * @note This function cannot be called from an interrupt with a higher
+ *       priority than BASEPRI.
+ *
+ * @return SL_STATUS_OK if successful. Error code otherwise.
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+sl_status_t sl_sleeptimer_start_timer_with_slack(sl_sleeptimer_timer_handle_t *handle,
+                                                 uint32_t timeout,
+                                                 uint32_t slack,
+                                                 sl_sleeptimer_timer_callback_t callback,
+                                                 void *callback_data,
+                                                 uint8_t priority,
+                                                 uint16_t option_flags);
+
 /***************************************************************************//**
  * Stops a timer.
  *
@@ -305,6 +351,21 @@ SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
 sl_status_t sl_sleeptimer_get_remaining_time_of_first_timer(uint16_t option_flags,
                                                             uint32_t *time_remaining);
 
+/***************************************************************************//**
+ * Gets the wakeup statistics.
+ *
+ * @param statistics Pointer to the statistics, counted since initialization or
+ *        since the last call to sl_sleeptimer_reset_wakeup_statistics().
+ *
+ * @return SL_STATUS_OK if successful. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_get_wakeup_statistics(sl_sleeptimer_wakeup_statistics_t *statistics);
+
+/***************************************************************************//**
+ * Resets the wakeup statistics.
+ ******************************************************************************/
+void sl_sleeptimer_reset_wakeup_statistics(void);
+
 /***************************************************************************//**
  * Gets current 32 bits global tick count.
  *
@@ -879,6 +940,42 @@ sl_status_t sl_sleeptimer_start_periodic_timer_ms(sl_sleeptimer_timer_handle_t *
                                                   uint8_t priority,
                                                   uint16_t option_flags);
 
+/***************************************************************************//**
+ * Starts a 32 bits periodic timer using milliseconds as the timebase, that may
+ * expire late to share a wakeup with other timers.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param timeout_ms Timer periodic timeout, in milliseconds.
+ * @param slack_ms Maximum delay after each timeout at which the timer may
+ *        expire, in milliseconds.
+ * @param callback Callback function that will be called when
+ *        initial/periodic timeout expires.
+ * @param callback_data Pointer to user data that will be passed to callback.
+ * @param priority Priority of callback. Useful in case multiple timer expire
+ *        at the same time. 0 = highest priority.
+ * @param option_flags Bit array of option flags for the timer.
+ *        Valid bit-wise OR of one or more of the following:
+ *          - SL_SLEEPTIMER_NO_HIGH_PRECISION_HF_CLOCKS_REQUIRED_FLAG
+ *        or 0 for not flags.
+ *
+ * @return SL_STATUS_OK if successful. Error code otherwise.
+ *
+ * @note A late expiration does not shift the following ones. See
+ *       sl_sleeptimer_start_timer_with_slack() for how timers share a wakeup,
+ *       and for the number of timers with a slack.
+ *
+ * @note This function cannot be called from an interrupt with a higher
+ *       priority than BASEPRI.
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SLEEPTIMER, SL_CODE_CLASS_TIME_CRITICAL)
+sl_status_t sl_sleeptimer_start_periodic_timer_ms_with_slack(sl_sleeptimer_timer_handle_t *handle,
+                                                             uint32_t timeout_ms,
+                                                             uint32_t slack_ms,
+                                                             sl_sleeptimer_timer_callback_t callback,
+                                                             void *callback_data,
+                                                             uint8_t priority,
+                                                             uint16_t option_flags);
+
 /***************************************************************************//**
  * Restarts a 32 bits periodic timer.
  *
@@ -1077,6 +1174,7 @@ uint16_t sl_sleeptimer_get_clock_accuracy(void);
 ///   | `SL_SLEEPTIMER_PERIPHERAL_RTC`    | Selects RTC                                                                                          |
 ///   | `SL_SLEEPTIMER_PERIPHERAL_PRORTC` | Selects Internal radio RTC. Available only on EFR32XG13, EFR32XG14, EFR32XG21 and EFR32XG22 families.|
 ///   | `SL_SLEEPTIMER_PERIPHERAL_BURTC`  | Selects BURTC. Not available on Series 0 devices.                                                    |
+///   | `SL_SLEEPTIMER_PERIPHERAL_HOST`   | Virtual clock for host simulation. Default selection when `SL_SLEEPTIMER_HOST_BUILD` is defined.     |
 ///
 ///   `SL_SLEEPTIMER_WALLCLOCK_CONFIG` must be set to 1 to enable timestamp and date functionnalities.
 ///
@@ -1084,6 +1182,20 @@ uint16_t sl_sleeptimer_get_clock_accuracy(void);
 ///
 ///   `SL_SLEEPTIMER_PRORTC_HAL_OWNS_IRQ_HANDLER` is only meaningful when `SL_SLEEPTIMER_PERIPHERAL` is set to `SL_SLEEPTIMER_PERIPHERAL_PRORTC`. Set to 1 if no communication stack is used in your project. Otherwise, must be set to 0.
 ///
+///   With `SL_SLEEPTIMER_PERIPHERAL_HOST`, the clock only moves when the simulation calls sl_sleeptimer_host_advance()
+///   or sl_sleeptimer_host_advance_to_next_event(), declared in sl_sleeptimer_host.h. Its frequency is set by
+///   `SL_SLEEPTIMER_HOST_TIMER_FREQUENCY`, 32768 Hz by default, divided by `SL_SLEEPTIMER_FREQ_DIVIDER`.
+///
+///   `SL_SLEEPTIMER_TIMER_QUEUE` selects how running timers are kept:
+///
+///   | Config                                 | Description                                                                                                     |
+///   | -------------------------------------- |-----------------------------------------------------------------------------------------------------------------|
+///   | `SL_SLEEPTIMER_TIMER_QUEUE_DELTA_LIST` | Sorted list of delays. Needs no memory. Starting, stopping and querying a timer walk the list.                  |
+///   | `SL_SLEEPTIMER_TIMER_QUEUE_MIN_HEAP`   | Binary min-heap of absolute deadlines. Starting and stopping a timer take a time logarithmic in the timer count. |
+///
+///   The min-heap holds up to `SL_SLEEPTIMER_TIMER_HEAP_SIZE` timers. Timers started while it is full are kept in a
+///   delta list instead, so starting them takes a time proportional to the number of such timers.
+///
 ///   @n @section sleeptimer_api The API
 ///
 ///   This section contains brief descriptions of the API functions. For
@@ -1124,6 +1236,14 @@ uint16_t sl_sleeptimer_get_clock_accuracy(void);
 ///     sl_sleeptimer_start_timer(). See @ref sl_sleeptimer_timer_callback_t for
 ///    details of the callback prototype.
 ///
+///   @ref sl_sleeptimer_start_timer_with_slack(),
+///   @ref sl_sleeptimer_start_periodic_timer_ms_with_slack() @n
+///    Start a timer that may expire up to a given delay late. Timers whose
+///    expirations fall within each other's slack share a single wakeup.
+///
+///   @ref sl_sleeptimer_get_wakeup_statistics() @n
+///    Get the number of timer wakeups and of timers expired in them.
+///
 ///   @ref sl_sleeptimer_stop_timer() @n
 ///    Stop a timer.
 ///
@@ -0,0 +1,121 @@
+/***************************************************************************//**
+ * @file
+ * @brief SLEEPTIMER virtual clock control, for host simulation.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * @addtogroup sleeptimer Sleep Timer
+ * @{
+ ******************************************************************************/
+
+#ifndef SL_SLEEPTIMER_HOST_H
+#define SL_SLEEPTIMER_HOST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Function called before each read of a virtual register.
+typedef void (*sl_sleeptimer_host_read_hook_t)(void);
+
+/***************************************************************************//**
+ * Sets the virtual counter value.
+ *
+ * @param[in] count Counter value, in ticks.
+ *
+ * @note Must be called before sl_sleeptimer_init(). Setting the counter
+ *       close to UINT32_MAX lets a simulation reach the counter wrap-around
+ *       quickly.
+ ******************************************************************************/
+void sl_sleeptimer_host_set_counter(uint32_t count);
+
+/***************************************************************************//**
+ * Advances the virtual clock by a number of ticks.
+ *
+ * @param[in] ticks Number of ticks.
+ *
+ * @note (1) The clock is moved from one compare match or overflow to the next,
+ *           and the sleeptimer interrupt is handled at each of them. Timer
+ *           callbacks are called from this function.
+ *
+ * @note (2) Calling this function with 0 ticks only handles the pending
+ *           interrupts, such as the one raised when a timer is started with
+ *           a timeout of 0.
+ ******************************************************************************/
+void sl_sleeptimer_host_advance(uint64_t ticks);
+
+/***************************************************************************//**
+ * Advances the virtual clock up to the next compare match or overflow.
+ *
+ * @return Number of ticks the clock was advanced by.
+ *
+ * @note Lets a simulation run from one timer expiration to the next without
+ *       stepping through idle time.
+ ******************************************************************************/
+uint64_t sl_sleeptimer_host_advance_to_next_event(void);
+
+/***************************************************************************//**
+ * Gets the number of ticks the virtual clock was advanced by.
+ *
+ * @return Number of ticks. Does not wrap around with the counter.
+ ******************************************************************************/
+uint64_t sl_sleeptimer_host_get_elapsed_ticks(void);
+
+/***************************************************************************//**
+ * Sets a function called before each read of the virtual counter or
+ * interrupt flags by the sleeptimer.
+ *
+ * @param[in] hook Function to call, or NULL to remove it.
+ *
+ * @note The function can advance the virtual clock, so that the interrupt
+ *       preempts the code reading the register at that exact point.
+ ******************************************************************************/
+void sl_sleeptimer_host_set_read_hook(sl_sleeptimer_host_read_hook_t hook);
+
+/***************************************************************************//**
+ * Masks or unmasks the virtual interrupt.
+ *
+ * @param[in] masked true to mask the interrupt, false to unmask it.
+ *
+ * @note While the interrupt is masked, the virtual clock still raises the
+ *       interrupt flags but the interrupt is not handled, like for code
+ *       running in a critical section or at a higher priority. The pending
+ *       interrupts are handled when it is unmasked.
+ ******************************************************************************/
+void sl_sleeptimer_host_set_irq_masked(bool masked);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} (end addtogroup sleeptimer) */
+
+#endif // SL_SLEEPTIMER_HOST_H
@@ -44,8 +44,15 @@
 #define SLI_SLEEPTIMER_POWER_MANAGER_EARLY_WAKEUP_TIMER_FLAG 0x02
 #define SLI_SLEEPTIMER_POWER_MANAGER_HF_ACCURACY_CLK_FLAG 0x04
 
+#ifndef SL_SLEEPTIMER_PERIPHERAL_HOST
+#define SL_SLEEPTIMER_PERIPHERAL_HOST    8
+#endif
+
 #if SL_SLEEPTIMER_PERIPHERAL == SL_SLEEPTIMER_PERIPHERAL_DEFAULT
-#if defined(RTCC_PRESENT) && RTCC_COUNT >= 1
+#if defined(SL_SLEEPTIMER_HOST_BUILD)
+#undef SL_SLEEPTIMER_PERIPHERAL
+#define SL_SLEEPTIMER_PERIPHERAL SL_SLEEPTIMER_PERIPHERAL_HOST
+#elif defined(RTCC_PRESENT) && RTCC_COUNT >= 1
 #undef SL_SLEEPTIMER_PERIPHERAL
 #define SL_SLEEPTIMER_PERIPHERAL SL_SLEEPTIMER_PERIPHERAL_RTCC
 #elif defined(RTC_PRESENT) && RTC_COUNT >= 1
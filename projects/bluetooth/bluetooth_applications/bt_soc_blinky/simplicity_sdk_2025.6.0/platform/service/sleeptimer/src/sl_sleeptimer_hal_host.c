@@ -0,0 +1,414 @@
+/***************************************************************************//**
+ * @file
+ * @brief SLEEPTIMER hardware abstraction implementation for a virtual clock.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sl_sleeptimer.h"
+#include "sl_sleeptimer_host.h"
+#include "sli_sleeptimer_hal.h"
+#include "sl_core.h"
+
+#if SL_SLEEPTIMER_PERIPHERAL == SL_SLEEPTIMER_PERIPHERAL_HOST
+
+// Minimum difference between current count value and what the comparator of the timer can be set to.
+// The virtual comparator matches on the exact tick, so no compensation tick is needed.
+#define SLEEPTIMER_COMPARE_MIN_DIFF  1
+
+// Number of ticks between two overflows of the virtual counter.
+#define SLEEPTIMER_TMR_TICKS         (UINT32_MAX + (uint64_t)1)
+
+#ifndef SL_SLEEPTIMER_HOST_TIMER_FREQUENCY
+#define SL_SLEEPTIMER_HOST_TIMER_FREQUENCY  32768UL
+#endif
+
+// Virtual counter register.
+static uint32_t counter;
+
+// Virtual compare register.
+static uint32_t compare;
+
+// Virtual interrupt enable and flag registers, in SLEEPTIMER_EVENT_* flags.
+static uint8_t int_enable;
+static uint8_t int_flag;
+
+// Ticks elapsed since the virtual clock was created.
+static uint64_t elapsed_ticks;
+
+static bool is_timer_initialized = false;
+
+// Virtual interrupt mask.
+static bool is_irq_masked = false;
+
+// Function called before each register read.
+static sl_sleeptimer_host_read_hook_t read_hook = NULL;
+
+__STATIC_INLINE uint32_t get_time_diff(uint32_t a,
+                                       uint32_t b);
+
+static uint64_t get_ticks_to_next_event(void);
+
+static void advance_counter(uint64_t ticks);
+
+static void irq_handler(void);
+
+/******************************************************************************
+ * Initializes the virtual sleep timer.
+ *****************************************************************************/
+void sleeptimer_hal_init_timer(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  int_enable = 0;
+  int_flag = 0;
+  is_timer_initialized = true;
+  CORE_EXIT_ATOMIC();
+}
+
+/******************************************************************************
+ * Gets the virtual counter value.
+ *****************************************************************************/
+uint32_t sleeptimer_hal_get_counter(void)
+{
+  if (read_hook != NULL) {
+    read_hook();
+  }
+  return counter;
+}
+
+/******************************************************************************
+ * Gets the virtual compare value.
+ *****************************************************************************/
+uint32_t sleeptimer_hal_get_compare(void)
+{
+  return compare;
+}
+
+/******************************************************************************
+ * Sets the virtual compare value.
+ *
+ * @note The compare match is raised when the counter reaches the compare value.
+ *****************************************************************************/
+void sleeptimer_hal_set_compare(uint32_t value)
+{
+  CORE_DECLARE_IRQ_STATE;
+  uint32_t compare_value = value;
+
+  CORE_ENTER_CRITICAL();
+  // Add margin if necessary
+  if (get_time_diff(compare_value, counter) < SLEEPTIMER_COMPARE_MIN_DIFF) {
+    compare_value = counter + SLEEPTIMER_COMPARE_MIN_DIFF;
+  }
+  compare = compare_value;
+
+  sleeptimer_hal_enable_int(SLEEPTIMER_EVENT_COMP);
+  CORE_EXIT_CRITICAL();
+}
+
+/******************************************************************************
+ * Sets the compare value triggering the HFXO startup.
+ *
+ * @note There is no HFXO to start on the host.
+ *****************************************************************************/
+void sleeptimer_hal_set_compare_prs_hfxo_startup(int32_t value)
+{
+  (void)value;
+}
+
+/******************************************************************************
+ * Enables virtual interrupts.
+ *****************************************************************************/
+void sleeptimer_hal_enable_int(uint8_t local_flag)
+{
+  int_enable |= local_flag & (SLEEPTIMER_EVENT_OF | SLEEPTIMER_EVENT_COMP);
+}
+
+/******************************************************************************
+ * Disables virtual interrupts.
+ *****************************************************************************/
+void sleeptimer_hal_disable_int(uint8_t local_flag)
+{
+  int_enable &= ~local_flag;
+}
+
+/*******************************************************************************
+ * Hardware Abstraction Layer to set timer interrupts.
+ *
+ * @note The interrupt is handled on the next call to
+ *       sl_sleeptimer_host_advance() or
+ *       sl_sleeptimer_host_advance_to_next_event().
+ ******************************************************************************/
+void sleeptimer_hal_set_int(uint8_t local_flag)
+{
+  int_flag |= local_flag & SLEEPTIMER_EVENT_COMP;
+}
+
+/******************************************************************************
+ * Gets status of specified interrupt.
+ *
+ * Note: This function must be called with interrupts disabled.
+ *****************************************************************************/
+bool sli_sleeptimer_hal_is_int_status_set(uint8_t local_flag)
+{
+  bool int_is_set = false;
+
+  if (read_hook != NULL) {
+    read_hook();
+  }
+
+  switch (local_flag) {
+    case SLEEPTIMER_EVENT_COMP:
+    case SLEEPTIMER_EVENT_OF:
+      int_is_set = ((int_flag & local_flag) == local_flag);
+      break;
+
+    default:
+      break;
+  }
+
+  return int_is_set;
+}
+
+/*******************************************************************************
+ * Gets the virtual timer frequency.
+ ******************************************************************************/
+uint32_t sleeptimer_hal_get_timer_frequency(void)
+{
+  return (SL_SLEEPTIMER_HOST_TIMER_FREQUENCY / SL_SLEEPTIMER_FREQ_DIVIDER);
+}
+
+/*******************************************************************************
+ * @brief
+ *   Gets the precision (in PPM) of the sleeptimer's clock.
+ *
+ * @return
+ *   Clock accuracy, in PPM. The virtual clock does not drift.
+ *
+ ******************************************************************************/
+uint16_t sleeptimer_hal_get_clock_accuracy(void)
+{
+  return 0;
+}
+
+/*******************************************************************************
+ * Hardware Abstraction Layer to get the capture channel value.
+ ******************************************************************************/
+uint32_t sleeptimer_hal_get_capture(void)
+{
+  // Invalid for the virtual clock
+  EFM_ASSERT(0);
+  return 0;
+}
+
+/*******************************************************************************
+ * Hardware Abstraction Layer to reset PRS signal triggered by the associated
+ * peripheral.
+ ******************************************************************************/
+void sleeptimer_hal_reset_prs_signal(void)
+{
+  // Invalid for the virtual clock
+  EFM_ASSERT(0);
+}
+
+/*******************************************************************************
+ * Hardware Abstraction Layer to disable PRS compare and capture channel.
+ ******************************************************************************/
+void sleeptimer_hal_disable_prs_compare_and_capture_channel(void)
+{
+}
+
+/***************************************************************************//**
+ * Set lowest energy mode based on a project's configurations and clock source
+ *
+ * @note If power_manager_no_deepsleep component is included in a project, the
+ *       lowest possible energy mode is EM1, else lowest energy mode is
+ *       determined by peripheral used.
+ ******************************************************************************/
+#if defined(SL_CATALOG_POWER_MANAGER_PRESENT)
+void sli_sleeptimer_set_pm_em_requirement(void)
+{
+  // No EM requirement to add, the virtual clock keeps counting in any
+  // energy mode.
+}
+#endif
+
+/***************************************************************************//**
+ * Sets the virtual counter value.
+ ******************************************************************************/
+void sl_sleeptimer_host_set_counter(uint32_t count)
+{
+  EFM_ASSERT(!is_timer_initialized);
+
+  counter = count;
+}
+
+/***************************************************************************//**
+ * Advances the virtual clock.
+ ******************************************************************************/
+void sl_sleeptimer_host_advance(uint64_t ticks)
+{
+  uint64_t ticks_left = ticks;
+
+  irq_handler();
+  while (ticks_left > 0) {
+    uint64_t step = get_ticks_to_next_event();
+
+    if (step > ticks_left) {
+      step = ticks_left;
+    }
+    advance_counter(step);
+    ticks_left -= step;
+  }
+}
+
+/***************************************************************************//**
+ * Advances the virtual clock up to its next compare match or overflow.
+ ******************************************************************************/
+uint64_t sl_sleeptimer_host_advance_to_next_event(void)
+{
+  uint64_t step;
+
+  irq_handler();
+  step = get_ticks_to_next_event();
+  advance_counter(step);
+
+  return step;
+}
+
+/***************************************************************************//**
+ * Gets the ticks elapsed on the virtual clock.
+ ******************************************************************************/
+uint64_t sl_sleeptimer_host_get_elapsed_ticks(void)
+{
+  return elapsed_ticks;
+}
+
+/***************************************************************************//**
+ * Sets the function called before each register read.
+ ******************************************************************************/
+void sl_sleeptimer_host_set_read_hook(sl_sleeptimer_host_read_hook_t hook)
+{
+  read_hook = hook;
+}
+
+/***************************************************************************//**
+ * Masks or unmasks the virtual interrupt.
+ ******************************************************************************/
+void sl_sleeptimer_host_set_irq_masked(bool masked)
+{
+  is_irq_masked = masked;
+  irq_handler();
+}
+
+/*******************************************************************************
+ * Computes difference between two times taking into account timer wrap-around.
+ *
+ * @param a Time.
+ * @param b Time to substract from a.
+ *
+ * @return Time difference.
+ ******************************************************************************/
+__STATIC_INLINE uint32_t get_time_diff(uint32_t a,
+                                       uint32_t b)
+{
+  return (a - b);
+}
+
+/*******************************************************************************
+ * Gets the number of ticks until the next compare match or overflow.
+ *
+ * @return Number of ticks, from 1 to one full counter period.
+ ******************************************************************************/
+static uint64_t get_ticks_to_next_event(void)
+{
+  uint64_t ticks = SLEEPTIMER_TMR_TICKS - counter;
+
+  if ((int_enable & SLEEPTIMER_EVENT_COMP) != 0) {
+    uint32_t ticks_to_compare = get_time_diff(compare, counter);
+
+    if ((ticks_to_compare != 0) && (ticks_to_compare < ticks)) {
+      ticks = ticks_to_compare;
+    }
+  }
+
+  return ticks;
+}
+
+/*******************************************************************************
+ * Moves the virtual counter forward, raising the interrupts for the events
+ * reached.
+ *
+ * @param ticks Number of ticks, at most up to the next event.
+ *
+ * @note (1) Like the CC channels of the RTCC, the comparator only matches while
+ *           its interrupt is enabled.
+ ******************************************************************************/
+static void advance_counter(uint64_t ticks)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  counter += (uint32_t)ticks;
+  elapsed_ticks += ticks;
+
+  if (counter == 0) {
+    int_flag |= SLEEPTIMER_EVENT_OF;
+  }
+  // See Note #1.
+  if (((int_enable & SLEEPTIMER_EVENT_COMP) != 0)
+      && (counter == compare)) {
+    int_flag |= SLEEPTIMER_EVENT_COMP;
+  }
+  CORE_EXIT_ATOMIC();
+
+  irq_handler();
+}
+
+/*******************************************************************************
+ * Virtual interrupt handler. Handles every pending enabled interrupt, unless
+ * the interrupt is masked.
+ ******************************************************************************/
+static void irq_handler(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+  uint8_t local_flag;
+
+  if (is_irq_masked) {
+    return;
+  }
+
+  CORE_ENTER_ATOMIC();
+  local_flag = int_flag & int_enable;
+  while (local_flag != 0) {
+    int_flag &= ~local_flag;
+    process_timer_irq(local_flag);
+    local_flag = int_flag & int_enable;
+  }
+  CORE_EXIT_ATOMIC();
+}
+#endif
@@ -127,6 +127,72 @@
 
 /* END-driver id */
 
+/* SiLabs static hash dispatch: a firmware image has exactly one SiLabs hash
+ * accelerator, and the algorithms it handles are known at build time, so
+ * hash entry points can route on the algorithm instead of probing every
+ * driver in turn. Compute and setup call the one driver for the algorithm;
+ * clone, update, finish and abort only compare the operation with the
+ * accelerator and the builtin driver ids. */
+#if defined(SLI_PSA_DRIVER_FEATURE_STATIC_HASH_DISPATCH) \
+    && defined(MBEDTLS_PSA_CRYPTO_DRIVERS) && !defined(PSA_CRYPTO_DRIVER_TEST)
+#if defined(SLI_MBEDTLS_DEVICE_HC) && ( defined(SLI_MBEDTLS_DEVICE_HSE) \
+    || defined(SLI_MBEDTLS_DEVICE_VSE) || defined(SLI_MBEDTLS_DEVICE_S1) )
+/* The hostcrypto driver is probed ahead of the accelerator, which static
+ * dispatch cannot express. */
+#error "Static hash dispatch does not support the hostcrypto driver combined with a hash accelerator"
+#endif
+#if defined(SLI_MBEDTLS_DEVICE_HSE)
+#define SLI_PSA_STATIC_HASH_DRIVER( entry ) sli_se_transparent_hash_ ## entry
+#define SLI_PSA_STATIC_HASH_CTX sli_se_transparent_ctx
+#define SLI_PSA_STATIC_HASH_DRIVER_ID SLI_SE_TRANSPARENT_DRIVER_ID
+#elif defined(SLI_MBEDTLS_DEVICE_VSE)
+#define SLI_PSA_STATIC_HASH_DRIVER( entry ) sli_cryptoacc_transparent_hash_ ## entry
+#define SLI_PSA_STATIC_HASH_CTX sli_cryptoacc_transparent_ctx
+#define SLI_PSA_STATIC_HASH_DRIVER_ID SLI_CRYPTOACC_TRANSPARENT_DRIVER_ID
+#elif defined(SLI_MBEDTLS_DEVICE_S1)
+#define SLI_PSA_STATIC_HASH_DRIVER( entry ) sli_crypto_transparent_hash_ ## entry
+#define SLI_PSA_STATIC_HASH_CTX sli_crypto_transparent_ctx
+#define SLI_PSA_STATIC_HASH_DRIVER_ID SLI_CRYPTO_TRANSPARENT_DRIVER_ID
+#endif
+#endif /* SLI_PSA_DRIVER_FEATURE_STATIC_HASH_DISPATCH */
+
+#if defined(SLI_PSA_STATIC_HASH_DRIVER_ID)
+#if defined(SLI_PSA_DRIVER_FEATURE_SHA1)
+#define SLI_PSA_STATIC_HASH_ACCEL_SHA_1( alg ) ( ( alg ) == PSA_ALG_SHA_1 )
+#else
+#define SLI_PSA_STATIC_HASH_ACCEL_SHA_1( alg ) ( 0 )
+#endif
+#if defined(SLI_PSA_DRIVER_FEATURE_SHA224)
+#define SLI_PSA_STATIC_HASH_ACCEL_SHA_224( alg ) ( ( alg ) == PSA_ALG_SHA_224 )
+#else
+#define SLI_PSA_STATIC_HASH_ACCEL_SHA_224( alg ) ( 0 )
+#endif
+#if defined(SLI_PSA_DRIVER_FEATURE_SHA256)
+#define SLI_PSA_STATIC_HASH_ACCEL_SHA_256( alg ) ( ( alg ) == PSA_ALG_SHA_256 )
+#else
+#define SLI_PSA_STATIC_HASH_ACCEL_SHA_256( alg ) ( 0 )
+#endif
+#if defined(SLI_PSA_DRIVER_FEATURE_SHA384)
+#define SLI_PSA_STATIC_HASH_ACCEL_SHA_384( alg ) ( ( alg ) == PSA_ALG_SHA_384 )
+#else
+#define SLI_PSA_STATIC_HASH_ACCEL_SHA_384( alg ) ( 0 )
+#endif
+#if defined(SLI_PSA_DRIVER_FEATURE_SHA512)
+#define SLI_PSA_STATIC_HASH_ACCEL_SHA_512( alg ) ( ( alg ) == PSA_ALG_SHA_512 )
+#else
+#define SLI_PSA_STATIC_HASH_ACCEL_SHA_512( alg ) ( 0 )
+#endif
+
+/* True when the accelerator handles alg, in which case it is the only driver
+ * that needs to be called. */
+#define SLI_PSA_STATIC_HASH_IS_ACCEL( alg )        \
+    ( SLI_PSA_STATIC_HASH_ACCEL_SHA_1( alg )       \
+      || SLI_PSA_STATIC_HASH_ACCEL_SHA_224( alg )  \
+      || SLI_PSA_STATIC_HASH_ACCEL_SHA_256( alg )  \
+      || SLI_PSA_STATIC_HASH_ACCEL_SHA_384( alg )  \
+      || SLI_PSA_STATIC_HASH_ACCEL_SHA_512( alg ) )
+#endif /* SLI_PSA_STATIC_HASH_DRIVER_ID */
+
 /* BEGIN-Common Macro definitions */
 
 /* END-Common Macro definitions */
@@ -2585,6 +2651,22 @@ static inline psa_status_t psa_driver_wrapper_hash_compute(
     size_t hash_size,
     size_t *hash_length)
 {
+#if defined(SLI_PSA_STATIC_HASH_DRIVER_ID)
+    if( SLI_PSA_STATIC_HASH_IS_ACCEL( alg ) )
+        return( SLI_PSA_STATIC_HASH_DRIVER( compute )(
+                    alg, input, input_length, hash, hash_size, hash_length ) );
+#if defined(MBEDTLS_PSA_BUILTIN_HASH)
+    return( mbedtls_psa_hash_compute( alg, input, input_length,
+                                      hash, hash_size, hash_length ) );
+#else
+    (void) input;
+    (void) input_length;
+    (void) hash;
+    (void) hash_size;
+    (void) hash_length;
+    return( PSA_ERROR_NOT_SUPPORTED );
+#endif
+#else /* SLI_PSA_STATIC_HASH_DRIVER_ID */
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
 
     /* Try accelerators first */
@@ -2643,12 +2725,34 @@ static inline psa_status_t psa_driver_wrapper_hash_compute(
     (void) hash_length;
 
     return( PSA_ERROR_NOT_SUPPORTED );
+#endif /* SLI_PSA_STATIC_HASH_DRIVER_ID */
 }
 
 static inline psa_status_t psa_driver_wrapper_hash_setup(
     psa_hash_operation_t *operation,
     psa_algorithm_t alg )
 {
+#if defined(SLI_PSA_STATIC_HASH_DRIVER_ID)
+    psa_status_t status;
+
+    if( SLI_PSA_STATIC_HASH_IS_ACCEL( alg ) )
+    {
+        status = SLI_PSA_STATIC_HASH_DRIVER( setup )(
+                    &operation->ctx.SLI_PSA_STATIC_HASH_CTX, alg );
+        if( status == PSA_SUCCESS )
+            operation->id = SLI_PSA_STATIC_HASH_DRIVER_ID;
+        return( status );
+    }
+#if defined(MBEDTLS_PSA_BUILTIN_HASH)
+    status = mbedtls_psa_hash_setup( &operation->ctx.mbedtls_ctx, alg );
+    if( status == PSA_SUCCESS )
+        operation->id = PSA_CRYPTO_MBED_TLS_DRIVER_ID;
+    return( status );
+#else
+    (void) status;
+    return( PSA_ERROR_NOT_SUPPORTED );
+#endif
+#else /* SLI_PSA_STATIC_HASH_DRIVER_ID */
     psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
 
     /* Try setup on accelerators first */
@@ -2714,12 +2818,32 @@ static inline psa_status_t psa_driver_wrapper_hash_setup(
     (void) operation;
     (void) alg;
     return( PSA_ERROR_NOT_SUPPORTED );
+#endif /* SLI_PSA_STATIC_HASH_DRIVER_ID */
 }
 
 static inline psa_status_t psa_driver_wrapper_hash_clone(
     const psa_hash_operation_t *source_operation,
     psa_hash_operation_t *target_operation )
 {
+#if defined(SLI_PSA_STATIC_HASH_DRIVER_ID)
+    if( source_operation->id == SLI_PSA_STATIC_HASH_DRIVER_ID )
+    {
+        target_operation->id = SLI_PSA_STATIC_HASH_DRIVER_ID;
+        return( SLI_PSA_STATIC_HASH_DRIVER( clone )(
+                    &source_operation->ctx.SLI_PSA_STATIC_HASH_CTX,
+                    &target_operation->ctx.SLI_PSA_STATIC_HASH_CTX ) );
+    }
+#if defined(MBEDTLS_PSA_BUILTIN_HASH)
+    if( source_operation->id == PSA_CRYPTO_MBED_TLS_DRIVER_ID )
+    {
+        target_operation->id = PSA_CRYPTO_MBED_TLS_DRIVER_ID;
+        return( mbedtls_psa_hash_clone( &source_operation->ctx.mbedtls_ctx,
+                                        &target_operation->ctx.mbedtls_ctx ) );
+    }
+#endif
+    (void) target_operation;
+    return( PSA_ERROR_BAD_STATE );
+#else /* SLI_PSA_STATIC_HASH_DRIVER_ID */
     switch( source_operation->id )
     {
 #if defined(MBEDTLS_PSA_BUILTIN_HASH)
@@ -2769,6 +2893,7 @@ static inline psa_status_t psa_driver_wrapper_hash_clone(
             (void) target_operation;
             return( PSA_ERROR_BAD_STATE );
     }
+#endif /* SLI_PSA_STATIC_HASH_DRIVER_ID */
 }
 
 static inline psa_status_t psa_driver_wrapper_hash_update(
@@ -2776,6 +2901,20 @@ static inline psa_status_t psa_driver_wrapper_hash_update(
     const uint8_t *input,
     size_t input_length )
 {
+#if defined(SLI_PSA_STATIC_HASH_DRIVER_ID)
+    if( operation->id == SLI_PSA_STATIC_HASH_DRIVER_ID )
+        return( SLI_PSA_STATIC_HASH_DRIVER( update )(
+                    &operation->ctx.SLI_PSA_STATIC_HASH_CTX,
+                    input, input_length ) );
+#if defined(MBEDTLS_PSA_BUILTIN_HASH)
+    if( operation->id == PSA_CRYPTO_MBED_TLS_DRIVER_ID )
+        return( mbedtls_psa_hash_update( &operation->ctx.mbedtls_ctx,
+                                         input, input_length ) );
+#endif
+    (void) input;
+    (void) input_length;
+    return( PSA_ERROR_BAD_STATE );
+#else /* SLI_PSA_STATIC_HASH_DRIVER_ID */
     switch( operation->id )
     {
 #if defined(MBEDTLS_PSA_BUILTIN_HASH)
@@ -2820,6 +2959,7 @@ static inline psa_status_t psa_driver_wrapper_hash_update(
             (void) input_length;
             return( PSA_ERROR_BAD_STATE );
     }
+#endif /* SLI_PSA_STATIC_HASH_DRIVER_ID */
 }
 
 static inline psa_status_t psa_driver_wrapper_hash_finish(
@@ -2828,6 +2968,21 @@ static inline psa_status_t psa_driver_wrapper_hash_finish(
     size_t hash_size,
     size_t *hash_length )
 {
+#if defined(SLI_PSA_STATIC_HASH_DRIVER_ID)
+    if( operation->id == SLI_PSA_STATIC_HASH_DRIVER_ID )
+        return( SLI_PSA_STATIC_HASH_DRIVER( finish )(
+                    &operation->ctx.SLI_PSA_STATIC_HASH_CTX,
+                    hash, hash_size, hash_length ) );
+#if defined(MBEDTLS_PSA_BUILTIN_HASH)
+    if( operation->id == PSA_CRYPTO_MBED_TLS_DRIVER_ID )
+        return( mbedtls_psa_hash_finish( &operation->ctx.mbedtls_ctx,
+                                         hash, hash_size, hash_length ) );
+#endif
+    (void) hash;
+    (void) hash_size;
+    (void) hash_length;
+    return( PSA_ERROR_BAD_STATE );
+#else /* SLI_PSA_STATIC_HASH_DRIVER_ID */
     switch( operation->id )
     {
 #if defined(MBEDTLS_PSA_BUILTIN_HASH)
@@ -2873,11 +3028,22 @@ static inline psa_status_t psa_driver_wrapper_hash_finish(
             (void) hash_length;
             return( PSA_ERROR_BAD_STATE );
     }
+#endif /* SLI_PSA_STATIC_HASH_DRIVER_ID */
 }
 
 static inline psa_status_t psa_driver_wrapper_hash_abort(
     psa_hash_operation_t *operation )
 {
+#if defined(SLI_PSA_STATIC_HASH_DRIVER_ID)
+    if( operation->id == SLI_PSA_STATIC_HASH_DRIVER_ID )
+        return( SLI_PSA_STATIC_HASH_DRIVER( abort )(
+                    &operation->ctx.SLI_PSA_STATIC_HASH_CTX ) );
+#if defined(MBEDTLS_PSA_BUILTIN_HASH)
+    if( operation->id == PSA_CRYPTO_MBED_TLS_DRIVER_ID )
+        return( mbedtls_psa_hash_abort( &operation->ctx.mbedtls_ctx ) );
+#endif
+    return( PSA_ERROR_BAD_STATE );
+#else /* SLI_PSA_STATIC_HASH_DRIVER_ID */
     switch( operation->id )
     {
 #if defined(MBEDTLS_PSA_BUILTIN_HASH)
@@ -2914,6 +3080,7 @@ static inline psa_status_t psa_driver_wrapper_hash_abort(
         default:
             return( PSA_ERROR_BAD_STATE );
     }
+#endif /* SLI_PSA_STATIC_HASH_DRIVER_ID */
 }
 
 static inline psa_status_t psa_driver_wrapper_aead_encrypt(